@@ -0,0 +1,113 @@
+/***************************************************************************
+ *   Copyright (C) 2019 PCSX-Redux authors                                 *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.           *
+ ***************************************************************************/
+
+#include "core/adpcm.h"
+
+// PCSX_NO_SIMD builds the portable code only, for tools/kernelcheck to compare against
+#if !defined(PCSX_NO_SIMD) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define ADPCM_SSE2 1
+#include <emmintrin.h>
+#endif
+
+namespace {
+
+// Filters 5 to 15 don't exist; they used to read past the end of the tables, now they are simply 0.
+const int s_spuFilters[16][2] = {{0, 0}, {60, 0}, {115, -52}, {98, -55}, {122, -60}};
+
+// -K * (1 << 10), with K = {0.0, 0.9375, 1.796875, 1.53125} and {0.0, 0.0, -0.8125, -0.859375}
+const int s_xaFilters[16][2] = {{0, 0}, {-960, 0}, {-1840, 832}, {-1568, 880}};
+
+// Fills samples[4..31] with the sign extended, shifted nibbles of the block: (int16_t)(nibble << 12) >> shift.
+// samples[0..3] receive the header bytes, and are garbage.
+inline void expandNibbles(const uint8_t *block, unsigned shift, int32_t *samples) {
+#ifdef ADPCM_SSE2
+    const __m128i mask = _mm_set1_epi8(0x0f);
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i count = _mm_cvtsi32_si128(shift);
+    __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i *>(block));
+    __m128i lo = _mm_and_si128(bytes, mask);
+    __m128i hi = _mm_and_si128(_mm_srli_epi16(bytes, 4), mask);
+    __m128i nibbles[2] = {_mm_unpacklo_epi8(lo, hi), _mm_unpackhi_epi8(lo, hi)};
+    for (unsigned i = 0; i < 2; i++) {
+        // moving the nibbles to the top of 16 bits lanes makes the arithmetic shift do the sign extension
+        __m128i w[2] = {_mm_slli_epi16(_mm_unpacklo_epi8(zero, nibbles[i]), 4),
+                        _mm_slli_epi16(_mm_unpackhi_epi8(zero, nibbles[i]), 4)};
+        for (unsigned j = 0; j < 2; j++) {
+            __m128i s = _mm_sra_epi16(w[j], count);
+            __m128i sign = _mm_srai_epi16(s, 15);
+            __m128i *out = reinterpret_cast<__m128i *>(samples + i * 16 + j * 8);
+            _mm_storeu_si128(out, _mm_unpacklo_epi16(s, sign));
+            _mm_storeu_si128(out + 1, _mm_unpackhi_epi16(s, sign));
+        }
+    }
+#else
+    for (unsigned i = 2; i < PCSX::ADPCM::BLOCK_SIZE; i++) {
+        samples[i * 2] = int16_t((block[i] & 0x0f) << 12) >> shift;
+        samples[i * 2 + 1] = int16_t((block[i] & 0xf0) << 8) >> shift;
+    }
+#endif
+}
+
+}  // namespace
+
+void PCSX::ADPCM::decodeSPUBlock(const uint8_t *block, int *dest, int *s1, int *s2) {
+    int32_t samples[32];
+    const int shift = block[0] & 0x0f;
+    const int f0 = s_spuFilters[block[0] >> 4][0];
+    const int f1 = s_spuFilters[block[0] >> 4][1];
+    int y1 = *s1, y2 = *s2;
+
+    expandNibbles(block, shift, samples);
+
+    for (unsigned i = 0; i < BLOCK_SAMPLES; i++) {
+        int fa = samples[i + 4] + ((y1 * f0) >> 6) + ((y2 * f1) >> 6);
+        y2 = y1;
+        y1 = fa;
+        dest[i] = fa;
+    }
+
+    *s1 = y1;
+    *s2 = y2;
+}
+
+void PCSX::ADPCM::decodeXABlock(const uint8_t *block, int16_t *dest, int stride, int32_t *y0, int32_t *y1) {
+    static const int SH = 4;
+    static const int SHC = 10;
+    int32_t samples[32];
+    const int shift = block[0] & 0x0f;
+    const int k0 = s_xaFilters[block[0] >> 4][0];
+    const int k1 = s_xaFilters[block[0] >> 4][1];
+    int32_t fy0 = *y0, fy1 = *y1;
+
+    expandNibbles(block, shift, samples);
+
+    for (unsigned i = 0; i < BLOCK_SAMPLES; i++) {
+        int32_t x = samples[i + 4] * (1 << SH);
+        x -= (k0 * fy0 + k1 * fy1) >> SHC;
+        fy1 = fy0;
+        fy0 = x;
+        if (x < (-32768 << SH)) x = -32768 << SH;
+        if (x > (32767 << SH)) x = 32767 << SH;
+        *dest = x >> SH;
+        dest += stride;
+    }
+
+    *y0 = fy0;
+    *y1 = fy1;
+}
@@ -0,0 +1,42 @@
+/***************************************************************************
+ *   Copyright (C) 2019 PCSX-Redux authors                                 *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.           *
+ ***************************************************************************/
+
+#pragma once
+
+#include <stdint.h>
+
+namespace PCSX {
+
+namespace ADPCM {
+
+// Both the SPU voices and the XA sectors use the same block layout: a header byte holding the
+// shift (low nibble) and the filter (high nibble), a flags byte, then 28 4-bit samples, low nibble first.
+// The nibbles are expanded 16 at a time with SIMD when available; the filter recurrence stays scalar.
+static const unsigned BLOCK_SIZE = 16;
+static const unsigned BLOCK_SAMPLES = 28;
+
+// SPU voice flavour: 6 bits filter coefficients, no clamping; s1/s2 are the last two decoded samples.
+void decodeSPUBlock(const uint8_t *block, int *dest, int *s1, int *s2);
+
+// XA flavour: 10 bits filter coefficients, 4 bits of extra precision, output clamped to 16 bits.
+void decodeXABlock(const uint8_t *block, int16_t *dest, int stride, int32_t *y0, int32_t *y1);
+
+}  // namespace ADPCM
+
+}  // namespace PCSX
@@ -0,0 +1,320 @@
+/***************************************************************************
+ *   Copyright (C) 2019 PCSX-Redux authors                                 *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.           *
+ ***************************************************************************/
+
+#include "core/cddastream.h"
+
+#include <string.h>
+
+#include <algorithm>
+
+#include "core/psxemulator.h"
+#include "core/system.h"
+
+extern "C" {
+#include <libavcodec/avcodec.h>
+#include <libavformat/avformat.h>
+#include <libavutil/mathematics.h>
+#include <libavutil/opt.h>
+#include <libswresample/swresample.h>
+}
+
+// 44.1kHz, 16 bits, stereo
+static const unsigned SAMPLE_SIZE = 4;
+
+bool PCSX::CDDAStream::open(const char *path) {
+    if (m_thread.joinable() && m_path == path) return true;
+    close();
+
+    av_log_set_level(AV_LOG_QUIET);
+    if (avformat_open_input(&m_format, path, NULL, NULL) < 0) {
+        PCSX::g_system->printf(_("Could not open source file %s\n"), path);
+        return false;
+    }
+
+    if (avformat_find_stream_info(m_format, NULL) < 0) {
+        PCSX::g_system->printf(_("Could not find stream information\n"));
+        close();
+        return false;
+    }
+
+    m_streamIndex = av_find_best_stream(m_format, AVMEDIA_TYPE_AUDIO, -1, -1, NULL, 0);
+    if (m_streamIndex < 0) {
+        PCSX::g_system->printf(_("Could not find audio stream in the input, aborting\n"));
+        close();
+        return false;
+    }
+    m_stream = m_format->streams[m_streamIndex];
+
+    AVCodec *decoder = avcodec_find_decoder(m_stream->codecpar->codec_id);
+    if (!decoder) {
+        PCSX::g_system->printf(_("Could not find audio codec for the input, aborting\n"));
+        close();
+        return false;
+    }
+
+    m_codec = avcodec_alloc_context3(decoder);
+    if (!m_codec || avcodec_parameters_to_context(m_codec, m_stream->codecpar) < 0 ||
+        avcodec_open2(m_codec, decoder, NULL) < 0) {
+        PCSX::g_system->printf(_("Failed to open audio codec\n"));
+        close();
+        return false;
+    }
+
+    m_resampler = swr_alloc();
+    if (!m_resampler) {
+        PCSX::g_system->printf(_("Could not allocate resample context"));
+        close();
+        return false;
+    }
+    int64_t layout = m_codec->channel_layout ? m_codec->channel_layout
+                                             : av_get_default_channel_layout(m_codec->channels);
+    av_opt_set_int(m_resampler, "in_channel_layout", layout, 0);
+    av_opt_set_int(m_resampler, "out_channel_layout", AV_CH_LAYOUT_STEREO, 0);
+    av_opt_set_int(m_resampler, "in_sample_rate", m_codec->sample_rate, 0);
+    av_opt_set_int(m_resampler, "out_sample_rate", 44100, 0);
+    av_opt_set_sample_fmt(m_resampler, "in_sample_fmt", m_codec->sample_fmt, 0);
+    av_opt_set_sample_fmt(m_resampler, "out_sample_fmt", AV_SAMPLE_FMT_S16, 0);
+    if (swr_init(m_resampler) < 0) {
+        PCSX::g_system->printf(_("Could not open resample context"));
+        close();
+        return false;
+    }
+
+    m_frame = av_frame_alloc();
+    if (!m_frame) {
+        PCSX::g_system->printf(_("Could not allocate frame\n"));
+        close();
+        return false;
+    }
+
+    m_ring.resize(SECTORS * SECTOR_SIZE);
+    m_validStart = m_writeEnd = m_playPos = 0;
+    m_seekTo = -1;
+    m_eof = false;
+    m_stop = false;
+    m_path = path;
+    // the container is at the start of the track already, which is where playing usually begins
+    m_thread = std::thread([this, emulator = g_emulator, system = g_system]() {
+        g_emulator = emulator;
+        g_system = system;
+        worker();
+    });
+
+    return true;
+}
+
+void PCSX::CDDAStream::close() {
+    if (m_thread.joinable()) {
+        {
+            std::lock_guard<std::mutex> lock(m_lock);
+            m_stop = true;
+        }
+        m_wake.notify_one();
+        m_thread.join();
+    }
+
+    av_frame_free(&m_frame);
+    swr_free(&m_resampler);
+    avcodec_free_context(&m_codec);
+    avformat_close_input(&m_format);
+    m_stream = nullptr;
+    m_streamIndex = -1;
+    m_path.clear();
+    m_ring = std::vector<uint8_t>();
+}
+
+bool PCSX::CDDAStream::read(int sector, uint8_t *dest) {
+    if (!m_thread.joinable() || sector < 0) return false;
+
+    const int64_t start = int64_t(sector) * SECTOR_SIZE;
+    const int64_t end = start + SECTOR_SIZE;
+    const int64_t size = m_ring.size();
+    std::unique_lock<std::mutex> lock(m_lock);
+
+    auto available = [&] { return m_seekTo < 0 && start >= m_validStart && end <= m_writeEnd; };
+    auto pastEnd = [&] { return m_seekTo < 0 && m_eof && end > m_writeEnd; };
+    // the stream jumped over it, which can happen when a seek lands past its target
+    auto skipped = [&] { return m_seekTo < 0 && start < m_validStart; };
+
+    if (!available()) {
+        // not far ahead of what's decoded already: the worker will get there by itself
+        bool ahead = m_seekTo < 0 && start >= m_validStart && start < m_writeEnd + size / 2;
+        if (ahead && pastEnd()) return false;
+        if (!ahead && m_seekTo != start) m_seekTo = start;
+        m_playPos = start;
+        m_wake.notify_one();
+        m_loaded.wait(lock, [&] { return available() || pastEnd() || skipped(); });
+        if (!available()) return false;
+    }
+
+    int64_t offset = start % size;
+    unsigned first = std::min<int64_t>(SECTOR_SIZE, size - offset);
+    memcpy(dest, m_ring.data() + offset, first);
+    memcpy(dest + first, m_ring.data(), SECTOR_SIZE - first);
+
+    m_playPos = start;
+    lock.unlock();
+    m_wake.notify_one();
+
+    return true;
+}
+
+// moves the container and the decoder to the target, or a bit before; returns where the decoding now starts
+int64_t PCSX::CDDAStream::seek(int64_t target) {
+    int64_t origin = m_stream->start_time != AV_NOPTS_VALUE ? m_stream->start_time : 0;
+    int64_t ts = av_rescale_q(target / SAMPLE_SIZE, AVRational{1, 44100}, m_stream->time_base) + origin;
+    int64_t pos = target;
+
+    if (av_seek_frame(m_format, m_streamIndex, ts, AVSEEK_FLAG_BACKWARD) < 0) {
+        // some containers can't seek by time; going back to the start always works
+        if (avformat_seek_file(m_format, m_streamIndex, INT64_MIN, origin, origin, 0) < 0) return -1;
+        pos = 0;
+    }
+    avcodec_flush_buffers(m_codec);
+    swr_close(m_resampler);
+    if (swr_init(m_resampler) < 0) return -1;
+
+    return pos;
+}
+
+// takes the lock as held; drops what the reader isn't waiting for anymore, and returns how much of
+// the data it took: it never writes a whole ring past the play position, which the reader still needs
+size_t PCSX::CDDAStream::append(int64_t pos, const uint8_t *data, size_t size) {
+    if (m_seekTo >= 0) return size;
+
+    const int64_t ringSize = m_ring.size();
+    const int64_t limit = m_playPos + ringSize;
+    size_t taken = 0;
+    // the seek usually lands a bit before the target
+    if (pos < m_writeEnd) {
+        size_t skip = std::min<int64_t>(size, m_writeEnd - pos);
+        data += skip;
+        size -= skip;
+        pos += skip;
+        taken += skip;
+    }
+    // or the stream has a hole
+    if (pos > m_writeEnd) {
+        int64_t holeEnd = std::min(pos, limit);
+        m_writeEnd = std::max(m_writeEnd, holeEnd - ringSize);
+        while (m_writeEnd < holeEnd) {
+            int64_t offset = m_writeEnd % ringSize;
+            int64_t chunk = std::min(holeEnd - m_writeEnd, ringSize - offset);
+            memset(m_ring.data() + offset, 0, chunk);
+            m_writeEnd += chunk;
+        }
+    }
+    while (size && m_writeEnd == pos && m_writeEnd < limit) {
+        int64_t offset = m_writeEnd % ringSize;
+        size_t chunk = std::min<int64_t>({int64_t(size), ringSize - offset, limit - m_writeEnd});
+        memcpy(m_ring.data() + offset, data, chunk);
+        data += chunk;
+        size -= chunk;
+        pos += chunk;
+        taken += chunk;
+        m_writeEnd += chunk;
+    }
+    m_validStart = std::max(m_validStart, m_writeEnd - ringSize);
+    m_loaded.notify_all();
+    return taken;
+}
+
+void PCSX::CDDAStream::worker() {
+    std::vector<uint8_t> pcm;
+    int64_t pos = 0;
+    bool synced = false;  // whether pos is known to match the frames coming out of the decoder
+    std::unique_lock<std::mutex> lock(m_lock);
+
+    while (true) {
+        const int64_t ringSize = m_ring.size();
+        m_wake.wait(lock, [&] {
+            return m_stop || m_seekTo >= 0 || (!m_eof && m_writeEnd + MARGIN * SECTOR_SIZE < m_playPos + ringSize);
+        });
+        if (m_stop) break;
+
+        if (m_seekTo >= 0) {
+            int64_t target = m_seekTo;
+            m_seekTo = -1;
+            m_validStart = m_writeEnd = m_playPos = target;
+            m_eof = false;
+            lock.unlock();
+            pos = seek(target);
+            lock.lock();
+            synced = false;
+            if (pos < 0) {
+                m_eof = true;
+                m_loaded.notify_all();
+            }
+            continue;
+        }
+        lock.unlock();
+
+        AVPacket packet;
+        av_init_packet(&packet);
+        packet.data = NULL;
+        packet.size = 0;
+        int ret = av_read_frame(m_format, &packet);
+        if (ret >= 0 && packet.stream_index != m_streamIndex) {
+            av_packet_unref(&packet);
+            lock.lock();
+            continue;
+        }
+        // past the end of the file, an empty packet drains the decoder
+        avcodec_send_packet(m_codec, ret >= 0 ? &packet : NULL);
+        if (ret >= 0) av_packet_unref(&packet);
+
+        while (avcodec_receive_frame(m_codec, m_frame) == 0) {
+            if (!synced && m_frame->best_effort_timestamp != AV_NOPTS_VALUE) {
+                int64_t ts = m_frame->best_effort_timestamp;
+                if (m_stream->start_time != AV_NOPTS_VALUE) ts -= m_stream->start_time;
+                pos = std::max<int64_t>(av_rescale_q(ts, m_stream->time_base, AVRational{1, 44100}), 0) * SAMPLE_SIZE;
+            }
+            synced = true;
+
+            int count = swr_get_out_samples(m_resampler, m_frame->nb_samples);
+            if (count <= 0) continue;
+            pcm.resize(count * SAMPLE_SIZE);
+            uint8_t *out = pcm.data();
+            count = swr_convert(m_resampler, &out, count, const_cast<const uint8_t **>(m_frame->extended_data),
+                                m_frame->nb_samples);
+            if (count <= 0) continue;
+
+            const uint8_t *data = pcm.data();
+            size_t size = count * SAMPLE_SIZE;
+            lock.lock();
+            // a frame can be larger than the headroom; the rest waits for the reader to make room
+            while (true) {
+                size_t taken = append(pos, data, size);
+                data += taken;
+                size -= taken;
+                pos += taken;
+                if (!size) break;
+                m_wake.wait(lock, [&] { return m_stop || m_seekTo >= 0 || m_writeEnd < m_playPos + ringSize; });
+                if (m_stop || m_seekTo >= 0) break;
+            }
+            lock.unlock();
+        }
+
+        lock.lock();
+        if (ret < 0) {
+            m_eof = true;
+            m_loaded.notify_all();
+        }
+    }
+}
@@ -0,0 +1,83 @@
+/***************************************************************************
+ *   Copyright (C) 2019 PCSX-Redux authors                                 *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.           *
+ ***************************************************************************/
+
+#pragma once
+
+#include <stdint.h>
+
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+struct AVCodecContext;
+struct AVFormatContext;
+struct AVFrame;
+struct AVStream;
+struct SwrContext;
+
+namespace PCSX {
+
+// Decodes a compressed audio track (MP3, FLAC, OGG...) to 44.1kHz 16 bits stereo on a worker thread,
+// a few seconds ahead of the play position, into a ring of raw CD sectors. Reading anything outside
+// of the ring seeks the container and restarts the decoding from there, so only the ring is ever
+// kept in memory, whatever the length of the track.
+class CDDAStream {
+  public:
+    static const unsigned SECTOR_SIZE = 2352;
+    static const unsigned SECTORS = 75 * 4;
+    // how much room the worker leaves behind the play position; has to hold a whole decoded frame
+    static const unsigned MARGIN = 32;
+
+    ~CDDAStream() { close(); }
+    // does nothing if path is already the opened track
+    bool open(const char *path);
+    void close();
+    // blocks until the sector is decoded; false past the end of the track or on errors
+    bool read(int sector, uint8_t *dest);
+
+  private:
+    void worker();
+    int64_t seek(int64_t target);
+    size_t append(int64_t pos, const uint8_t *data, size_t size);
+
+    std::string m_path;
+    AVFormatContext *m_format = nullptr;
+    AVCodecContext *m_codec = nullptr;
+    AVStream *m_stream = nullptr;
+    SwrContext *m_resampler = nullptr;
+    AVFrame *m_frame = nullptr;
+    int m_streamIndex = -1;
+
+    std::thread m_thread;
+    std::mutex m_lock;
+    std::condition_variable m_wake;    // a sector got consumed, or a seek was requested
+    std::condition_variable m_loaded;  // the worker appended data, or gave up
+    bool m_stop = false;
+    std::vector<uint8_t> m_ring;
+    // all in bytes of decoded output, from the start of the track; the ring holds [m_validStart, m_writeEnd)
+    int64_t m_validStart = 0;
+    int64_t m_writeEnd = 0;
+    int64_t m_playPos = 0;
+    int64_t m_seekTo = -1;
+    bool m_eof = false;
+};
+
+}  // namespace PCSX
@@ -0,0 +1,117 @@
+/***************************************************************************
+ *   Copyright (C) 2019 PCSX-Redux authors                                 *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.           *
+ ***************************************************************************/
+
+#include "core/cdprefetch.h"
+
+#include <string.h>
+
+#include "core/psxemulator.h"
+
+void PCSX::CDPrefetch::start(Loader loader) {
+    stop();
+    m_loader = loader;
+    m_stop = false;
+    m_window = -1;
+    m_loading = -1;
+    for (auto &slot : m_slots) slot.sector = -1;
+    m_hits = 0;
+    m_misses = 0;
+    // the loaders report their errors through the frontend of the machine the image belongs to
+    m_thread = std::thread([this, emulator = g_emulator, system = g_system]() {
+        g_emulator = emulator;
+        g_system = system;
+        worker();
+    });
+}
+
+void PCSX::CDPrefetch::stop() {
+    if (!m_thread.joinable()) return;
+    {
+        std::lock_guard<std::mutex> lock(m_lock);
+        m_stop = true;
+    }
+    m_wake.notify_one();
+    m_thread.join();
+    m_loader = nullptr;
+}
+
+bool PCSX::CDPrefetch::read(int sector, uint8_t *data, uint8_t *sub) {
+    if (!m_thread.joinable() || sector < 0) return m_loader && m_loader(sector, data, sub);
+
+    std::unique_lock<std::mutex> lock(m_lock);
+    Slot &slot = m_slots[sector % SECTORS];
+    bool ok;
+
+    // the worker may be right in the middle of loading it; that's still cheaper than a second read
+    if (m_loading == sector) m_loaded.wait(lock, [&] { return m_loading != sector; });
+
+    if (slot.sector == sector) {
+        memcpy(data, slot.data, SECTOR_SIZE);
+        memcpy(sub, slot.sub, SUB_SIZE);
+        ok = slot.ok;
+        m_hits++;
+    } else {
+        lock.unlock();
+        ok = m_loader(sector, data, sub);
+        lock.lock();
+        m_misses++;
+    }
+
+    m_window = sector + 1;
+    lock.unlock();
+    m_wake.notify_one();
+
+    return ok;
+}
+
+// first sector of the window that isn't in the ring yet, or -1; we don't read past a failed sector,
+// which is usually the end of the image
+int PCSX::CDPrefetch::nextToLoad() {
+    if (m_window < 0) return -1;
+    for (int sector = m_window; sector < m_window + int(SECTORS); sector++) {
+        const Slot &slot = m_slots[sector % SECTORS];
+        if (slot.sector != sector) return sector;
+        if (!slot.ok) return -1;
+    }
+    return -1;
+}
+
+void PCSX::CDPrefetch::worker() {
+    std::unique_lock<std::mutex> lock(m_lock);
+
+    while (!m_stop) {
+        int sector = nextToLoad();
+        if (sector < 0) {
+            m_wake.wait(lock);
+            continue;
+        }
+
+        // the consumer never looks at a slot that doesn't hold its sector, so it can be filled unlocked
+        Slot &slot = m_slots[sector % SECTORS];
+        slot.sector = -1;
+        m_loading = sector;
+        lock.unlock();
+        bool ok = m_loader(sector, slot.data, slot.sub);
+        lock.lock();
+        slot.ok = ok;
+        slot.sector = sector;
+        m_loading = -1;
+        m_loaded.notify_all();
+    }
+}
@@ -0,0 +1,80 @@
+/***************************************************************************
+ *   Copyright (C) 2019 PCSX-Redux authors                                 *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.           *
+ ***************************************************************************/
+
+#pragma once
+
+#include <stdint.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+namespace PCSX {
+
+// Read-ahead of the CD image: a worker thread keeps the sectors following the last one read
+// loaded in a small ring, so that the emulation thread doesn't stall on the disk while the
+// game streams data. A read outside of the ring is done synchronously and moves the window.
+class CDPrefetch {
+  public:
+    static const unsigned SECTOR_SIZE = 2352;
+    static const unsigned SUB_SIZE = 96;
+    static const unsigned SECTORS = 32;
+
+    // loads one raw sector and its subchannel data; called from both threads, so it has to
+    // do its own locking against anything else using the image
+    typedef std::function<bool(int sector, uint8_t *data, uint8_t *sub)> Loader;
+
+    struct Stats {
+        uint64_t hits;
+        uint64_t misses;
+    };
+
+    ~CDPrefetch() { stop(); }
+    void start(Loader loader);
+    void stop();
+    bool read(int sector, uint8_t *data, uint8_t *sub);
+    Stats stats() const { return {m_hits.load(), m_misses.load()}; }
+
+  private:
+    struct Slot {
+        int sector = -1;
+        bool ok = false;
+        uint8_t data[SECTOR_SIZE];
+        uint8_t sub[SUB_SIZE];
+    };
+
+    void worker();
+    int nextToLoad();
+
+    Loader m_loader;
+    std::thread m_thread;
+    std::mutex m_lock;
+    std::condition_variable m_wake;    // the window moved
+    std::condition_variable m_loaded;  // the worker filled a slot
+    bool m_stop = false;
+    int m_window = -1;   // first sector of the read-ahead window; -1 until the first read
+    int m_loading = -1;  // sector the worker is currently loading
+    Slot m_slots[SECTORS];
+    std::atomic<uint64_t> m_hits = 0;
+    std::atomic<uint64_t> m_misses = 0;
+};
+
+}  // namespace PCSX
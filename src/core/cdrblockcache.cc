@@ -0,0 +1,148 @@
+/***************************************************************************
+ *   Copyright (C) 2019 PCSX-Redux authors                                 *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.           *
+ ***************************************************************************/
+
+#include "core/cdrblockcache.h"
+
+#include <algorithm>
+
+#include "core/psxemulator.h"
+
+void PCSX::CDRBlockCache::start(Loader loader, size_t blockSize, unsigned blockCount, unsigned capacity,
+                                unsigned readAhead, unsigned threads) {
+    stop();
+    m_loader = loader;
+    m_blockSize = blockSize;
+    m_blockCount = blockCount;
+    // room for the window being read ahead, the block being read, and the one pinned by the reader
+    m_readAhead = readAhead;
+    m_entries = std::vector<Entry>(std::max(capacity, readAhead + 2));
+    m_map.clear();
+    m_queue.clear();
+    m_pinned = nullptr;
+    m_clock = 0;
+    m_stop = false;
+    m_hits = 0;
+    m_misses = 0;
+    // the loader reports its errors through the frontend of the machine the image belongs to
+    for (unsigned i = 0; i < threads; i++) {
+        m_threads.emplace_back([this, emulator = g_emulator, system = g_system]() {
+            g_emulator = emulator;
+            g_system = system;
+            worker();
+        });
+    }
+}
+
+void PCSX::CDRBlockCache::stop() {
+    {
+        std::lock_guard<std::mutex> lock(m_lock);
+        m_stop = true;
+    }
+    m_wake.notify_all();
+    for (auto &thread : m_threads) thread.join();
+    m_threads.clear();
+    m_entries.clear();
+    m_map.clear();
+    m_pinned = nullptr;
+    m_loader = nullptr;
+}
+
+const uint8_t *PCSX::CDRBlockCache::get(unsigned block) {
+    std::unique_lock<std::mutex> lock(m_lock);
+    Entry *entry = nullptr;
+
+    auto i = m_map.find(block);
+    if (i != m_map.end()) {
+        entry = i->second;
+        // a worker may still be inflating it; waiting for it is still better than starting over
+        m_loaded.wait(lock, [entry, block] { return entry->state != Entry::LOADING || entry->block != block; });
+        // or it failed, and the reader gets to try again
+        if (entry->block != block || entry->state != Entry::READY) entry = nullptr;
+    }
+
+    if (entry) {
+        m_hits++;
+    } else {
+        m_misses++;
+        entry = evict();
+        if (!entry) return nullptr;
+        load(entry, block, lock);
+    }
+    entry->lastUse = ++m_clock;
+    m_pinned = entry;
+
+    // whatever was queued for the previous position is stale now
+    m_queue.clear();
+    for (unsigned next = block + 1; next <= block + m_readAhead && next < m_blockCount; next++) {
+        if (m_map.find(next) == m_map.end()) m_queue.push_back(next);
+    }
+    if (!m_queue.empty()) m_wake.notify_all();
+
+    return entry->state == Entry::READY ? entry->data.data() : nullptr;
+}
+
+// least recently used entry that's neither being inflated, nor still in the reader's hands
+PCSX::CDRBlockCache::Entry *PCSX::CDRBlockCache::evict() {
+    Entry *victim = nullptr;
+    for (auto &entry : m_entries) {
+        if (entry.state == Entry::LOADING || &entry == m_pinned) continue;
+        if (!victim || entry.state == Entry::EMPTY || entry.lastUse < victim->lastUse) victim = &entry;
+        if (victim->state == Entry::EMPTY) break;
+    }
+    if (victim && victim->state != Entry::EMPTY) m_map.erase(victim->block);
+    return victim;
+}
+
+void PCSX::CDRBlockCache::load(Entry *entry, unsigned block, std::unique_lock<std::mutex> &lock) {
+    entry->state = Entry::LOADING;
+    entry->block = block;
+    entry->data.resize(m_blockSize);
+    m_map[block] = entry;
+    lock.unlock();
+    bool ok = m_loader(block, entry->data.data());
+    lock.lock();
+    if (ok) {
+        entry->state = Entry::READY;
+    } else {
+        // forgotten right away, so that a transient error doesn't stick until the entry gets evicted
+        entry->state = Entry::EMPTY;
+        m_map.erase(block);
+    }
+    m_loaded.notify_all();
+}
+
+void PCSX::CDRBlockCache::worker() {
+    std::unique_lock<std::mutex> lock(m_lock);
+
+    while (!m_stop) {
+        if (m_queue.empty()) {
+            m_wake.wait(lock);
+            continue;
+        }
+        unsigned block = m_queue.front();
+        m_queue.pop_front();
+        if (m_map.find(block) != m_map.end()) continue;
+
+        Entry *entry = evict();
+        if (!entry) continue;
+        // freshly read ahead blocks shouldn't be the first ones to go
+        entry->lastUse = ++m_clock;
+        load(entry, block, lock);
+    }
+}
@@ -0,0 +1,85 @@
+/***************************************************************************
+ *   Copyright (C) 2019 PCSX-Redux authors                                 *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.           *
+ ***************************************************************************/
+
+#pragma once
+
+#include <stdint.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace PCSX {
+
+// LRU cache of the decompressed blocks of a compressed CD image (PBP, CBN), with worker threads
+// inflating the blocks that follow the last one read, so that sequential reads rarely wait on zlib.
+class CDRBlockCache {
+  public:
+    // fills dest with one decompressed block; called concurrently from the workers and the reader
+    typedef std::function<bool(unsigned block, uint8_t *dest)> Loader;
+
+    struct Stats {
+        uint64_t hits;
+        uint64_t misses;
+    };
+
+    ~CDRBlockCache() { stop(); }
+    void start(Loader loader, size_t blockSize, unsigned blockCount, unsigned capacity, unsigned readAhead,
+               unsigned threads);
+    void stop();
+    // the returned block stays valid until the next call; only one thread may call this
+    const uint8_t *get(unsigned block);
+    Stats stats() const { return {m_hits.load(), m_misses.load()}; }
+
+  private:
+    struct Entry {
+        enum { EMPTY, LOADING, READY } state = EMPTY;
+        unsigned block = 0;
+        uint64_t lastUse = 0;
+        std::vector<uint8_t> data;
+    };
+
+    void worker();
+    Entry *evict();
+    void load(Entry *entry, unsigned block, std::unique_lock<std::mutex> &lock);
+
+    Loader m_loader;
+    size_t m_blockSize = 0;
+    unsigned m_blockCount = 0;
+    unsigned m_readAhead = 0;
+    std::vector<Entry> m_entries;
+    std::unordered_map<unsigned, Entry *> m_map;
+    std::deque<unsigned> m_queue;  // blocks the workers should inflate next
+    Entry *m_pinned = nullptr;     // what the last get() returned
+    uint64_t m_clock = 0;
+    std::vector<std::thread> m_threads;
+    std::mutex m_lock;
+    std::condition_variable m_wake;
+    std::condition_variable m_loaded;
+    bool m_stop = false;
+    std::atomic<uint64_t> m_hits = 0;
+    std::atomic<uint64_t> m_misses = 0;
+};
+
+}  // namespace PCSX
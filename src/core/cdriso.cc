@@ -25,26 +25,46 @@
 #define NOMINMAX
 #include <windows.h>
 
+#include <io.h>
 #include <process.h>
+#include <sys/stat.h>
+#include <sys/types.h>
 #define strcasecmp _stricmp
 #else
 #include <limits.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 #include <sys/time.h>
 #include <unistd.h>
 #endif
 #include <zlib.h>
 
 #include <algorithm>
+#include <filesystem>
+#include <string>
 
 #include "core/cdriso.h"
 #include "core/cdrom.h"
 #include "core/plugins.h"
 #include "core/ppf.h"
+#include "core/profiler.h"
 #include "core/psxemulator.h"
 
 const uint8_t File::m_internalBuffer = 0;
 void File::close() {
     if (m_handle) fclose(m_handle);
+    m_handle = NULL;
+    if (m_mapped) {
+#ifdef _WIN32
+        UnmapViewOfFile(m_data);
+        CloseHandle(m_mapping);
+        m_mapping = NULL;
+#else
+        munmap(const_cast<uint8_t *>(m_data), m_size);
+#endif
+        m_mapped = false;
+        m_data = NULL;
+    }
 }
 ssize_t File::seek(ssize_t pos, int wheel) {
     if (m_handle) return fseek(m_handle, pos, wheel);
@@ -54,14 +74,14 @@ ssize_t File::seek(ssize_t pos, int wheel) {
             m_ptr = pos;
             break;
         case SEEK_END:
-            m_ptr = m_size - pos;
+            m_ptr = m_size + pos;
             break;
         case SEEK_CUR:
             m_ptr += pos;
             break;
     }
-    m_ptr = std::min(std::max(m_ptr, m_size), (ssize_t)0);
-    return m_ptr;
+    m_ptr = std::max(std::min(m_ptr, m_size), (ssize_t)0);
+    return 0;
 }
 ssize_t File::tell() {
     if (m_handle) return ftell(m_handle);
@@ -84,8 +104,9 @@ File::File(const char *filename) { m_handle = fopen(filename, "rb"); }
 ssize_t File::read(void *dest, ssize_t size) {
     if (m_handle) return fread(dest, 1, size, m_handle);
     if (!m_data) return -1;
-    size = std::max(m_size - m_ptr, size);
+    size = std::min(m_size - m_ptr, size);
     if (size == 0) return -1;
+    advise(m_ptr, size);
     memcpy(dest, m_data + m_ptr, size);
     m_ptr += size;
     return size;
@@ -100,15 +121,58 @@ int File::getc() {
     if (m_size == m_ptr) return -1;
     return m_data[m_ptr++];
 }
-bool File::failed() { return m_ptr || m_data; }
+bool File::failed() { return !m_handle && !m_data; }
+bool File::map() {
+    if (!m_handle) return m_data != NULL;
+    if (fseek(m_handle, 0, SEEK_END) != 0) return false;
+    ssize_t size = ftell(m_handle);
+    if (size <= 0) return false;
+    void *data = NULL;
+#ifdef _WIN32
+    HANDLE mapping = CreateFileMapping((HANDLE)_get_osfhandle(_fileno(m_handle)), NULL, PAGE_READONLY, 0, 0, NULL);
+    if (!mapping) return false;
+    data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (!data) {
+        CloseHandle(mapping);
+        return false;
+    }
+    m_mapping = mapping;
+#else
+    data = mmap(NULL, size, PROT_READ, MAP_SHARED, fileno(m_handle), 0);
+    if (data == MAP_FAILED) return false;
+    madvise(data, size, MADV_SEQUENTIAL);
+#endif
+    fclose(m_handle);
+    m_handle = NULL;
+    m_data = static_cast<uint8_t *>(data);
+    m_size = size;
+    m_ptr = 0;
+    m_mapped = true;
+    m_advisedStart = m_advisedEnd = 0;
+    return true;
+}
+const uint8_t *File::peek(ssize_t pos, ssize_t size) {
+    if (!m_data || pos < 0 || pos + size > m_size) return NULL;
+    advise(pos, size);
+    return m_data + pos;
+}
+// asks the kernel to page in the window ahead of the read position, whenever the
+// reads leave the previous one, or get close to its end
+void File::advise(ssize_t pos, ssize_t size) {
+#ifndef _WIN32
+    if (!m_mapped) return;
+    if (pos >= m_advisedStart && (pos + size + READAHEAD / 2 <= m_advisedEnd || m_advisedEnd == m_size)) return;
+    static const ssize_t pageSize = sysconf(_SC_PAGESIZE);
+    ssize_t start = pos & ~(pageSize - 1);
+    ssize_t end = std::min(pos + size + READAHEAD, m_size);
+    madvise(const_cast<uint8_t *>(m_data) + start, end - start, MADV_WILLNEED);
+    m_advisedStart = start;
+    m_advisedEnd = end;
+#endif
+}
 
 extern "C" {
-#include <libavcodec/avcodec.h>
 #include <libavformat/avformat.h>
-#include <libavutil/mathematics.h>
-#include <libavutil/opt.h>
-#include <libavutil/timestamp.h>
-#include <libswresample/swresample.h>
 }
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -169,72 +233,6 @@ void PCSX::CDRiso::put32lsb(uint8_t *dest, uint32_t value) {
     dest[3] = (uint8_t)(value >> 24);
 }
 
-void PCSX::CDRiso::eccedc_init() {
-    size_t i;
-    for (i = 0; i < 256; i++) {
-        uint32_t edc = i;
-        size_t j = (i << 1) ^ (i & 0x80 ? 0x11D : 0);
-        m_ecc_f_lut[i] = j;
-        m_ecc_b_lut[i ^ j] = i;
-        for (j = 0; j < 8; j++) {
-            edc = (edc >> 1) ^ (edc & 1 ? 0xD8018001 : 0);
-        }
-        m_edc_lut[i] = edc;
-    }
-}
-
-////////////////////////////////////////////////////////////////////////////////
-//
-// Compute EDC for a block
-//
-uint32_t PCSX::CDRiso::edc_compute(uint32_t edc, const uint8_t *src, size_t size) {
-    for (; size; size--) {
-        edc = (edc >> 8) ^ m_edc_lut[(edc ^ (*src++)) & 0xFF];
-    }
-    return edc;
-}
-
-//
-// Write ECC block (either P or Q)
-//
-void PCSX::CDRiso::ecc_writepq(const uint8_t *address, const uint8_t *data, size_t major_count, size_t minor_count,
-                               size_t major_mult, size_t minor_inc, uint8_t *ecc) {
-    size_t size = major_count * minor_count;
-    size_t major;
-    for (major = 0; major < major_count; major++) {
-        size_t index = (major >> 1) * major_mult + (major & 1);
-        uint8_t ecc_a = 0;
-        uint8_t ecc_b = 0;
-        size_t minor;
-        for (minor = 0; minor < minor_count; minor++) {
-            uint8_t temp;
-            if (index < 4) {
-                temp = address[index];
-            } else {
-                temp = data[index - 4];
-            }
-            index += minor_inc;
-            if (index >= size) {
-                index -= size;
-            }
-            ecc_a ^= temp;
-            ecc_b ^= temp;
-            ecc_a = m_ecc_f_lut[ecc_a];
-        }
-        ecc_a = m_ecc_b_lut[m_ecc_f_lut[ecc_a] ^ ecc_b];
-        ecc[major] = (ecc_a);
-        ecc[major + major_count] = (ecc_a ^ ecc_b);
-    }
-}
-
-//
-// Write ECC P and Q codes for a sector
-//
-void PCSX::CDRiso::ecc_writesector(const uint8_t *address, const uint8_t *data, uint8_t *ecc) {
-    ecc_writepq(address, data, 86, 24, 2, 86, ecc);          // P
-    ecc_writepq(address, data, 52, 43, 86, 88, ecc + 0xAC);  // Q
-}
-
 ////////////////////////////////////////////////////////////////////////////////
 //
 // Reconstruct a sector based on type
@@ -296,13 +294,13 @@ void PCSX::CDRiso::reconstruct_sector(uint8_t *sector,  // must point to a full
     //
     switch (type) {
         case 1:
-            put32lsb(sector + 0x810, edc_compute(0, sector, 0x810));
+            put32lsb(sector + 0x810, m_eccedc.edc_compute(0, sector, 0x810));
             break;
         case 2:
-            put32lsb(sector + 0x818, edc_compute(0, sector + 0x10, 0x808));
+            put32lsb(sector + 0x818, m_eccedc.edc_compute(0, sector + 0x10, 0x808));
             break;
         case 3:
-            put32lsb(sector + 0x92C, edc_compute(0, sector + 0x10, 0x91C));
+            put32lsb(sector + 0x92C, m_eccedc.edc_compute(0, sector + 0x10, 0x91C));
             break;
     }
 
@@ -311,10 +309,10 @@ void PCSX::CDRiso::reconstruct_sector(uint8_t *sector,  // must point to a full
     //
     switch (type) {
         case 1:
-            ecc_writesector(sector + 0xC, sector + 0x10, sector + 0x81C);
+            m_eccedc.ecc_writesector(sector + 0xC, sector + 0x10, sector + 0x81C);
             break;
         case 2:
-            ecc_writesector(ZEROADDRESS, sector + 0x10, sector + 0x81C);
+            m_eccedc.ecc_writesector(ZEROADDRESS, sector + 0x10, sector + 0x81C);
             break;
     }
 
@@ -374,229 +372,8 @@ static int get_compressed_cdda_track_length(const char *filepath) {
     return seconds;
 }
 
-static int decode_packet(int *got_frame, AVPacket pkt, int audio_stream_idx, AVFrame *frame,
-                         AVCodecContext *audio_dec_ctx, void *buf, int *size, SwrContext *swr) {
-    int ret = 0;
-    int decoded = pkt.size;
-    *got_frame = 0;
-
-    if (pkt.stream_index == audio_stream_idx) {
-        // ret = avcodec_decode_audio4(audio_dec_ctx, frame, got_frame, &pkt);
-        ret = avcodec_receive_frame(audio_dec_ctx, frame);
-        if (ret == 0) *got_frame = 1;
-        if (ret == AVERROR(EAGAIN)) ret = 0;
-        if (ret == 0) ret = avcodec_send_packet(audio_dec_ctx, &pkt);
-        if (ret == AVERROR(EAGAIN)) {
-            ret = 0;
-        } else if (ret < 0) {
-            PCSX::g_system->printf(_("Error decoding audio frame\n"));
-            return ret;
-        } else {
-            ret = pkt.size;
-        }
-
-        /* Some audio decoders decode only part of the packet, and have to be
-         * called again with the remainder of the packet data.
-         * Sample: fate-suite/lossless-audio/luckynight-partial.shn
-         * Also, some decoders might over-read the packet. */
-
-        decoded = FFMIN(ret, pkt.size);
-
-        if (*got_frame) {
-            size_t unpadded_linesize = frame->nb_samples * av_get_bytes_per_sample(AVSampleFormat(frame->format));
-            swr_convert(swr, (uint8_t **)&buf, frame->nb_samples, (const uint8_t **)frame->data, frame->nb_samples);
-            (*size) += (unpadded_linesize * 2);
-        }
-    }
-    return decoded;
-}
-
-static int open_codec_context(int *stream_idx, AVFormatContext *fmt_ctx, enum AVMediaType type) {
-    int ret, stream_index;
-    AVStream *st;
-    AVDictionary *opts = NULL;
-
-    ret = av_find_best_stream(fmt_ctx, type, -1, -1, NULL, 0);
-
-    if (ret < 0) {
-        PCSX::g_system->printf(_("Could not find %s stream in input file\n"), av_get_media_type_string(type));
-        return ret;
-    } else {
-        stream_index = ret;
-        st = fmt_ctx->streams[stream_index];
-
-        AVCodec *dec = avcodec_find_decoder(st->codecpar->codec_id);
-        if (!dec) {
-            PCSX::g_system->printf(_("Failed to find %s codec\n"), av_get_media_type_string(type));
-            return AVERROR(EINVAL);
-        }
-
-        AVCodecContext *dec_ctx = avcodec_alloc_context3(dec);
-        if (!dec_ctx) {
-            PCSX::g_system->printf(_("Failed to find %s codec\n"), av_get_media_type_string(type));
-            return AVERROR(EINVAL);
-        }
-        avcodec_parameters_to_context(dec_ctx, st->codecpar);
-
-        /* Init the decoders, with or without reference counting */
-        if ((ret = avcodec_open2(dec_ctx, dec, NULL)) < 0) {
-            PCSX::g_system->printf(_("Failed to open %s codec\n"), av_get_media_type_string(type));
-            avcodec_free_context(&dec_ctx);
-            return ret;
-        }
-        avcodec_free_context(&dec_ctx);
-        *stream_idx = stream_index;
-    }
-    return 0;
-}
-
-static int decode_compressed_cdda_track(char *buf, char *src_filename, int *size) {
-    AVFormatContext *fmt_ctx = NULL;
-    AVCodecContext *audio_dec_ctx = NULL;
-    AVCodec *audio_codec = NULL;
-    AVStream *audio_stream = NULL;
-    int audio_stream_idx = -1;
-    AVFrame *frame = NULL;
-    AVPacket pkt;
-    SwrContext *resample_context;
-    int ret = 0, got_frame;
-
-    if (avformat_open_input(&fmt_ctx, src_filename, NULL, NULL) < 0) {
-        PCSX::g_system->printf(_("Could not open source file %s\n"), src_filename);
-        return -1;
-    }
-
-    if (avformat_find_stream_info(fmt_ctx, NULL) < 0) {
-        PCSX::g_system->printf(_("Could not find stream information\n"));
-        ret = -1;
-        goto end;
-    }
-
-    if (open_codec_context(&audio_stream_idx, fmt_ctx, AVMEDIA_TYPE_AUDIO) >= 0) {
-        audio_stream = fmt_ctx->streams[audio_stream_idx];
-    }
-
-    if (!audio_stream) {
-        PCSX::g_system->printf(_("Could not find audio stream in the input, aborting\n"));
-        ret = -1;
-        goto end;
-    }
-
-    audio_codec = avcodec_find_decoder(audio_stream->codecpar->codec_id);
-
-    if (!audio_codec) {
-        PCSX::g_system->printf(_("Could not find audio codec for the input, aborting\n"));
-        ret = -1;
-        goto end;
-    }
-
-    audio_dec_ctx = avcodec_alloc_context3(audio_codec);
-
-    if (!audio_dec_ctx) {
-        PCSX::g_system->printf(_("Could not allocate audio codec for the input, aborting\n"));
-        ret = -1;
-        goto end;
-    }
-
-    // init and configure resampler
-    resample_context = swr_alloc();
-    if (!resample_context) {
-        PCSX::g_system->printf(_("Could not allocate resample context"));
-        ret = -1;
-        goto end;
-    }
-    av_opt_set_int(resample_context, "in_channel_layout", audio_dec_ctx->channel_layout, 0);
-    av_opt_set_int(resample_context, "out_channel_layout", AV_CH_LAYOUT_STEREO, 0);
-    av_opt_set_int(resample_context, "in_sample_rate", audio_dec_ctx->sample_rate, 0);
-    av_opt_set_int(resample_context, "out_sample_rate", 44100, 0);
-    av_opt_set_sample_fmt(resample_context, "in_sample_fmt", audio_dec_ctx->sample_fmt, 0);
-    av_opt_set_sample_fmt(resample_context, "out_sample_fmt", AV_SAMPLE_FMT_S16, 0);
-    if (swr_init(resample_context) < 0) {
-        PCSX::g_system->printf(_("Could not open resample context"));
-        ret = -1;
-        goto end;
-    }
-
-    frame = av_frame_alloc();
-    if (!frame) {
-        PCSX::g_system->printf(_("Could not allocate frame\n"));
-        ret = AVERROR(ENOMEM);
-        goto end;
-    }
-
-    /* initialize packet, set data to NULL, let the demuxer fill it */
-    av_init_packet(&pkt);
-    pkt.data = NULL;
-    pkt.size = 0;
-
-    /* read frames from the file */
-    while (av_read_frame(fmt_ctx, &pkt) >= 0) {
-        AVPacket orig_pkt = pkt;
-        do {
-            ret = decode_packet(&got_frame, pkt, audio_stream_idx, frame, audio_dec_ctx, buf + (*size), size,
-                                resample_context);
-            if (ret < 0) break;
-            pkt.data += ret;
-            pkt.size -= ret;
-        } while (pkt.size > 0);
-        av_packet_unref(&orig_pkt);
-    }
-
-    /* flush cached frames */
-    pkt.data = NULL;
-    pkt.size = 0;
-    do {
-        decode_packet(&got_frame, pkt, audio_stream_idx, frame, audio_dec_ctx, buf + (*size), size, resample_context);
-    } while (got_frame);
-
-end:
-    swr_free(&resample_context);
-    if (audio_dec_ctx) {
-        avcodec_close(audio_dec_ctx);
-        avcodec_free_context(&audio_dec_ctx);
-    }
-    avformat_close_input(&fmt_ctx);
-    av_frame_free(&frame);
-    return ret < 0;
-}
-
 /* end of ffmpeg-only code */
 
-int PCSX::CDRiso::do_decode_cdda(struct trackinfo *tri, uint32_t tracknumber) {
-    tri->decoded_buffer = (char *)malloc(tri->len_decoded_buffer);
-    memset(tri->decoded_buffer, 0, tri->len_decoded_buffer - 1);
-
-    if (tri->decoded_buffer == NULL) {
-        PCSX::g_system->message(_("Could not allocate memory to decode CDDA TRACK: %s\n"), tri->filepath);
-        tri->handle->close();  // encoded file handle not needed anymore
-        delete tri->handle;
-        tri->handle = new File(NULL, 1);  // change handle to decoded one
-        tri->cddatype = trackinfo::BIN;
-        return 0;
-    }
-
-    tri->handle->close();  // encoded file handle not needed anymore
-    delete tri->handle;
-
-    int ret;
-    PCSX::g_system->printf(_("Decoding audio tr#%u (%s)..."), tracknumber, tri->filepath);
-
-    int len = 0;
-
-    if ((ret = decode_compressed_cdda_track(tri->decoded_buffer, tri->filepath, &len)) == 0) {
-        if (len > tri->len_decoded_buffer) {
-            PCSX::g_system->printf(_("Buffer overflow..."));
-            PCSX::g_system->printf(_("Actual %i vs. %i estimated\n"), len, tri->len_decoded_buffer);
-            len = tri->len_decoded_buffer;  // we probably segfaulted already, oh well...
-        }
-
-        tri->handle = new File(tri->decoded_buffer, len);  // change handle to decoded one
-        PCSX::g_system->printf(_("OK\n"), tri->filepath);
-    }
-    tri->cddatype = trackinfo::BIN;
-    return len;
-}
-
 // this function tries to get the .toc file of the given .bin
 // the necessary data is put into the ti (trackinformation)-array
 int PCSX::CDRiso::parsetoc(const char *isofile) {
@@ -813,18 +590,10 @@ int PCSX::CDRiso::parsecue(const char *isofile) {
                 // Check if extension is mp3, etc, for compressed audio formats
                 if (m_multifile && (m_ti[m_numtracks].cddatype = get_cdda_type(m_ti[m_numtracks].filepath)) > trackinfo::BIN) {
                     int seconds = get_compressed_cdda_track_length(filepath) + 0;
-                    const bool lazy_decode = true;  // TODO: config param
 
                     // TODO: get frame length for compressed audio as well
-                    m_ti[m_numtracks].len_decoded_buffer = 44100 * (16 / 8) * 2 * seconds;
                     strcpy(m_ti[m_numtracks].filepath, filepath);
-                    file_len = m_ti[m_numtracks].len_decoded_buffer / PCSX::CDRom::CD_FRAMESIZE_RAW;
-
-                    // Send to decoder if not lazy decoding
-                    if (!lazy_decode) {
-                        PCSX::g_system->printf("\n");
-                        file_len = do_decode_cdda(&(m_ti[m_numtracks]), m_numtracks) / PCSX::CDRom::CD_FRAMESIZE_RAW;
-                    }
+                    file_len = 44100 * (16 / 8) * 2 * seconds / PCSX::CDRom::CD_FRAMESIZE_RAW;
                 }
             } else if (sscanf(linebuf, " TRACK %u MODE%u/%u", &t, &mode, &sector_size) == 3) {
                 int32_t accurate_len;
@@ -1213,7 +982,6 @@ int PCSX::CDRiso::handlepbp(const char *isofile) {
     if (m_compr_img == NULL) goto fail_io;
 
     m_compr_img->block_shift = 4;
-    m_compr_img->current_block = (unsigned int)-1;
 
     m_compr_img->index_len = (0x100000 - 0x4000) / sizeof(index_entry);
     m_compr_img->index_table =
@@ -1289,7 +1057,6 @@ int PCSX::CDRiso::handlecbin(const char *isofile) {
     if (m_compr_img == NULL) goto fail_io;
 
     m_compr_img->block_shift = 0;
-    m_compr_img->current_block = (unsigned int)-1;
 
     m_compr_img->index_len = ciso_hdr.total_bytes / ciso_hdr.block_size;
     m_compr_img->index_table =
@@ -1326,6 +1093,35 @@ fail_io:
     return -1;
 }
 
+int PCSX::CDRiso::handlechd(const char *isofile) {
+    const char *ext = NULL;
+
+    if (strlen(isofile) >= 4) ext = isofile + strlen(isofile) - 4;
+    if (ext == NULL || strcasecmp(ext, ".chd") != 0) return -1;
+
+    // the cdzl and cdlz codecs strip the ECC of the mode 1 sectors
+    if (!m_chd.open(m_cdHandle, [this](uint8_t *sector) {
+            m_eccedc.ecc_writesector(sector + 0xC, sector + 0x10, sector + 0x81C);
+        })) {
+        return -1;
+    }
+
+    m_numtracks = 0;
+    for (auto &track : m_chd.tracks()) {
+        if (m_numtracks + 1 >= MAXTRACKS) break;
+        trackinfo &ti = m_ti[++m_numtracks];
+        ti.type = track.type == CHD::Track::AUDIO ? trackinfo::CDDA : trackinfo::DATA;
+        sec2msf(track.lba + 2 * 75, ti.start);
+        sec2msf(track.frames - track.pregapStored, ti.length);
+        // cdread_chd maps blocks to frames itself, so the offset is just the track's position
+        ti.start_offset = track.lba * PCSX::CDRom::CD_FRAMESIZE_RAW;
+        if (track.subType != CHD::Track::SUB_NONE) m_subChanMixed = true;
+    }
+    m_cddaBigEndian = true;  // chdman stores audio samples big-endian
+
+    return 0;
+}
+
 // this function tries to get the .sub file of the given .img
 int PCSX::CDRiso::opensubfile(const char *isoname) {
     char subname[MAXPATHLEN];
@@ -1363,27 +1159,27 @@ int PCSX::CDRiso::LoadSBI(const char *filename) {
     char buffer[16], sbifile[MAXPATHLEN];
 
     if (filename == NULL) {
-        if (PCSX::g_emulator.m_cdromId[0] == '\0') return -1;
+        if (PCSX::g_emulator->m_cdromId[0] == '\0') return -1;
 
         // Generate filename in the format of SLUS_123.45.sbi
-        buffer[0] = toupper(PCSX::g_emulator.m_cdromId[0]);
-        buffer[1] = toupper(PCSX::g_emulator.m_cdromId[1]);
-        buffer[2] = toupper(PCSX::g_emulator.m_cdromId[2]);
-        buffer[3] = toupper(PCSX::g_emulator.m_cdromId[3]);
+        buffer[0] = toupper(PCSX::g_emulator->m_cdromId[0]);
+        buffer[1] = toupper(PCSX::g_emulator->m_cdromId[1]);
+        buffer[2] = toupper(PCSX::g_emulator->m_cdromId[2]);
+        buffer[3] = toupper(PCSX::g_emulator->m_cdromId[3]);
         buffer[4] = '_';
-        buffer[5] = PCSX::g_emulator.m_cdromId[4];
-        buffer[6] = PCSX::g_emulator.m_cdromId[5];
-        buffer[7] = PCSX::g_emulator.m_cdromId[6];
+        buffer[5] = PCSX::g_emulator->m_cdromId[4];
+        buffer[6] = PCSX::g_emulator->m_cdromId[5];
+        buffer[7] = PCSX::g_emulator->m_cdromId[6];
         buffer[8] = '.';
-        buffer[9] = PCSX::g_emulator.m_cdromId[7];
-        buffer[10] = PCSX::g_emulator.m_cdromId[8];
+        buffer[9] = PCSX::g_emulator->m_cdromId[7];
+        buffer[10] = PCSX::g_emulator->m_cdromId[8];
         buffer[11] = '.';
         buffer[12] = 's';
         buffer[13] = 'b';
         buffer[14] = 'i';
         buffer[15] = '\0';
 
-        sprintf(sbifile, "%s%s", PCSX::g_emulator.settings.get<Emulator::SettingPpfDir>().c_str(), buffer);
+        sprintf(sbifile, "%s%s", PCSX::g_emulator->settings.get<Emulator::SettingPpfDir>().c_str(), buffer);
         filename = sbifile;
     }
 
@@ -1444,27 +1240,24 @@ ssize_t PCSX::CDRiso::cdread_sub_mixed(File *f, unsigned int base, void *dest, i
 
     f->seek(base + sector * (PCSX::CDRom::CD_FRAMESIZE_RAW + PCSX::CDRom::SUB_FRAMESIZE), SEEK_SET);
     ret = f->read(dest, PCSX::CDRom::CD_FRAMESIZE_RAW);
-    f->read(m_subbuffer, PCSX::CDRom::SUB_FRAMESIZE);
+    f->read(m_readSub, PCSX::CDRom::SUB_FRAMESIZE);
 
     if (m_subChanRaw) DecodeRawSubData();
 
     return ret;
 }
 
+// raw deflate stream; the block cache inflates from several threads, so each call gets its own z_stream
 static int uncompress2_internal(void *out, unsigned long *out_size, void *in, unsigned long in_size) {
-    static z_stream z;
+    z_stream z;
     int ret = 0;
 
-    if (z.zalloc == NULL) {
-        // XXX: one-time leak here..
-        z.next_in = Z_NULL;
-        z.avail_in = 0;
-        z.zalloc = Z_NULL;
-        z.zfree = Z_NULL;
-        z.opaque = Z_NULL;
-        ret = inflateInit2(&z, -15);
-    } else
-        ret = inflateReset(&z);
+    z.next_in = Z_NULL;
+    z.avail_in = 0;
+    z.zalloc = Z_NULL;
+    z.zfree = Z_NULL;
+    z.opaque = Z_NULL;
+    ret = inflateInit2(&z, -15);
     if (ret != Z_OK) return ret;
 
     z.next_in = reinterpret_cast<Bytef *>(in);
@@ -1473,72 +1266,122 @@ static int uncompress2_internal(void *out, unsigned long *out_size, void *in, un
     z.avail_out = *out_size;
 
     ret = inflate(&z, Z_NO_FLUSH);
-    // inflateEnd(&z);
+    inflateEnd(&z);
 
     *out_size -= z.avail_out;
     return ret == 1 ? 0 : ret;
 }
 
 ssize_t PCSX::CDRiso::cdread_compressed(File *f, unsigned int base, void *dest, int sector) {
-    unsigned long cdbuffer_size, cdbuffer_size_expect;
-    unsigned int start_byte, size;
-    int is_compressed;
-    int ret, block;
-
     if (base) sector += base / 2352;
 
-    block = sector >> m_compr_img->block_shift;
-    m_compr_img->sector_in_blk = sector & ((1 << m_compr_img->block_shift) - 1);
-
-    if (block == m_compr_img->current_block) {
-        // printf("hit sect %d\n", sector);
-        goto finish;
-    }
-
-    if (sector >= m_compr_img->index_len * 16) {
+    if ((sector >> m_compr_img->block_shift) >= m_compr_img->index_len) {
         PCSX::g_system->printf("sector %d is past img end\n", sector);
         return -1;
     }
 
-    start_byte = m_compr_img->index_table[block] & 0x7fffffff;
-    if (m_cdHandle->seek(start_byte, SEEK_SET) != 0) {
-        PCSX::g_system->printf("seek error for block %d at %x: ", block, start_byte);
-        perror(NULL);
-        return -1;
-    }
+    const uint8_t *block = m_comprCache.get(sector >> m_compr_img->block_shift);
+    if (block == NULL) return -1;
+
+    unsigned sectorInBlock = sector & ((1 << m_compr_img->block_shift) - 1);
+    memcpy(dest, block + sectorInBlock * PCSX::CDRom::CD_FRAMESIZE_RAW, PCSX::CDRom::CD_FRAMESIZE_RAW);
+    return PCSX::CDRom::CD_FRAMESIZE_RAW;
+}
+
+// block cache loader: reads one block out of the image, and inflates it if needed
+bool PCSX::CDRiso::inflateBlock(unsigned block, uint8_t *dest) {
+    unsigned long cdbuffer_size, cdbuffer_size_expect;
+    unsigned int start_byte, size;
+    int is_compressed;
+    int ret;
 
     is_compressed = !(m_compr_img->index_table[block] & 0x80000000);
+    start_byte = m_compr_img->index_table[block] & 0x7fffffff;
     size = (m_compr_img->index_table[block + 1] & 0x7fffffff) - start_byte;
-    if (size > sizeof(m_compr_img->buff_compressed)) {
+    cdbuffer_size_expect = PCSX::CDRom::CD_FRAMESIZE_RAW << m_compr_img->block_shift;
+    if (size > cdbuffer_size_expect + 100) {
         PCSX::g_system->printf("block %d is too large: %u\n", block, size);
-        return -1;
+        return false;
     }
 
-    if (m_cdHandle->read(is_compressed ? m_compr_img->buff_compressed : m_compr_img->buff_raw[0], size) != size) {
-        PCSX::g_system->printf("read error for block %d at %x: ", block, start_byte);
-        perror(NULL);
-        return -1;
+    std::vector<uint8_t> compressed(is_compressed ? size : 0);
+    {
+        std::lock_guard<std::mutex> lock(m_comprMutex);
+        if (m_cdHandle->seek(start_byte, SEEK_SET) != 0) {
+            PCSX::g_system->printf("seek error for block %d at %x: ", block, start_byte);
+            perror(NULL);
+            return false;
+        }
+        if (m_cdHandle->read(is_compressed ? compressed.data() : dest, size) != size) {
+            PCSX::g_system->printf("read error for block %d at %x: ", block, start_byte);
+            perror(NULL);
+            return false;
+        }
     }
 
     if (is_compressed) {
-        cdbuffer_size_expect = sizeof(m_compr_img->buff_raw[0]) << m_compr_img->block_shift;
         cdbuffer_size = cdbuffer_size_expect;
-        ret = uncompress2_internal(m_compr_img->buff_raw[0], &cdbuffer_size, m_compr_img->buff_compressed, size);
+        ret = uncompress2_internal(dest, &cdbuffer_size, compressed.data(), size);
         if (ret != 0) {
-            PCSX::g_system->printf("uncompress failed with %d for block %d, sector %d\n", ret, block, sector);
-            return -1;
+            PCSX::g_system->printf("uncompress failed with %d for block %d\n", ret, block);
+            return false;
         }
         if (cdbuffer_size != cdbuffer_size_expect)
-            PCSX::g_system->printf("cdbuffer_size: %lu != %lu, sector %d\n", cdbuffer_size, cdbuffer_size_expect,
-                                      sector);
+            PCSX::g_system->printf("cdbuffer_size: %lu != %lu, block %d\n", cdbuffer_size, cdbuffer_size_expect,
+                                   block);
+    }
+
+    return true;
+}
+
+// CHD images hold 2448 bytes frames, with the subchannel data after the sector; cooked tracks only have the
+// user data at the start of the frame, which gets the same fake header as cdread_2048
+ssize_t PCSX::CDRiso::cdread_chd(File *f, unsigned int base, void *dest, int sector) {
+    const CHD::Track *track;
+    int lba = sector + base / PCSX::CDRom::CD_FRAMESIZE_RAW;
+    int frame = m_chd.frameForLba(lba, &track);
+    uint8_t *out = (uint8_t *)dest;
+
+    if (frame < 0) {
+        if (track == NULL) {
+            PCSX::g_system->printf("sector %d is past img end\n", lba);
+            return -1;
+        }
+        // a gap the image doesn't store
+        memset(out, 0, PCSX::CDRom::CD_FRAMESIZE_RAW);
+        memset(m_readSub, 0, PCSX::CDRom::SUB_FRAMESIZE);
+        return PCSX::CDRom::CD_FRAMESIZE_RAW;
     }
 
-    // done at last!
-    m_compr_img->current_block = block;
+    const unsigned framesPerHunk = m_chd.hunkBytes() / CHD::FRAME_SIZE;
+    const uint8_t *hunk = m_comprCache.get(frame / framesPerHunk);
+    if (hunk == NULL) return -1;
+    const uint8_t *data = hunk + (frame % framesPerHunk) * CHD::FRAME_SIZE;
+
+    if (track->dataSize == PCSX::CDRom::CD_FRAMESIZE_RAW) {
+        memcpy(out, data, PCSX::CDRom::CD_FRAMESIZE_RAW);
+    } else {
+        static const uint8_t sync[12] = {0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00};
+        uint8_t msf[3];
+        memset(out, 0, PCSX::CDRom::CD_FRAMESIZE_RAW);
+        memcpy(out, sync, sizeof(sync));
+        sec2msf(lba + 2 * 75, msf);
+        out[12] = PCSX::CDRom::itob(msf[0]);
+        out[13] = PCSX::CDRom::itob(msf[1]);
+        out[14] = PCSX::CDRom::itob(msf[2]);
+        out[15] = track->type == CHD::Track::MODE1 ? 1 : 2;
+        if (track->type == CHD::Track::MODE2_FORM2) out[18] = out[22] = 0x20;
+        // 2336 bytes tracks carry the mode 2 subheader themselves
+        memcpy(out + (track->dataSize == 2336 ? 16 : 24), data, track->dataSize);
+    }
+
+    if (track->subType == CHD::Track::SUB_NONE) {
+        memset(m_readSub, 0, PCSX::CDRom::SUB_FRAMESIZE);
+    } else {
+        memcpy(m_readSub, data + CHD::SECTOR_SIZE, PCSX::CDRom::SUB_FRAMESIZE);
+        if (track->subType == CHD::Track::SUB_RAW) DecodeRawSubData();
+    }
 
-finish:
-    if (dest != m_cdbuffer)  // copy avoid HACK
-        memcpy(dest, m_compr_img->buff_raw[m_compr_img->sector_in_blk], PCSX::CDRom::CD_FRAMESIZE_RAW);
     return PCSX::CDRom::CD_FRAMESIZE_RAW;
 }
 
@@ -1549,9 +1392,10 @@ ssize_t PCSX::CDRiso::cdread_2048(File *f, unsigned int base, void *dest, int se
     ret = f->read((char *)dest + 12 * 2, 2048);
 
     // not really necessary, fake mode 2 header
-    memset(m_cdbuffer, 0, 12 * 2);
-    sec2msf(sector + 2 * 75, (uint8_t *)&m_cdbuffer[12]);
-    m_cdbuffer[12 + 3] = 1;
+    uint8_t *header = (uint8_t *)dest;
+    memset(header, 0, 12 * 2);
+    sec2msf(sector + 2 * 75, &header[12]);
+    header[12 + 3] = 1;
 
     return ret;
 }
@@ -1632,7 +1476,8 @@ ssize_t PCSX::CDRiso::cdread_ecm_decode(File *f, unsigned int base, void *dest,
         }
         num++;
         while (num) {
-            if (!processsectors && sectorcount >= (sector - 1)) {  // ensure that we read the sector we are supposed to
+            // ensure that we read the sector we are supposed to
+            if (!processsectors && sectorcount + 1 >= uint32_t(sector)) {
                 processsectors = true;
                 // printf("Saving at %i\n", sectorcount);
             } else if (processsectors && sectorcount > sector) {
@@ -1717,7 +1562,8 @@ ssize_t PCSX::CDRiso::cdread_ecm_decode(File *f, unsigned int base, void *dest,
             sectorcount = ((writebytecount / PCSX::CDRom::CD_FRAMESIZE_RAW) - 0);
             num -= b;
         }
-        if (type && sectorcount > 0 && m_ecm_savetable[sectorcount].filepos <= ECM_HEADER_SIZE) {
+        // only record boundaries can be resumed from; a multi sector record may have been left halfway
+        if (type && num == 0 && sectorcount > 0 && m_ecm_savetable[sectorcount].filepos <= ECM_HEADER_SIZE) {
             m_ecm_savetable[sectorcount].filepos = f->tell() /*-base*/;
             m_ecm_savetable[sectorcount].sector = sectorcount;
             // printf("Marked %i at pos %i\n", m_ecm_savetable[sectorcount].sector,
@@ -1748,6 +1594,119 @@ error_out:
     return -1;
 }
 
+namespace {
+
+struct EcmIndexHeader {
+    char magic[8];
+    uint64_t key[3];
+    uint32_t sectors;
+    uint32_t count;
+};
+
+const char s_ecmIndexMagic[8] = {'P', 'C', 'S', 'X', 'E', 'C', 'M', '1'};
+
+// in the emulator's own cache directory, next to its configuration, and named after the key of the
+// image; the directory the image is in may be read only, and isn't ours to write to anyway
+std::filesystem::path ecmIndexPath(const uint64_t key[3]) {
+    char name[64];
+    snprintf(name, sizeof(name), "%016llx%016llx%016llx.idx", (unsigned long long)key[0], (unsigned long long)key[1],
+             (unsigned long long)key[2]);
+    return std::filesystem::path("cache") / "ecm" / name;
+}
+
+}  // namespace
+
+// size and modification time of the image, and a hash of its first and last 64kB
+bool PCSX::CDRiso::ecmIndexKey(const char *isoname, File *cdh, uint64_t key[3]) {
+    struct stat st;
+    if (stat(isoname, &st) != 0) return false;
+    key[0] = st.st_size;
+    key[1] = st.st_mtime;
+
+    static const ssize_t HASHED = 64 * 1024;
+    uint8_t *buffer = (uint8_t *)malloc(HASHED);
+    if (buffer == NULL) return false;
+    uint64_t hash = 0xcbf29ce484222325ull;  // FNV-1a
+    ssize_t positions[2] = {0, std::max((ssize_t)st.st_size - HASHED, (ssize_t)0)};
+    for (ssize_t pos : positions) {
+        cdh->seek(pos, SEEK_SET);
+        ssize_t len = cdh->read(buffer, HASHED);
+        for (ssize_t i = 0; i < len; i++) hash = (hash ^ buffer[i]) * 0x100000001b3ull;
+    }
+    free(buffer);
+    key[2] = hash;
+    return true;
+}
+
+bool PCSX::CDRiso::loadEcmIndex(const char *isoname, File *cdh) {
+    EcmIndexHeader header;
+    uint64_t key[3];
+    bool ok = false;
+
+    if (!ecmIndexKey(isoname, cdh, key)) return false;
+    FILE *f = fopen(ecmIndexPath(key).string().c_str(), "rb");
+    if (f == NULL) return false;
+    if (fread(&header, sizeof(header), 1, f) != 1 || memcmp(header.magic, s_ecmIndexMagic, 8) != 0 ||
+        header.sectors == 0 || header.sectors > m_len_ecm_savetable || memcmp(header.key, key, sizeof(key)) != 0) {
+        goto done;
+    }
+
+    for (uint32_t i = 0; i < header.count; i++) {
+        ECMFILELUT entry;
+        if (fread(&entry, sizeof(entry), 1, f) != 1 || entry.sector < 0 || entry.sector >= header.sectors ||
+            entry.filepos < ECM_HEADER_SIZE || entry.filepos >= (int64_t)key[0]) {
+            // leave a clean table for the full scan to fill in
+            memset(m_ecm_savetable + 1, 0, (m_len_ecm_savetable - 1) * sizeof(ECMFILELUT));
+            goto done;
+        }
+        m_ecm_savetable[entry.sector] = entry;
+    }
+    m_len_ecm_savetable = header.sectors;
+    ok = true;
+
+done:
+    fclose(f);
+    return ok;
+}
+
+// only the first known entry of every ECM_INDEX_STRIDE sectors is kept; decoding goes forward from the
+// closest entry, and fills in the rest of the table as it goes
+void PCSX::CDRiso::saveEcmIndex(const char *isoname, File *cdh) {
+    EcmIndexHeader header;
+    std::vector<ECMFILELUT> entries;
+
+    if (!ecmIndexKey(isoname, cdh, header.key)) return;
+    memcpy(header.magic, s_ecmIndexMagic, 8);
+    header.sectors = m_len_ecm_savetable;
+    for (uint32_t bucket = 0; bucket < m_len_ecm_savetable; bucket += ECM_INDEX_STRIDE) {
+        uint32_t end = std::min(bucket + ECM_INDEX_STRIDE, m_len_ecm_savetable);
+        for (uint32_t i = std::max(bucket, 1u); i < end; i++) {
+            if (m_ecm_savetable[i].filepos < ECM_HEADER_SIZE) continue;
+            entries.push_back(m_ecm_savetable[i]);
+            break;
+        }
+    }
+    header.count = entries.size();
+
+    std::filesystem::path path = ecmIndexPath(header.key);
+    std::error_code ec;
+    std::filesystem::create_directories(path.parent_path(), ec);
+    FILE *f = fopen(path.string().c_str(), "wb");
+    if (f == NULL) {
+        PCSX::g_system->printf(_("Unable to save the ECM index to %s\n"), path.string().c_str());
+        return;
+    }
+    bool ok = fwrite(&header, sizeof(header), 1, f) == 1 &&
+              fwrite(entries.data(), sizeof(ECMFILELUT), entries.size(), f) == entries.size();
+    fclose(f);
+    if (ok) {
+        PCSX::g_system->printf(_("Saved the ECM index to %s\n"), path.string().c_str());
+    } else {
+        std::filesystem::remove(path, ec);
+        PCSX::g_system->printf(_("Unable to save the ECM index to %s\n"), path.string().c_str());
+    }
+}
+
 int PCSX::CDRiso::handleecm(const char *isoname, File *cdh, int32_t *accurate_length) {
     // Rewind to start and check ECM header and filename suffix validity
     cdh->seek(0, SEEK_SET);
@@ -1771,9 +1730,6 @@ int PCSX::CDRiso::handleecm(const char *isoname, File *cdh, int32_t *accurate_le
 
         PCSX::g_system->printf(_("\nDetected ECM file with proper header and filename suffix.\n"));
 
-        // Init ECC/EDC tables
-        eccedc_init();
-
         // Reserve maximum known sector ammount for LUT (80MIN CD)
         m_len_ecm_savetable = 75 * 80 * 60;  // 2*(accurate_length/PCSX::CDRomCD_FRAMESIZE_RAW);
 
@@ -1781,11 +1737,19 @@ int PCSX::CDRiso::handleecm(const char *isoname, File *cdh, int32_t *accurate_le
         m_ecm_savetable = (ECMFILELUT *)calloc(m_len_ecm_savetable, sizeof(ECMFILELUT));  // calloc returns nulled data
         m_ecm_savetable[0].filepos = ECM_HEADER_SIZE;
 
-        if (accurate_length || m_decoded_ecm_sectors) {
+        // decoding only ever touches small pieces of the image, which is way cheaper out of a mapping
+        cdh->map();
+
+        if (loadEcmIndex(isoname, cdh)) {
+            PCSX::g_system->printf(_("Loaded ECM index.\n"));
+            if (accurate_length) *accurate_length = m_len_ecm_savetable;
+        } else {
+            // walk the image once, and keep the result for the next time
             uint8_t tbuf1[PCSX::CDRom::CD_FRAMESIZE_RAW];
             m_len_ecm_savetable = 0;  // indicates to cdread_ecm_decode that no lut has been built yet
             cdread_ecm_decode(cdh, 0U, tbuf1, INT_MAX);  // builds LUT completely
             if (accurate_length) *accurate_length = m_len_ecm_savetable;
+            saveEcmIndex(isoname, cdh);
         }
 
         // Full image decoded? Needs fmemopen()
@@ -1944,13 +1908,10 @@ int PCSX::CDRiso::cdread_archive(FILE *f, unsigned int base, void *dest, int sec
 int PCSX::CDRiso::handlearchive(const char *isoname, int32_t *accurate_length) { return -1; }
 #endif
 
-uint8_t *PCSX::CDRiso::getBuffer() {
-    if (m_useCompressed) {
-        return m_compr_img->buff_raw[m_compr_img->sector_in_blk] + 12;
-    } else {
-        return m_cdbuffer + 12;
-    }
-}
+// the compressed reader's block buffer belongs to the prefetch worker, so readTrack either copies
+// out, or points into a mapped image; the latter is read only, which is fine since the cdrom copies
+// the sector into its transfer buffer before applying any PPF patch to it
+uint8_t *PCSX::CDRiso::getBuffer() { return const_cast<uint8_t *>(m_sector) + 12; }
 
 void PCSX::CDRiso::PrintTracks() {
     int i;
@@ -2008,6 +1969,10 @@ bool PCSX::CDRiso::open(void) {
         PCSX::g_system->printf("[cbin]");
         m_useCompressed = true;
         m_cdimg_read_func = &CDRiso::cdread_compressed;
+    } else if (handlechd(GetIsoFile()) == 0) {
+        PCSX::g_system->printf("[chd]");
+        m_useCompressed = true;
+        m_cdimg_read_func = &CDRiso::cdread_chd;
     } else if ((handleecm(GetIsoFile(), m_cdHandle, NULL) == 0)) {
         PCSX::g_system->printf("[+ecm]");
     } else if (handlearchive(GetIsoFile(), NULL) == 0) {
@@ -2020,7 +1985,7 @@ bool PCSX::CDRiso::open(void) {
         PCSX::g_system->printf("[+sbi]");
     }
 
-    if (!m_ecm_file_detected) {
+    if (!m_ecm_file_detected && !m_useCompressed) {
         // guess whether it is mode1/2048
         m_cdHandle->seek(0, SEEK_END);
         if (m_cdHandle->tell() % 2048 == 0) {
@@ -2061,12 +2026,61 @@ bool PCSX::CDRiso::open(void) {
         m_ti[1].handle = new File(GetIsoFile());
     }
 
+    // plain images get mapped in memory; raw sectors are then handed out in place, and the
+    // page cache does the read-ahead instead of the prefetch worker
+    if (!m_useCompressed && !m_ecm_file_detected && m_cdHandle->map()) {
+        PCSX::g_system->printf(_("CD image mapped in memory.\n"));
+        m_zeroCopy = m_cdimg_read_func == &CDRiso::cdread_normal || m_cdimg_read_func == &CDRiso::cdread_sub_mixed;
+        if (m_ti[1].handle) m_ti[1].handle->map();
+    }
+
+    if (m_useCompressed) {
+        // the cache size is in MB; the read-ahead is the next 64 sectors, however they're blocked
+        CDRBlockCache::Loader loader;
+        size_t blockSize;
+        unsigned blockCount, sectorsPerBlock;
+        if (m_chd.isOpen()) {
+            loader = [this](unsigned hunk, uint8_t *dest) { return m_chd.readHunk(hunk, dest); };
+            blockSize = m_chd.hunkBytes();
+            blockCount = m_chd.hunkCount();
+            sectorsPerBlock = blockSize / CHD::FRAME_SIZE;
+        } else {
+            loader = [this](unsigned block, uint8_t *dest) { return inflateBlock(block, dest); };
+            blockSize = PCSX::CDRom::CD_FRAMESIZE_RAW << m_compr_img->block_shift;
+            blockCount = m_compr_img->index_len;
+            sectorsPerBlock = 1 << m_compr_img->block_shift;
+        }
+        const unsigned capacity = (PCSX::g_emulator->settings.get<Emulator::SettingCDCache>() << 20) / blockSize;
+        const unsigned readAhead = std::max(64u / sectorsPerBlock, 1u);
+        m_comprCache.start(loader, blockSize, blockCount, capacity, readAhead, 2);
+    }
+
+    if (!m_zeroCopy) {
+        m_prefetch.start([this](int sector, uint8_t *data, uint8_t *sub) { return readSector(sector, data, sub); });
+    }
+
     return true;
 }
 
 void PCSX::CDRiso::close() {
     int i;
 
+    auto stats = m_prefetch.stats();
+    if (stats.hits || stats.misses) {
+        PCSX::g_system->printf(_("CD read-ahead: %llu hits, %llu misses.\n"), (unsigned long long)stats.hits,
+                               (unsigned long long)stats.misses);
+    }
+    m_prefetch.stop();
+
+    auto cacheStats = m_comprCache.stats();
+    if (cacheStats.hits || cacheStats.misses) {
+        PCSX::g_system->printf(_("Compressed block cache: %llu hits, %llu misses.\n"),
+                               (unsigned long long)cacheStats.hits, (unsigned long long)cacheStats.misses);
+    }
+    m_comprCache.stop();
+    m_chd.close();
+    m_cddaStream.close();
+
     if (m_cdHandle != NULL) {
         m_cdHandle->close();
         delete m_cdHandle;
@@ -2090,9 +2104,6 @@ void PCSX::CDRiso::close() {
             m_ti[i].handle->close();
             delete m_ti[i].handle;
             m_ti[i].handle = NULL;
-            if (m_ti[i].decoded_buffer != NULL) {
-                free(m_ti[i].decoded_buffer);
-            }
             m_ti[i].cddatype = trackinfo::NONE;
         }
     }
@@ -2100,6 +2111,8 @@ void PCSX::CDRiso::close() {
     m_ti[1].type = trackinfo::CLOSED;
 
     memset(m_cdbuffer, 0, sizeof(m_cdbuffer));
+    m_sector = m_cdbuffer;
+    m_zeroCopy = false;
     m_useCompressed = false;
 }
 
@@ -2192,20 +2205,20 @@ void PCSX::CDRiso::DecodeRawSubData() {
     memset(subQData, 0, sizeof(subQData));
 
     for (i = 0; i < 8 * 12; i++) {
-        if (m_subbuffer[i] & (1 << 6)) {  // only subchannel Q is needed
+        if (m_readSub[i] & (1 << 6)) {  // only subchannel Q is needed
             subQData[i >> 3] |= (1 << (7 - (i & 7)));
         }
     }
 
-    memcpy(&m_subbuffer[12], subQData, 12);
+    memcpy(&m_readSub[12], subQData, 12);
 }
 
 // read track
 // time: byte 0 - minute; byte 1 - second; byte 2 - frame
 // uses bcd format
 bool PCSX::CDRiso::readTrack(uint8_t *time) {
+    Profiler::Scope profile(Profiler::CDROM);
     int sector = CDRom::MSF2SECT(CDRom::btoi(time[0]), CDRom::btoi(time[1]), CDRom::btoi(time[2]));
-    long ret;
 
     if (m_cdHandle == NULL) {
         return false;
@@ -2219,15 +2232,43 @@ bool PCSX::CDRiso::readTrack(uint8_t *time) {
         }
     }
 
-    ret = (*this.*m_cdimg_read_func)(m_cdHandle, 0, m_cdbuffer, sector);
-    if (ret < 0) return false;
+    if (!m_zeroCopy) {
+        m_sector = m_cdbuffer;
+        return m_prefetch.read(sector, m_cdbuffer, m_subbuffer);
+    }
+
+    std::lock_guard<std::mutex> lock(m_readMutex);
+    const ssize_t frameSize = PCSX::CDRom::CD_FRAMESIZE_RAW + (m_subChanMixed ? PCSX::CDRom::SUB_FRAMESIZE : 0);
+    // the whole frame, so that the mixed subchannel data is known to be in the mapping too
+    const uint8_t *data = m_cdHandle->peek(sector * frameSize, frameSize);
+    if (data == NULL) return false;
+    m_sector = data;
+
+    if (m_subChanMixed) {
+        memcpy(m_readSub, data + PCSX::CDRom::CD_FRAMESIZE_RAW, PCSX::CDRom::SUB_FRAMESIZE);
+    } else if (m_subHandle != NULL) {
+        m_subHandle->seek(sector * PCSX::CDRom::SUB_FRAMESIZE, SEEK_SET);
+        m_subHandle->read(m_readSub, PCSX::CDRom::SUB_FRAMESIZE);
+    }
+    if (m_subChanRaw) DecodeRawSubData();
+    memcpy(m_subbuffer, m_readSub, PCSX::CDRom::SUB_FRAMESIZE);
+
+    return true;
+}
+
+// loads a sector and its subchannel data out of the image; this is the prefetch worker's loader
+bool PCSX::CDRiso::readSector(int sector, uint8_t *data, uint8_t *sub) {
+    std::lock_guard<std::mutex> lock(m_readMutex);
+
+    if ((*this.*m_cdimg_read_func)(m_cdHandle, 0, data, sector) < 0) return false;
 
     if (m_subHandle != NULL) {
         m_subHandle->seek(sector * PCSX::CDRom::SUB_FRAMESIZE, SEEK_SET);
-        m_subHandle->read(m_subbuffer, PCSX::CDRom::SUB_FRAMESIZE);
+        m_subHandle->read(m_readSub, PCSX::CDRom::SUB_FRAMESIZE);
 
         if (m_subChanRaw) DecodeRawSubData();
     }
+    memcpy(sub, m_readSub, PCSX::CDRom::SUB_FRAMESIZE);
 
     return true;
 }
@@ -2274,6 +2315,7 @@ bool PCSX::CDRiso::getStatus(CdrStat *stat) {
 
 // read CDDA sector into buffer
 bool PCSX::CDRiso::readCDDA(unsigned char m, unsigned char s, unsigned char f, unsigned char *buffer) {
+    Profiler::Scope profile(Profiler::CDROM);
     unsigned char msf[3] = {m, s, f};
     unsigned int file, track, track_start = 0;
     int ret;
@@ -2288,7 +2330,7 @@ bool PCSX::CDRiso::readCDDA(unsigned char m, unsigned char s, unsigned char f, u
     }
 
     // data tracks play silent (or CDDA set to silent)
-    if (m_ti[track].type != trackinfo::CDDA || PCSX::g_emulator.settings.get<Emulator::SettingCDDA>() == PCSX::Emulator::CDDA_DISABLED) {
+    if (m_ti[track].type != trackinfo::CDDA || PCSX::g_emulator->settings.get<Emulator::SettingCDDA>() == PCSX::Emulator::CDDA_DISABLED) {
         memset(buffer, 0, PCSX::CDRom::CD_FRAMESIZE_RAW);
         return true;
     }
@@ -2300,18 +2342,23 @@ bool PCSX::CDRiso::readCDDA(unsigned char m, unsigned char s, unsigned char f, u
             if (m_ti[file].handle != NULL) break;
     }
 
-    /* Need to decode audio track first if compressed still (lazy) */
-    if (m_ti[file].cddatype > trackinfo::BIN) {
-        do_decode_cdda(&(m_ti[file]), file);
+    if (m_ti[file].cddatype == trackinfo::CCDDA) {
+        // compressed audio is decoded on the fly, a few seconds ahead of what's being played
+        int sector = m_ti[track].start_offset / PCSX::CDRom::CD_FRAMESIZE_RAW + m_cddaCurPos - track_start;
+        ret = m_cddaStream.open(m_ti[file].filepath) && m_cddaStream.read(sector, buffer)
+                  ? PCSX::CDRom::CD_FRAMESIZE_RAW
+                  : -1;
+    } else {
+        std::lock_guard<std::mutex> lock(m_readMutex);
+        ret = (*this.*m_cdimg_read_func)(m_ti[file].handle, m_ti[track].start_offset, buffer,
+                                         m_cddaCurPos - track_start);
     }
-
-    ret = (*this.*m_cdimg_read_func)(m_ti[file].handle, m_ti[track].start_offset, buffer, m_cddaCurPos - track_start);
     if (ret != PCSX::CDRom::CD_FRAMESIZE_RAW) {
         memset(buffer, 0, PCSX::CDRom::CD_FRAMESIZE_RAW);
         return false;
     }
 
-    if (PCSX::g_emulator.settings.get<Emulator::SettingCDDA>() == PCSX::Emulator::CDDA_ENABLED_BE || m_cddaBigEndian) {
+    if (PCSX::g_emulator->settings.get<Emulator::SettingCDDA>() == PCSX::Emulator::CDDA_ENABLED_BE || m_cddaBigEndian) {
         int i;
         unsigned char tmp;
 
@@ -22,6 +22,13 @@
 
 #include <stdio.h>
 
+#include <mutex>
+
+#include "core/cddastream.h"
+#include "core/cdprefetch.h"
+#include "core/cdrblockcache.h"
+#include "core/chd.h"
+#include "core/eccedc.h"
 #include "core/plugins.h"
 #include "core/psxemulator.h"
 
@@ -37,13 +44,24 @@ class File {
     ssize_t write(const void* dest, size_t size);
     int getc();
     bool failed();
+    // switches an opened file over to a read only memory mapping, so reads no longer go through
+    // the C library; the page cache is shared with every other mapping of the same file
+    bool map();
+    // pointer to size bytes at pos, for memory backed files only; NULL otherwise, or if out of range
+    const uint8_t* peek(ssize_t pos, ssize_t size);
 
   private:
     static const uint8_t m_internalBuffer;
+    static const ssize_t READAHEAD = 1024 * 1024;
+    void advise(ssize_t pos, ssize_t size);
     FILE* m_handle = NULL;
     ssize_t m_ptr = 0;
     ssize_t m_size = 0;
     const uint8_t* m_data = NULL;
+    bool m_mapped = false;
+    void* m_mapping = NULL;  // mapping object handle on Windows
+    ssize_t m_advisedStart = 0;
+    ssize_t m_advisedEnd = 0;
 };
 
 namespace PCSX {
@@ -67,6 +85,8 @@ class CDRiso {
     bool readCDDA(unsigned char m, unsigned char s, unsigned char f, unsigned char* buffer);
 
     bool isActive();
+    CDPrefetch::Stats getPrefetchStats() const { return m_prefetch.stats(); }
+    CDRBlockCache::Stats getBlockCacheStats() const { return m_comprCache.stats(); }
 
     unsigned m_cdrIsoMultidiskCount;
     unsigned m_cdrIsoMultidiskSelect;
@@ -90,28 +110,38 @@ class CDRiso {
     bool m_multifile = false;
     bool m_isMode1ISO = false;  // TODO: use sector size/mode info from CUE also?
 
+    // what readTrack returns to the emulation thread; m_sector is either m_cdbuffer, or for
+    // mapped raw images, the sector in place within the mapping
     uint8_t m_cdbuffer[2352];
     uint8_t m_subbuffer[96];
+    const uint8_t* m_sector = m_cdbuffer;
+    bool m_zeroCopy = false;
+
+    // the image readers below are used by both the emulation thread and the prefetch worker;
+    // m_readMutex guards them, their state, and m_readSub which they fill with subchannel data
+    std::mutex m_readMutex;
+    uint8_t m_readSub[96];
+    CDPrefetch m_prefetch;
 
     bool m_playing = false;
     bool m_cddaBigEndian = false;
     uint32_t m_cddaCurPos = 0;
+    CDDAStream m_cddaStream;  // the compressed audio track being played, if any
     /* Frame offset into CD image where pregap data would be found if it was there.
      * If a game seeks there we must *not* return subchannel data since it's
      * not in the CD image, so that cdrom code can fake subchannel data instead.
      * XXX: there could be multiple pregaps but PSX dumps only have one? */
     unsigned int m_pregapOffset;
 
-    // compressed image stuff
+    // compressed image stuff; the decompressed blocks live in m_comprCache
     struct compr_img_t {
-        unsigned char buff_raw[16][2352];
-        unsigned char buff_compressed[2352 * 16 + 100];
         unsigned int* index_table;
         unsigned int index_len;
         unsigned int block_shift;
-        unsigned int current_block;
-        unsigned int sector_in_blk;
     } * m_compr_img = NULL;
+    std::mutex m_comprMutex;  // the cache workers read m_cdHandle concurrently
+    CHD m_chd;                // MAME's CHD images go through the same cache, a hunk being a block
+    CDRBlockCache m_comprCache;
 
     read_func_t m_cdimg_read_func = NULL;
     read_func_t m_cdimg_read_func_archive = NULL;
@@ -139,13 +169,9 @@ class CDRiso {
     ECMFILELUT* m_ecm_savetable = NULL;
 
     static inline const size_t ECM_SECTOR_SIZE[4] = {1, 2352, 2336, 2336};
-    ////////////////////////////////////////////////////////////////////////////////
-    //
-    // LUTs used for computing ECC/EDC
-    //
-    uint8_t m_ecc_f_lut[256];
-    uint8_t m_ecc_b_lut[256];
-    uint32_t m_edc_lut[256];
+
+    // for putting back what ECM and CHD images stripped from the sectors
+    EccEdc m_eccedc;
 
     static inline const uint8_t ZEROADDRESS[4] = {0, 0, 0, 0};
 
@@ -155,8 +181,6 @@ class CDRiso {
         uint8_t length[3] = { 0, 0, 0 };                                   // MSF-format
         File* handle = nullptr;                                            // for multi-track images CDDA
         enum cddatype_t { NONE = 0, BIN = 1, CCDDA = 2 } cddatype = NONE;  // BIN, WAV, MP3, APE
-        char* decoded_buffer = nullptr;
-        uint32_t len_decoded_buffer = 0;
         char filepath[256] = { 0 };
         uint32_t start_offset = 0;  // byte offset from start of above file
     };
@@ -171,11 +195,6 @@ class CDRiso {
 
     uint32_t get32lsb(const uint8_t* src);
     void put32lsb(uint8_t* dest, uint32_t value);
-    void eccedc_init();
-    uint32_t edc_compute(uint32_t edc, const uint8_t* src, size_t size);
-    void ecc_writepq(const uint8_t* address, const uint8_t* data, size_t major_count, size_t minor_count,
-                     size_t major_mult, size_t minor_inc, uint8_t* ecc);
-    void ecc_writesector(const uint8_t* address, const uint8_t* data, uint8_t* ecc);
     void reconstruct_sector(uint8_t* sector, int8_t type);
     // get a sector from a msf-array
     static unsigned int msf2sec(const uint8_t* msf) { return ((msf[0] * 60 + msf[1]) * 75) + msf[2]; }
@@ -189,20 +208,29 @@ class CDRiso {
     static void tok2msf(char* time, char* msf);
     trackinfo::cddatype_t get_cdda_type(const char* str);
     void DecodeRawSubData();
-    int do_decode_cdda(struct trackinfo* tri, uint32_t tracknumber);
     int parsetoc(const char* isofile);
     int parsecue(const char* isofile);
     int parseccd(const char* isofile);
     int parsemds(const char* isofile);
     int handlepbp(const char* isofile);
     int handlecbin(const char* isofile);
+    int handlechd(const char* isofile);
     int opensubfile(const char* isoname);
+    bool readSector(int sector, uint8_t* data, uint8_t* sub);
     ssize_t cdread_normal(File* f, unsigned int base, void* dest, int sector);
     ssize_t cdread_sub_mixed(File* f, unsigned int base, void* dest, int sector);
     ssize_t cdread_compressed(File* f, unsigned int base, void* dest, int sector);
+    bool inflateBlock(unsigned block, uint8_t* dest);
+    ssize_t cdread_chd(File* f, unsigned int base, void* dest, int sector);
     ssize_t cdread_2048(File* f, unsigned int base, void* dest, int sector);
     ssize_t cdread_ecm_decode(File* f, unsigned int base, void* dest, int sector);
     int handleecm(const char* isoname, File* cdh, int32_t* accurate_length);
+    // m_ecm_savetable is kept in the emulator's cache directory, one entry every ECM_INDEX_STRIDE sectors, so
+    // that later opens don't have to walk the whole image again; it's keyed by the image's size, time and a hash
+    static const unsigned ECM_INDEX_STRIDE = 64;
+    static bool ecmIndexKey(const char* isoname, File* cdh, uint64_t key[3]);
+    bool loadEcmIndex(const char* isoname, File* cdh);
+    void saveEcmIndex(const char* isoname, File* cdh);
     void PrintTracks();
     int aropen(FILE* fparchive, const char* _fn);
     int cdread_archive(FILE* f, unsigned int base, void* dest, int sector);
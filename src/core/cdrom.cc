@@ -186,9 +186,9 @@ class CDRomImpl : public PCSX::CDRom {
     };
 
 // 1x = 75 sectors per second
-// PCSX::g_emulator.m_psxClockSpeed = 1 sec in the ps
-// so (PCSX::g_emulator.m_psxClockSpeed / 75) = m_cdr read time (linuzappz)
-#define cdReadTime (PCSX::g_emulator.m_psxClockSpeed / 75)
+// PCSX::g_emulator->m_psxClockSpeed = 1 sec in the ps
+// so (PCSX::g_emulator->m_psxClockSpeed / 75) = m_cdr read time (linuzappz)
+#define cdReadTime (PCSX::g_emulator->m_psxClockSpeed / 75)
 
     enum drive_state {
         DRIVESTATE_STANDBY = 0,
@@ -225,60 +225,60 @@ class CDRomImpl : public PCSX::CDRom {
 
     // interrupt
     inline void CDR_INT(uint32_t eCycle) {
-        PCSX::g_emulator.m_psxCpu->m_psxRegs.interrupt |= (1 << PCSX::PSXINT_CDR);
-        PCSX::g_emulator.m_psxCpu->m_psxRegs.intCycle[PCSX::PSXINT_CDR].cycle = eCycle;
-        PCSX::g_emulator.m_psxCpu->m_psxRegs.intCycle[PCSX::PSXINT_CDR].sCycle =
-            PCSX::g_emulator.m_psxCpu->m_psxRegs.cycle;
+        PCSX::g_emulator->m_psxCpu->m_psxRegs.interrupt |= (1 << PCSX::PSXINT_CDR);
+        PCSX::g_emulator->m_psxCpu->m_psxRegs.intCycle[PCSX::PSXINT_CDR].cycle = eCycle;
+        PCSX::g_emulator->m_psxCpu->m_psxRegs.intCycle[PCSX::PSXINT_CDR].sCycle =
+            PCSX::g_emulator->m_psxCpu->m_psxRegs.cycle;
     }
 
     // readInterrupt
     inline void CDREAD_INT(uint32_t eCycle) {
-        PCSX::g_emulator.m_psxCpu->m_psxRegs.interrupt |= (1 << PCSX::PSXINT_CDREAD);
-        PCSX::g_emulator.m_psxCpu->m_psxRegs.intCycle[PCSX::PSXINT_CDREAD].cycle = eCycle;
-        PCSX::g_emulator.m_psxCpu->m_psxRegs.intCycle[PCSX::PSXINT_CDREAD].sCycle =
-            PCSX::g_emulator.m_psxCpu->m_psxRegs.cycle;
+        PCSX::g_emulator->m_psxCpu->m_psxRegs.interrupt |= (1 << PCSX::PSXINT_CDREAD);
+        PCSX::g_emulator->m_psxCpu->m_psxRegs.intCycle[PCSX::PSXINT_CDREAD].cycle = eCycle;
+        PCSX::g_emulator->m_psxCpu->m_psxRegs.intCycle[PCSX::PSXINT_CDREAD].sCycle =
+            PCSX::g_emulator->m_psxCpu->m_psxRegs.cycle;
     }
 
     // decodedBufferInterrupt
     inline void CDRDBUF_INT(uint32_t eCycle) {
-        PCSX::g_emulator.m_psxCpu->m_psxRegs.interrupt |= (1 << PCSX::PSXINT_CDRDBUF);
-        PCSX::g_emulator.m_psxCpu->m_psxRegs.intCycle[PCSX::PSXINT_CDRDBUF].cycle = eCycle;
-        PCSX::g_emulator.m_psxCpu->m_psxRegs.intCycle[PCSX::PSXINT_CDRDBUF].sCycle =
-            PCSX::g_emulator.m_psxCpu->m_psxRegs.cycle;
+        PCSX::g_emulator->m_psxCpu->m_psxRegs.interrupt |= (1 << PCSX::PSXINT_CDRDBUF);
+        PCSX::g_emulator->m_psxCpu->m_psxRegs.intCycle[PCSX::PSXINT_CDRDBUF].cycle = eCycle;
+        PCSX::g_emulator->m_psxCpu->m_psxRegs.intCycle[PCSX::PSXINT_CDRDBUF].sCycle =
+            PCSX::g_emulator->m_psxCpu->m_psxRegs.cycle;
     }
 
     // lidSeekInterrupt
     inline void CDRLID_INT(uint32_t eCycle) {
-        PCSX::g_emulator.m_psxCpu->m_psxRegs.interrupt |= (1 << PCSX::PSXINT_CDRLID);
-        PCSX::g_emulator.m_psxCpu->m_psxRegs.intCycle[PCSX::PSXINT_CDRLID].cycle = eCycle;
-        PCSX::g_emulator.m_psxCpu->m_psxRegs.intCycle[PCSX::PSXINT_CDRLID].sCycle =
-            PCSX::g_emulator.m_psxCpu->m_psxRegs.cycle;
+        PCSX::g_emulator->m_psxCpu->m_psxRegs.interrupt |= (1 << PCSX::PSXINT_CDRLID);
+        PCSX::g_emulator->m_psxCpu->m_psxRegs.intCycle[PCSX::PSXINT_CDRLID].cycle = eCycle;
+        PCSX::g_emulator->m_psxCpu->m_psxRegs.intCycle[PCSX::PSXINT_CDRLID].sCycle =
+            PCSX::g_emulator->m_psxCpu->m_psxRegs.cycle;
     }
 
     // playInterrupt
     inline void CDRMISC_INT(uint32_t eCycle) {
-        PCSX::g_emulator.m_psxCpu->m_psxRegs.interrupt |= (1 << PCSX::PSXINT_CDRPLAY);
-        PCSX::g_emulator.m_psxCpu->m_psxRegs.intCycle[PCSX::PSXINT_CDRPLAY].cycle = eCycle;
-        PCSX::g_emulator.m_psxCpu->m_psxRegs.intCycle[PCSX::PSXINT_CDRPLAY].sCycle =
-            PCSX::g_emulator.m_psxCpu->m_psxRegs.cycle;
+        PCSX::g_emulator->m_psxCpu->m_psxRegs.interrupt |= (1 << PCSX::PSXINT_CDRPLAY);
+        PCSX::g_emulator->m_psxCpu->m_psxRegs.intCycle[PCSX::PSXINT_CDRPLAY].cycle = eCycle;
+        PCSX::g_emulator->m_psxCpu->m_psxRegs.intCycle[PCSX::PSXINT_CDRPLAY].sCycle =
+            PCSX::g_emulator->m_psxCpu->m_psxRegs.cycle;
     }
 
     inline void StopReading() {
         if (m_Reading) {
             m_Reading = 0;
-            PCSX::g_emulator.m_psxCpu->m_psxRegs.interrupt &= ~(1 << PCSX::PSXINT_CDREAD);
+            PCSX::g_emulator->m_psxCpu->m_psxRegs.interrupt &= ~(1 << PCSX::PSXINT_CDREAD);
         }
         m_StatP &= ~(STATUS_READ | STATUS_SEEK);
     }
 
     inline void StopCdda() {
         if (m_Play) {
-            if (PCSX::g_emulator.settings.get<PCSX::Emulator::SettingCDDA>() != PCSX::Emulator::CDDA_DISABLED) m_iso.stop();
+            if (PCSX::g_emulator->settings.get<PCSX::Emulator::SettingCDDA>() != PCSX::Emulator::CDDA_DISABLED) m_iso.stop();
             m_StatP &= ~STATUS_PLAY;
             m_Play = false;
             m_FastForward = 0;
             m_FastBackward = 0;
-            PCSX::g_emulator.m_spu->registerCallback(SPUirq);
+            PCSX::g_emulator->m_spu->registerCallback(SPUirq);
         }
     }
 
@@ -319,11 +319,11 @@ class CDRomImpl : public PCSX::CDRom {
 
         // check dbuf IRQ still active
         if (m_Play == 0) return;
-        if ((PCSX::g_emulator.m_spu->readRegister(H_SPUctrl) & 0x40) == 0) return;
-        if ((PCSX::g_emulator.m_spu->readRegister(H_SPUirqAddr) * 8) >= 0x800) return;
+        if ((PCSX::g_emulator->m_spu->readRegister(H_SPUctrl) & 0x40) == 0) return;
+        if ((PCSX::g_emulator->m_spu->readRegister(H_SPUirqAddr) * 8) >= 0x800) return;
 
         // turn off plugin SPU IRQ decoded buffer handling
-        PCSX::g_emulator.m_spu->registerCallback(0);
+        PCSX::g_emulator->m_spu->registerCallback(0);
 
         /*
         Vib Ribbon
@@ -338,8 +338,8 @@ class CDRomImpl : public PCSX::CDRom {
         psxHu32ref(0x1070) |= SWAP_LE32((uint32_t)0x200);
 
         // time for next full buffer
-        // CDRDBUF_INT( PCSX::g_emulator.m_psxClockSpeed / 44100 * 0x200 );
-        CDRDBUF_INT(PCSX::g_emulator.m_psxClockSpeed / 44100 * 0x100);
+        // CDRDBUF_INT( PCSX::g_emulator->m_psxClockSpeed / 44100 * 0x200 );
+        CDRDBUF_INT(PCSX::g_emulator->m_psxClockSpeed / 44100 * 0x100);
     }
 
     // timing used in this function was taken from tests on real hardware
@@ -601,7 +601,7 @@ class CDRomImpl : public PCSX::CDRom {
             m_iso.readCDDA(m_SetSectorPlay[0], m_SetSectorPlay[1], m_SetSectorPlay[2], m_Transfer);
 
             attenuate((int16_t *)m_Transfer, CD_FRAMESIZE_RAW / 4, 1);
-            PCSX::g_emulator.m_spu->playCDDAchannel((short *)m_Transfer, CD_FRAMESIZE_RAW);
+            PCSX::g_emulator->m_spu->playCDDAchannel((short *)m_Transfer, CD_FRAMESIZE_RAW);
         }
 
         m_SetSectorPlay[2]++;
@@ -642,7 +642,7 @@ class CDRomImpl : public PCSX::CDRom {
 
         if (m_IrqRepeated) {
             m_IrqRepeated = 0;
-            if (m_eCycle > PCSX::g_emulator.m_psxCpu->m_psxRegs.cycle) {
+            if (m_eCycle > PCSX::g_emulator->m_psxCpu->m_psxRegs.cycle) {
                 CDR_INT(m_eCycle);
                 goto finish;
             }
@@ -708,7 +708,7 @@ class CDRomImpl : public PCSX::CDRom {
                 ReadTrack(m_SetSectorPlay);
                 m_TrackChanged = false;
 
-                if (PCSX::g_emulator.settings.get<PCSX::Emulator::SettingCDDA>() != PCSX::Emulator::CDDA_DISABLED)
+                if (PCSX::g_emulator->settings.get<PCSX::Emulator::SettingCDDA>() != PCSX::Emulator::CDDA_DISABLED)
                     m_iso.play(m_SetSectorPlay);
 
                 // Vib Ribbon: gameplay checks flag
@@ -955,7 +955,7 @@ class CDRomImpl : public PCSX::CDRom {
                     m_Result[1] = 0xc0;
                 } else {
                     if (cdr_stat.Type == 2) m_Result[1] |= 0x10;
-                    if (PCSX::g_emulator.m_cdromId[0] == '\0') m_Result[1] |= 0x80;
+                    if (PCSX::g_emulator->m_cdromId[0] == '\0') m_Result[1] |= 0x80;
                 }
                 m_Result[0] |= (m_Result[1] >> 4) & 0x08;
 
@@ -1165,7 +1165,7 @@ class CDRomImpl : public PCSX::CDRom {
 
         CDR_LOG("readInterrupt() Log: cdr.m_Transfer %x:%x:%x\n", m_Transfer[0], m_Transfer[1], m_Transfer[2]);
 
-        if ((!m_Muted) && (m_Mode & MODE_STRSND) && (PCSX::g_emulator.settings.get<PCSX::Emulator::SettingXa>()) &&
+        if ((!m_Muted) && (m_Mode & MODE_STRSND) && (PCSX::g_emulator->settings.get<PCSX::Emulator::SettingXa>()) &&
             (m_FirstSector != -1)) {  // CD-XA
             // Firemen 2: Multi-XA files - briefings, cutscenes
             if (m_FirstSector == 1 && (m_Mode & MODE_SF) == 0) {
@@ -1177,7 +1177,7 @@ class CDRomImpl : public PCSX::CDRom {
                 int ret = xa_decode_sector(&m_Xa, m_Transfer + 4, m_FirstSector);
                 if (!ret) {
                     attenuate(m_Xa.pcm, m_Xa.nsamples, m_Xa.stereo);
-                    PCSX::g_emulator.m_spu->playADPCMchannel(&m_Xa);
+                    PCSX::g_emulator->m_spu->playADPCMchannel(&m_Xa);
                     m_FirstSector = 0;
                 } else
                     m_FirstSector = -1;
@@ -1463,7 +1463,7 @@ class CDRomImpl : public PCSX::CDRom {
                     m_transferIndex++;
                     adjustTransferIndex();
                 }
-                PCSX::g_emulator.m_psxCpu->Clear(madr, cdsize / 4);
+                PCSX::g_emulator->m_psxCpu->Clear(madr, cdsize / 4);
                 // burst vs normal
                 if (chcr == 0x11400100) {
                     CDRDMA_INT((cdsize / 4) / 4);
@@ -1579,7 +1579,7 @@ class CDRomImpl : public PCSX::CDRom {
     int freeze(gzFile f, int Mode) final {
         uint8_t tmpp[3];
 
-        if (Mode == 0 && PCSX::g_emulator.settings.get<PCSX::Emulator::SettingCDDA>() != PCSX::Emulator::CDDA_DISABLED)
+        if (Mode == 0 && PCSX::g_emulator->settings.get<PCSX::Emulator::SettingCDDA>() != PCSX::Emulator::CDDA_DISABLED)
             m_iso.stop();
 
         // gzfreeze(&m_cdr, sizeof(m_cdr));
@@ -1596,7 +1596,7 @@ class CDRomImpl : public PCSX::CDRom {
 
             if (m_Play) {
                 Find_CurTrack(m_SetSectorPlay);
-                if (PCSX::g_emulator.settings.get<PCSX::Emulator::SettingCDDA>() != PCSX::Emulator::CDDA_DISABLED)
+                if (PCSX::g_emulator->settings.get<PCSX::Emulator::SettingCDDA>() != PCSX::Emulator::CDDA_DISABLED)
                     m_iso.play(m_SetSectorPlay);
             }
         }
@@ -0,0 +1,741 @@
+/***************************************************************************
+ *   Copyright (C) 2019 PCSX-Redux authors                                 *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.           *
+ ***************************************************************************/
+
+#include "core/chd.h"
+
+#include <FLAC/stream_decoder.h>
+#include <lzma.h>
+#include <stdio.h>
+#include <string.h>
+#include <zlib.h>
+
+#include <algorithm>
+#include <array>
+#include <string>
+
+#include "core/cdriso.h"
+#include "core/system.h"
+
+namespace {
+
+constexpr uint32_t makeTag(char a, char b, char c, char d) {
+    return (uint32_t(uint8_t(a)) << 24) | (uint32_t(uint8_t(b)) << 16) | (uint32_t(uint8_t(c)) << 8) | uint8_t(d);
+}
+
+const uint32_t CODEC_ZLIB = makeTag('z', 'l', 'i', 'b');
+const uint32_t CODEC_LZMA = makeTag('l', 'z', 'm', 'a');
+const uint32_t CODEC_FLAC = makeTag('f', 'l', 'a', 'c');
+const uint32_t CODEC_CDZL = makeTag('c', 'd', 'z', 'l');
+const uint32_t CODEC_CDLZ = makeTag('c', 'd', 'l', 'z');
+const uint32_t CODEC_CDFL = makeTag('c', 'd', 'f', 'l');
+
+const uint32_t META_CHTR = makeTag('C', 'H', 'T', 'R');
+const uint32_t META_CHT2 = makeTag('C', 'H', 'T', '2');
+
+// hunk types of the v5 map; 0 to 3 pick one of the header's codecs
+enum {
+    COMPRESSION_NONE = 4,
+    COMPRESSION_SELF = 5,
+    COMPRESSION_PARENT = 6,
+    COMPRESSION_RLE_SMALL = 7,
+    COMPRESSION_RLE_LARGE = 8,
+    COMPRESSION_SELF_0 = 9,
+    COMPRESSION_SELF_1 = 10,
+    COMPRESSION_PARENT_SELF = 11,
+    COMPRESSION_PARENT_0 = 12,
+    COMPRESSION_PARENT_1 = 13,
+};
+
+const unsigned HEADER_SIZE = 124;
+const unsigned TRACK_PADDING = 4;  // chdman pads every track to a multiple of 4 frames
+
+const uint8_t SYNC[12] = {0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00};
+
+uint16_t get16be(const uint8_t *p) { return (p[0] << 8) | p[1]; }
+uint32_t get24be(const uint8_t *p) { return (p[0] << 16) | (p[1] << 8) | p[2]; }
+uint32_t get32be(const uint8_t *p) { return (uint32_t(p[0]) << 24) | get24be(p + 1); }
+uint64_t get48be(const uint8_t *p) { return (uint64_t(get16be(p)) << 32) | get32be(p + 2); }
+uint64_t get64be(const uint8_t *p) { return (uint64_t(get32be(p)) << 32) | get32be(p + 4); }
+
+void put16be(uint8_t *p, uint16_t v) {
+    p[0] = v >> 8;
+    p[1] = v;
+}
+
+void put24be(uint8_t *p, uint32_t v) {
+    p[0] = v >> 16;
+    put16be(p + 1, v);
+}
+
+void put48be(uint8_t *p, uint64_t v) {
+    put16be(p, v >> 32);
+    p[2] = v >> 24;
+    put24be(p + 3, v);
+}
+
+// CRC-16/CCITT, which the map and each hunk are checked against
+uint16_t crc16(const uint8_t *data, size_t size) {
+    static const auto table = [] {
+        std::array<uint16_t, 256> table;
+        for (unsigned i = 0; i < 256; i++) {
+            uint16_t crc = i << 8;
+            for (unsigned j = 0; j < 8; j++) crc = (crc & 0x8000) ? (crc << 1) ^ 0x1021 : crc << 1;
+            table[i] = crc;
+        }
+        return table;
+    }();
+    uint16_t crc = 0xffff;
+    while (size--) crc = (crc << 8) ^ table[(crc >> 8) ^ *data++];
+    return crc;
+}
+
+// most significant bit first, which is how the map packs its bits; reading past the end yields zeroes,
+// and sets the overflow flag
+class BitReader {
+  public:
+    BitReader(const uint8_t *data, size_t size) : m_data(data), m_size(size) {}
+    uint32_t peek(unsigned bits) const {
+        if (bits == 0) return 0;
+        uint64_t window = 0;
+        size_t byte = m_pos >> 3;
+        for (unsigned i = 0; i < 5; i++) {
+            window <<= 8;
+            if (byte + i < m_size) window |= m_data[byte + i];
+        }
+        window <<= m_pos & 7;
+        return (window >> (40 - bits)) & ((uint64_t(1) << bits) - 1);
+    }
+    void skip(unsigned bits) { m_pos += bits; }
+    uint32_t read(unsigned bits) {
+        uint32_t value = peek(bits);
+        skip(bits);
+        return value;
+    }
+    bool overflow() const { return m_pos > m_size * 8; }
+
+  private:
+    const uint8_t *m_data;
+    size_t m_size;
+    size_t m_pos = 0;
+};
+
+// the map's hunk types are huffman coded, with 16 codes of at most 8 bits, whose lengths are themselves
+// stored with a small run length scheme; codes are assigned canonically, longest ones first, as MAME does
+class HuffmanDecoder {
+  public:
+    bool importTreeRLE(BitReader &bits) {
+        unsigned code = 0;
+        while (code < CODES) {
+            unsigned length = bits.read(4);
+            if (length == 1) {
+                // a 1 escapes either a real 1, or a run of the length that follows
+                length = bits.read(4);
+                if (length != 1) {
+                    unsigned repeat = bits.read(4) + 3;
+                    if (code + repeat > CODES) return false;
+                    while (repeat--) m_lengths[code++] = length;
+                    continue;
+                }
+            }
+            m_lengths[code++] = length;
+        }
+
+        uint32_t histogram[MAXBITS + 1] = {0};
+        for (unsigned i = 0; i < CODES; i++) {
+            if (m_lengths[i] > MAXBITS) return false;
+            histogram[m_lengths[i]]++;
+        }
+        uint32_t start = 0;
+        for (unsigned length = MAXBITS; length > 0; length--) {
+            uint32_t next = (start + histogram[length]) >> 1;
+            if (length != 1 && next * 2 != start + histogram[length]) return false;
+            histogram[length] = start;
+            start = next;
+        }
+
+        memset(m_lookup, 0, sizeof(m_lookup));
+        for (unsigned i = 0; i < CODES; i++) {
+            unsigned length = m_lengths[i];
+            if (length == 0) continue;
+            unsigned shift = MAXBITS - length;
+            unsigned first = histogram[length]++ << shift;
+            unsigned last = std::min(first + (1u << shift), 1u << MAXBITS);
+            for (unsigned j = first; j < last; j++) m_lookup[j] = (i << 5) | length;
+        }
+        return !bits.overflow();
+    }
+    unsigned decode(BitReader &bits) const {
+        uint16_t entry = m_lookup[bits.peek(MAXBITS)];
+        bits.skip(entry & 0x1f);
+        return entry >> 5;
+    }
+
+  private:
+    static const unsigned CODES = 16;
+    static const unsigned MAXBITS = 8;
+    uint8_t m_lengths[CODES];
+    uint16_t m_lookup[1 << MAXBITS];
+};
+
+// raw deflate streams, for the zlib codec and the subchannel data of all the CD codecs
+bool inflateRaw(const uint8_t *src, size_t size, uint8_t *dest, size_t destSize) {
+    z_stream z;
+    memset(&z, 0, sizeof(z));
+    if (inflateInit2(&z, -MAX_WBITS) != Z_OK) return false;
+    z.next_in = const_cast<Bytef *>(src);
+    z.avail_in = size;
+    z.next_out = dest;
+    z.avail_out = destSize;
+    int ret = inflate(&z, Z_FINISH);
+    inflateEnd(&z);
+    return ret == Z_STREAM_END && z.total_out == destSize;
+}
+
+// headerless LZMA streams, for the lzma and cdlz codecs; MAME writes them with lc=3 lp=0 pb=2 and no end
+// marker, each holding exactly one hunk, so a dictionary the size of the output is all they can refer to
+bool lzmaDecode(const uint8_t *src, size_t size, uint8_t *dest, size_t destSize) {
+    lzma_options_lzma options;
+    if (lzma_lzma_preset(&options, 0)) return false;
+    options.dict_size = std::max<uint32_t>(destSize, LZMA_DICT_SIZE_MIN);
+    options.lc = 3;
+    options.lp = 0;
+    options.pb = 2;
+    const lzma_filter filters[] = {{LZMA_FILTER_LZMA1, &options}, {LZMA_VLI_UNKNOWN, nullptr}};
+
+    lzma_stream z = LZMA_STREAM_INIT;
+    if (lzma_raw_decoder(&z, filters) != LZMA_OK) return false;
+    z.next_in = src;
+    z.avail_in = size;
+    z.next_out = dest;
+    z.avail_out = destSize;
+    lzma_ret ret = lzma_code(&z, LZMA_RUN);
+    lzma_end(&z);
+    return (ret == LZMA_OK || ret == LZMA_STREAM_END) && z.total_out == destSize;
+}
+
+// bare FLAC frames, for the flac and cdfl codecs: 16 bits stereo at 44100Hz, without the stream header,
+// and followed by more data, hence the need to know where the frames end. libFLAC wants a stream, so it
+// gets fed the header MAME's encoder left out first, as MAME's own decoder does.
+class FlacDecoder {
+  public:
+    FlacDecoder() : m_decoder(FLAC__stream_decoder_new()) {}
+    ~FlacDecoder() {
+        if (m_decoder) FLAC__stream_decoder_delete(m_decoder);
+    }
+    FlacDecoder(const FlacDecoder &) = delete;
+    FlacDecoder &operator=(const FlacDecoder &) = delete;
+
+    // decodes that many stereo samples, and returns how many bytes the frames took, or 0 on error
+    size_t decode(const uint8_t *src, size_t size, uint8_t *dest, unsigned samples, bool bigEndian);
+
+  private:
+    static FLAC__StreamDecoderReadStatus read(const FLAC__StreamDecoder *, FLAC__byte buffer[], size_t *bytes,
+                                              void *data);
+    static FLAC__StreamDecoderTellStatus tell(const FLAC__StreamDecoder *, FLAC__uint64 *offset, void *data);
+    static FLAC__StreamDecoderWriteStatus write(const FLAC__StreamDecoder *, const FLAC__Frame *frame,
+                                                const FLAC__int32 *const buffer[], void *data);
+    static void error(const FLAC__StreamDecoder *, FLAC__StreamDecoderErrorStatus, void *data) {
+        static_cast<FlacDecoder *>(data)->m_error = true;
+    }
+
+    // chdman's choice, which is no more than 2048 samples per frame
+    static unsigned blockSize(unsigned samples) {
+        while (samples > 2048) samples /= 2;
+        return samples;
+    }
+
+    FLAC__StreamDecoder *m_decoder;
+    uint8_t m_header[0x2a];
+    const uint8_t *m_src = nullptr;
+    size_t m_size = 0;
+    size_t m_fed = 0;  // in the header, then the frames
+    uint8_t *m_dest = nullptr;
+    unsigned m_samples = 0;
+    unsigned m_done = 0;
+    bool m_bigEndian = false;
+    bool m_error = false;
+};
+
+size_t FlacDecoder::decode(const uint8_t *src, size_t size, uint8_t *dest, unsigned samples, bool bigEndian) {
+    if (!m_decoder) return 0;
+
+    // a lone STREAMINFO block: block sizes, unknown frame sizes, 44100Hz, 2 channels, 16 bits, unknown length
+    static const uint8_t streamInfo[sizeof(m_header)] = {
+        'f',  'L',  'a',  'C',  0x80, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+        0x00, 0x00, 0x00, 0x00, 0x0a, 0xc4, 0x42, 0xf0, 0x00, 0x00, 0x00, 0x00,
+    };
+    const unsigned block = blockSize(samples);
+    memcpy(m_header, streamInfo, sizeof(m_header));
+    m_header[0x08] = m_header[0x0a] = block >> 8;
+    m_header[0x09] = m_header[0x0b] = block;
+
+    m_src = src;
+    m_size = size;
+    m_fed = 0;
+    m_dest = dest;
+    m_samples = samples;
+    m_done = 0;
+    m_bigEndian = bigEndian;
+    m_error = false;
+    if (FLAC__stream_decoder_init_stream(m_decoder, read, nullptr, tell, nullptr, nullptr, write, nullptr, error,
+                                         this) != FLAC__STREAM_DECODER_INIT_STATUS_OK) {
+        return 0;
+    }
+
+    while (m_done < m_samples && !m_error) {
+        if (!FLAC__stream_decoder_process_single(m_decoder) ||
+            FLAC__stream_decoder_get_state(m_decoder) == FLAC__STREAM_DECODER_END_OF_STREAM) {
+            break;
+        }
+    }
+
+    // what libFLAC actually used, as opposed to what it read ahead
+    FLAC__uint64 position = 0;
+    bool ok = m_done == m_samples && !m_error && FLAC__stream_decoder_get_decode_position(m_decoder, &position) &&
+              position > sizeof(m_header);
+    FLAC__stream_decoder_finish(m_decoder);
+    return ok ? position - sizeof(m_header) : 0;
+}
+
+FLAC__StreamDecoderReadStatus FlacDecoder::read(const FLAC__StreamDecoder *, FLAC__byte buffer[], size_t *bytes,
+                                                void *data) {
+    FlacDecoder *decoder = static_cast<FlacDecoder *>(data);
+    size_t wanted = *bytes;
+    *bytes = 0;
+    while (*bytes < wanted) {
+        size_t fed = decoder->m_fed;
+        const uint8_t *from;
+        size_t left;
+        if (fed < sizeof(m_header)) {
+            from = decoder->m_header + fed;
+            left = sizeof(m_header) - fed;
+        } else if (fed - sizeof(m_header) < decoder->m_size) {
+            from = decoder->m_src + fed - sizeof(m_header);
+            left = decoder->m_size - (fed - sizeof(m_header));
+        } else {
+            break;
+        }
+        size_t count = std::min(left, wanted - *bytes);
+        memcpy(buffer + *bytes, from, count);
+        *bytes += count;
+        decoder->m_fed += count;
+    }
+    return *bytes ? FLAC__STREAM_DECODER_READ_STATUS_CONTINUE : FLAC__STREAM_DECODER_READ_STATUS_END_OF_STREAM;
+}
+
+FLAC__StreamDecoderTellStatus FlacDecoder::tell(const FLAC__StreamDecoder *, FLAC__uint64 *offset, void *data) {
+    *offset = static_cast<FlacDecoder *>(data)->m_fed;
+    return FLAC__STREAM_DECODER_TELL_STATUS_OK;
+}
+
+FLAC__StreamDecoderWriteStatus FlacDecoder::write(const FLAC__StreamDecoder *, const FLAC__Frame *frame,
+                                                  const FLAC__int32 *const buffer[], void *data) {
+    FlacDecoder *decoder = static_cast<FlacDecoder *>(data);
+    if (frame->header.channels != 2 || frame->header.bits_per_sample != 16) {
+        return FLAC__STREAM_DECODER_WRITE_STATUS_ABORT;
+    }
+    unsigned count = std::min<unsigned>(frame->header.blocksize, decoder->m_samples - decoder->m_done);
+    uint8_t *out = decoder->m_dest + decoder->m_done * 4;
+    for (unsigned i = 0; i < count; i++, out += 4) {
+        int16_t l = buffer[0][i];
+        int16_t r = buffer[1][i];
+        if (decoder->m_bigEndian) {
+            out[0] = l >> 8;
+            out[1] = l;
+            out[2] = r >> 8;
+            out[3] = r;
+        } else {
+            out[0] = l;
+            out[1] = l >> 8;
+            out[2] = r;
+            out[3] = r >> 8;
+        }
+    }
+    decoder->m_done += count;
+    return FLAC__STREAM_DECODER_WRITE_STATUS_CONTINUE;
+}
+
+const struct {
+    const char *name;
+    PCSX::CHD::Track::Type type;
+    unsigned dataSize;
+} s_trackTypes[] = {
+    {"MODE1", PCSX::CHD::Track::MODE1, 2048},
+    {"MODE1/2048", PCSX::CHD::Track::MODE1, 2048},
+    {"MODE1_RAW", PCSX::CHD::Track::MODE1_RAW, 2352},
+    {"MODE1/2352", PCSX::CHD::Track::MODE1_RAW, 2352},
+    {"MODE2", PCSX::CHD::Track::MODE2, 2336},
+    {"MODE2/2336", PCSX::CHD::Track::MODE2, 2336},
+    {"MODE2_FORM1", PCSX::CHD::Track::MODE2_FORM1, 2048},
+    {"MODE2/2048", PCSX::CHD::Track::MODE2_FORM1, 2048},
+    {"MODE2_FORM2", PCSX::CHD::Track::MODE2_FORM2, 2324},
+    {"MODE2/2324", PCSX::CHD::Track::MODE2_FORM2, 2324},
+    {"MODE2_FORM_MIX", PCSX::CHD::Track::MODE2_FORM_MIX, 2336},
+    {"MODE2_RAW", PCSX::CHD::Track::MODE2_RAW, 2352},
+    {"MODE2/2352", PCSX::CHD::Track::MODE2_RAW, 2352},
+    {"CDI/2352", PCSX::CHD::Track::MODE2_RAW, 2352},
+    {"AUDIO", PCSX::CHD::Track::AUDIO, 2352},
+};
+
+}  // namespace
+
+bool PCSX::CHD::open(File *file, EccGenerator ecc) {
+    close();
+
+    uint8_t header[HEADER_SIZE];
+    file->seek(0, SEEK_SET);
+    if (file->read(header, HEADER_SIZE) != ssize_t(HEADER_SIZE) || memcmp(header, "MComprHD", 8) != 0) return false;
+
+    uint32_t version = get32be(header + 12);
+    if (version != 5) {
+        PCSX::g_system->printf("CHD version %u isn't supported, only version 5 is\n", version);
+        return false;
+    }
+    for (unsigned i = 0; i < 4; i++) {
+        uint32_t codec = m_compressors[i] = get32be(header + 16 + i * 4);
+        if (codec == 0 || codec == CODEC_ZLIB || codec == CODEC_LZMA || codec == CODEC_FLAC || codec == CODEC_CDZL ||
+            codec == CODEC_CDLZ || codec == CODEC_CDFL) {
+            continue;
+        }
+        PCSX::g_system->printf("CHD codec '%c%c%c%c' isn't supported\n", codec >> 24, codec >> 16, codec >> 8, codec);
+        return false;
+    }
+    for (unsigned i = 0; i < 20; i++) {
+        if (header[104 + i] == 0) continue;
+        PCSX::g_system->printf("CHD images with a parent aren't supported\n");
+        return false;
+    }
+
+    uint64_t logicalBytes = get64be(header + 32);
+    uint64_t mapOffset = get64be(header + 40);
+    uint64_t metaOffset = get64be(header + 48);
+    m_hunkBytes = get32be(header + 56);
+    if (m_hunkBytes == 0 || m_hunkBytes % FRAME_SIZE != 0) {
+        PCSX::g_system->printf("CHD image isn't a CD image\n");
+        return false;
+    }
+    m_hunkCount = (logicalBytes + m_hunkBytes - 1) / m_hunkBytes;
+    m_compressedMap = m_compressors[0] != 0;
+
+    m_file = file;
+    m_ecc = ecc;
+    if (!readMap(mapOffset) || !readMetadata(metaOffset)) {
+        close();
+        return false;
+    }
+    return true;
+}
+
+void PCSX::CHD::close() {
+    m_file = nullptr;
+    m_ecc = nullptr;
+    m_map.clear();
+    m_tracks.clear();
+    m_hunkBytes = m_hunkCount = 0;
+}
+
+bool PCSX::CHD::readData(uint64_t offset, void *dest, size_t size) {
+    std::lock_guard<std::mutex> lock(m_fileLock);
+    if (m_file->seek(offset, SEEK_SET) != 0) return false;
+    return m_file->read(dest, size) == ssize_t(size);
+}
+
+bool PCSX::CHD::readMap(uint64_t mapOffset) {
+    if (!m_compressedMap) {
+        m_map.resize(size_t(m_hunkCount) * 4);
+        return readData(mapOffset, m_map.data(), m_map.size());
+    }
+
+    uint8_t header[16];
+    if (!readData(mapOffset, header, sizeof(header))) return false;
+    uint32_t mapBytes = get32be(header);
+    uint64_t offset = get48be(header + 4);
+    uint16_t mapCrc = get16be(header + 10);
+    unsigned lengthBits = header[12];
+    unsigned selfBits = header[13];
+    std::vector<uint8_t> compressed(mapBytes);
+    if (!readData(mapOffset + sizeof(header), compressed.data(), mapBytes)) return false;
+
+    // the hunk types come first, huffman and run length coded
+    BitReader bits(compressed.data(), mapBytes);
+    HuffmanDecoder decoder;
+    if (!decoder.importTreeRLE(bits)) {
+        PCSX::g_system->printf("CHD map is corrupted\n");
+        return false;
+    }
+    m_map.assign(size_t(m_hunkCount) * 12, 0);
+    uint8_t last = 0;
+    unsigned repeat = 0;
+    for (unsigned hunk = 0; hunk < m_hunkCount; hunk++) {
+        if (repeat) {
+            repeat--;
+        } else {
+            unsigned value = decoder.decode(bits);
+            if (value == COMPRESSION_RLE_SMALL) {
+                repeat = 2 + decoder.decode(bits);
+            } else if (value == COMPRESSION_RLE_LARGE) {
+                repeat = 2 + 16 + (decoder.decode(bits) << 4);
+                repeat += decoder.decode(bits);
+            } else {
+                last = value;
+            }
+        }
+        m_map[hunk * 12] = last;
+    }
+
+    // then the lengths, offsets and CRCs, with references to other hunks made relative to the last one
+    uint32_t lastSelf = 0;
+    for (unsigned hunk = 0; hunk < m_hunkCount; hunk++) {
+        uint8_t *entry = &m_map[hunk * 12];
+        uint64_t hunkOffset = offset;
+        uint32_t length = 0;
+        uint16_t crc = 0;
+        switch (entry[0]) {
+            case 0:
+            case 1:
+            case 2:
+            case 3:
+                offset += length = bits.read(lengthBits);
+                crc = bits.read(16);
+                break;
+            case COMPRESSION_NONE:
+                offset += length = m_hunkBytes;
+                crc = bits.read(16);
+                break;
+            case COMPRESSION_SELF:
+                lastSelf = hunkOffset = bits.read(selfBits);
+                break;
+            case COMPRESSION_SELF_1:
+                lastSelf++;
+                // fall through
+            case COMPRESSION_SELF_0:
+                entry[0] = COMPRESSION_SELF;
+                hunkOffset = lastSelf;
+                break;
+            default:
+                PCSX::g_system->printf("CHD images with a parent aren't supported\n");
+                return false;
+        }
+        put24be(entry + 1, length);
+        put48be(entry + 4, hunkOffset);
+        put16be(entry + 10, crc);
+    }
+
+    if (bits.overflow() || crc16(m_map.data(), m_map.size()) != mapCrc) {
+        PCSX::g_system->printf("CHD map is corrupted\n");
+        return false;
+    }
+    return true;
+}
+
+bool PCSX::CHD::readMetadata(uint64_t metaOffset) {
+    // a chain of entries: tag, flags, 24 bits length, offset of the next one
+    for (unsigned entries = 0; metaOffset && entries < 1024; entries++) {
+        uint8_t header[16];
+        if (!readData(metaOffset, header, sizeof(header))) return false;
+        uint32_t tag = get32be(header);
+        uint32_t length = get24be(header + 5);
+
+        if (tag == META_CHT2 || tag == META_CHTR) {
+            std::string text(length, '\0');
+            if (!readData(metaOffset + sizeof(header), &text[0], length)) return false;
+            unsigned number = 0, frames = 0, pregap = 0, postgap = 0;
+            char type[32], subType[32], pregapType[32] = "", pregapSub[32];
+            int fields;
+            if (tag == META_CHT2) {
+                fields = sscanf(text.c_str(),
+                                "TRACK:%u TYPE:%31s SUBTYPE:%31s FRAMES:%u PREGAP:%u PGTYPE:%31s PGSUB:%31s POSTGAP:%u",
+                                &number, type, subType, &frames, &pregap, pregapType, pregapSub, &postgap);
+            } else {
+                fields = sscanf(text.c_str(), "TRACK:%u TYPE:%31s SUBTYPE:%31s FRAMES:%u", &number, type, subType,
+                                &frames) == 4
+                             ? 8
+                             : 0;
+            }
+            if (fields != 8) {
+                PCSX::g_system->printf("CHD track metadata is corrupted\n");
+                return false;
+            }
+
+            Track track;
+            track.number = number;
+            auto found = std::find_if(std::begin(s_trackTypes), std::end(s_trackTypes),
+                                      [&type](const auto &entry) { return strcmp(entry.name, type) == 0; });
+            if (found == std::end(s_trackTypes)) {
+                PCSX::g_system->printf("CHD track type %s isn't supported\n", type);
+                return false;
+            }
+            track.type = found->type;
+            track.dataSize = found->dataSize;
+            if (strcmp(subType, "RW") == 0) {
+                track.subType = Track::SUB_NORMAL;
+            } else if (strcmp(subType, "RW_RAW") == 0) {
+                track.subType = Track::SUB_RAW;
+            } else {
+                track.subType = Track::SUB_NONE;
+            }
+            track.frames = frames;
+            track.pregap = pregap;
+            // a 'V' prefixed pregap type means the pregap data is in the image, ahead of the track
+            track.pregapStored = pregapType[0] == 'V' ? std::min(pregap, frames) : 0;
+            track.postgap = postgap;
+            m_tracks.push_back(track);
+        }
+
+        metaOffset = get64be(header + 8);
+    }
+
+    if (m_tracks.empty()) {
+        PCSX::g_system->printf("CHD image has no CD track\n");
+        return false;
+    }
+    std::sort(m_tracks.begin(), m_tracks.end(), [](const Track &a, const Track &b) { return a.number < b.number; });
+
+    // lay the tracks out; index 1 of the first track is block 0, and the gaps which aren't stored still take
+    // their place on the disc
+    unsigned chdFrame = 0;
+    int lba = -int(m_tracks[0].pregap);
+    for (auto &track : m_tracks) {
+        track.chdFrame = chdFrame;
+        track.lba = lba + track.pregap;
+        lba = track.lba + track.frames - track.pregapStored + track.postgap;
+        chdFrame += (track.frames + TRACK_PADDING - 1) / TRACK_PADDING * TRACK_PADDING;
+    }
+    if (uint64_t(chdFrame) * FRAME_SIZE > uint64_t(m_hunkCount) * m_hunkBytes) {
+        PCSX::g_system->printf("CHD tracks don't fit in the image\n");
+        return false;
+    }
+    return true;
+}
+
+int PCSX::CHD::frameForLba(int lba, const Track **track) const {
+    *track = nullptr;
+    for (auto &t : m_tracks) {
+        if (lba < t.lba - int(t.pregap)) break;
+        *track = &t;
+    }
+    if (*track == nullptr) return -1;
+    int frame = lba - ((*track)->lba - int((*track)->pregapStored));
+    if (frame < 0) return -1;
+    if (frame >= int((*track)->frames)) {
+        if (*track == &m_tracks.back() && frame >= int((*track)->frames + (*track)->postgap)) *track = nullptr;
+        return -1;
+    }
+    return (*track)->chdFrame + frame;
+}
+
+bool PCSX::CHD::readHunk(unsigned hunk, uint8_t *dest) {
+    if (hunk >= m_hunkCount) return false;
+
+    if (!m_compressedMap) {
+        uint64_t offset = uint64_t(get32be(&m_map[hunk * 4])) * m_hunkBytes;
+        if (offset == 0) {
+            memset(dest, 0, m_hunkBytes);
+            return true;
+        }
+        return readData(offset, dest, m_hunkBytes);
+    }
+
+    const uint8_t *entry = &m_map[hunk * 12];
+    uint32_t length = get24be(entry + 1);
+    uint64_t offset = get48be(entry + 4);
+    switch (entry[0]) {
+        case COMPRESSION_SELF:
+            // a copy of an earlier hunk
+            if (offset >= hunk) return false;
+            return readHunk(offset, dest);
+        case COMPRESSION_NONE:
+            if (!readData(offset, dest, m_hunkBytes)) return false;
+            break;
+        default: {
+            // a codec slot the header left empty can only come from a corrupted map
+            if (m_compressors[entry[0]] == 0) {
+                PCSX::g_system->printf("CHD hunk %u is corrupted\n", hunk);
+                return false;
+            }
+            std::vector<uint8_t> compressed(length);
+            if (!readData(offset, compressed.data(), length)) return false;
+            if (!decompress(m_compressors[entry[0]], compressed.data(), length, dest)) {
+                PCSX::g_system->printf("CHD hunk %u failed to decompress\n", hunk);
+                return false;
+            }
+            break;
+        }
+    }
+
+    if (crc16(dest, m_hunkBytes) != get16be(entry + 10)) {
+        PCSX::g_system->printf("CHD hunk %u is corrupted\n", hunk);
+        return false;
+    }
+    return true;
+}
+
+bool PCSX::CHD::decompress(uint32_t codec, const uint8_t *src, size_t size, uint8_t *dest) {
+    if (codec == CODEC_ZLIB) return inflateRaw(src, size, dest, m_hunkBytes);
+    if (codec == CODEC_LZMA) return lzmaDecode(src, size, dest, m_hunkBytes);
+    if (codec == CODEC_FLAC) {
+        // the first byte tells the samples' endianness
+        if (size == 0 || (src[0] != 'L' && src[0] != 'B')) return false;
+        return FlacDecoder().decode(src + 1, size - 1, dest, m_hunkBytes / 4, src[0] == 'B') != 0;
+    }
+    if (codec == CODEC_CDZL || codec == CODEC_CDLZ || codec == CODEC_CDFL) return decompressCD(codec, src, size, dest);
+    return false;
+}
+
+// the CD codecs compress the sectors and the subchannel data as two separate streams; cdzl and cdlz also
+// strip the sync and ECC of the mode 1 sectors they can regenerate, which a bitmap ahead of the data marks
+bool PCSX::CHD::decompressCD(uint32_t codec, const uint8_t *src, size_t size, uint8_t *dest) {
+    const unsigned frames = m_hunkBytes / FRAME_SIZE;
+    std::vector<uint8_t> buffer(m_hunkBytes);
+    uint8_t *sectors = buffer.data();
+    uint8_t *subs = sectors + frames * SECTOR_SIZE;
+    const uint8_t *eccBitmap = nullptr;
+    size_t subOffset;
+
+    if (codec == CODEC_CDFL) {
+        subOffset = FlacDecoder().decode(src, size, sectors, frames * SECTOR_SIZE / 4, true);
+        if (subOffset == 0) return false;
+    } else {
+        const unsigned eccBytes = (frames + 7) / 8;
+        const unsigned lengthBytes = m_hunkBytes < 65536 ? 2 : 3;
+        const size_t headerBytes = eccBytes + lengthBytes;
+        if (size < headerBytes) return false;
+        size_t baseLength = get16be(src + eccBytes);
+        if (lengthBytes > 2) baseLength = (baseLength << 8) | src[eccBytes + 2];
+        if (headerBytes + baseLength > size) return false;
+        const uint8_t *base = src + headerBytes;
+        bool ok = codec == CODEC_CDZL ? inflateRaw(base, baseLength, sectors, frames * SECTOR_SIZE)
+                                      : lzmaDecode(base, baseLength, sectors, frames * SECTOR_SIZE);
+        if (!ok) return false;
+        eccBitmap = src;
+        subOffset = headerBytes + baseLength;
+    }
+    if (subOffset > size || !inflateRaw(src + subOffset, size - subOffset, subs, frames * SUB_SIZE)) return false;
+
+    for (unsigned f = 0; f < frames; f++) {
+        uint8_t *sector = dest + f * FRAME_SIZE;
+        memcpy(sector, sectors + f * SECTOR_SIZE, SECTOR_SIZE);
+        memcpy(sector + SECTOR_SIZE, subs + f * SUB_SIZE, SUB_SIZE);
+        if (eccBitmap && (eccBitmap[f / 8] & (1 << (f % 8)))) {
+            memcpy(sector, SYNC, sizeof(SYNC));
+            if (sector[15] == 1 && m_ecc) m_ecc(sector);
+        }
+    }
+    return true;
+}
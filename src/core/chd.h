@@ -0,0 +1,92 @@
+/***************************************************************************
+ *   Copyright (C) 2019 PCSX-Redux authors                                 *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.           *
+ ***************************************************************************/
+
+#pragma once
+
+#include <stdint.h>
+
+#include <functional>
+#include <mutex>
+#include <vector>
+
+class File;
+
+namespace PCSX {
+
+// MAME's compressed hunks of data format, version 5, as far as CD images go: the image is a series of
+// hunks, each holding a few 2448 bytes frames (the sector, then its 96 bytes of subchannel data), compressed
+// by one of up to four codecs. Images that need a parent aren't supported.
+class CHD {
+  public:
+    static const unsigned FRAME_SIZE = 2448;
+    static const unsigned SECTOR_SIZE = 2352;
+    static const unsigned SUB_SIZE = 96;
+
+    struct Track {
+        enum Type { MODE1, MODE1_RAW, MODE2, MODE2_FORM1, MODE2_FORM2, MODE2_FORM_MIX, MODE2_RAW, AUDIO } type;
+        enum SubType { SUB_NORMAL, SUB_RAW, SUB_NONE } subType;
+        unsigned number;
+        unsigned dataSize;      // bytes of sector data at the start of each frame
+        unsigned frames;        // frames stored in the image, including pregapStored
+        unsigned pregap;        // pregap length, whether its data is in the image or not
+        unsigned pregapStored;  // how much of the pregap is in the image
+        unsigned postgap;
+        unsigned chdFrame;  // where the track's frames start in the image
+        int lba;            // logical block address of index 1, the first one being 0
+    };
+
+    // regenerates the ECC bytes of a mode 1 sector, which the CD codecs may strip
+    typedef std::function<void(uint8_t *sector)> EccGenerator;
+
+    ~CHD() { close(); }
+    // false if the file isn't a CHD image, or uses something not supported here, which is then reported
+    bool open(File *file, EccGenerator ecc);
+    void close();
+    bool isOpen() const { return m_file != nullptr; }
+
+    unsigned hunkBytes() const { return m_hunkBytes; }
+    unsigned hunkCount() const { return m_hunkCount; }
+    const std::vector<Track> &tracks() const { return m_tracks; }
+    // image frame holding the given block; -1 for the gaps which the image doesn't store, or past the end,
+    // in which case track is set to nullptr
+    int frameForLba(int lba, const Track **track) const;
+    // decompresses a whole hunk; safe to call from several threads at once
+    bool readHunk(unsigned hunk, uint8_t *dest);
+
+  private:
+    bool readMap(uint64_t mapOffset);
+    bool readMetadata(uint64_t metaOffset);
+    bool readData(uint64_t offset, void *dest, size_t size);
+    bool decompress(uint32_t codec, const uint8_t *src, size_t size, uint8_t *dest);
+    bool decompressCD(uint32_t codec, const uint8_t *src, size_t size, uint8_t *dest);
+
+    File *m_file = nullptr;
+    std::mutex m_fileLock;
+    EccGenerator m_ecc;
+    uint32_t m_compressors[4] = {0, 0, 0, 0};
+    unsigned m_hunkBytes = 0;
+    unsigned m_hunkCount = 0;
+    // 12 bytes per hunk, as MAME lays it out: compression type, 24 bits length, 48 bits offset, 16 bits crc;
+    // uncompressed images have 4 bytes per hunk instead, the offset in hunks
+    std::vector<uint8_t> m_map;
+    bool m_compressedMap = false;
+    std::vector<Track> m_tracks;
+};
+
+}  // namespace PCSX
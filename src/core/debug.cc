@@ -372,50 +372,50 @@ void PCSX::Debug::ProcessDebug() {
     if (!s_paused) {
         if (s_trace && s_printpc) {
             char reply[256];
-            uint32_t pc = g_emulator.m_psxCpu->m_psxRegs.pc;
-            std::string ins = Disasm::asString(g_emulator.m_psxMem->psxMemRead32(pc), 0, pc);
+            uint32_t pc = g_emulator->m_psxCpu->m_psxRegs.pc;
+            std::string ins = Disasm::asString(g_emulator->m_psxMem->psxMemRead32(pc), 0, pc);
             sprintf(reply, "219 %s\r\n", ins.c_str());
             WriteSocket(reply, strlen(reply));
         }
 
         if (s_step_over) {
-            if (PCSX::g_emulator.m_psxCpu->m_psxRegs.pc == s_step_over_addr) {
+            if (PCSX::g_emulator->m_psxCpu->m_psxRegs.pc == s_step_over_addr) {
                 char reply[256];
                 s_step_over = 0;
                 s_step_over_addr = 0;
-                sprintf(reply, "050 @%08X\r\n", PCSX::g_emulator.m_psxCpu->m_psxRegs.pc);
+                sprintf(reply, "050 @%08X\r\n", PCSX::g_emulator->m_psxCpu->m_psxRegs.pc);
                 WriteSocket(reply, strlen(reply));
                 s_paused = 1;
             }
         }
 
         if (s_run_to) {
-            if (PCSX::g_emulator.m_psxCpu->m_psxRegs.pc == s_run_to_addr) {
+            if (PCSX::g_emulator->m_psxCpu->m_psxRegs.pc == s_run_to_addr) {
                 char reply[256];
                 s_run_to = 0;
                 s_run_to_addr = 0;
-                sprintf(reply, "040 @%08X\r\n", PCSX::g_emulator.m_psxCpu->m_psxRegs.pc);
+                sprintf(reply, "040 @%08X\r\n", PCSX::g_emulator->m_psxCpu->m_psxRegs.pc);
                 WriteSocket(reply, strlen(reply));
                 s_paused = 1;
             }
         }
 
-        DebugCheckBP(PCSX::g_emulator.m_psxCpu->m_psxRegs.pc, BE);
+        DebugCheckBP(PCSX::g_emulator->m_psxCpu->m_psxRegs.pc, BE);
     }
     if (s_mapping_e) {
-        MarkMap(PCSX::g_emulator.m_psxCpu->m_psxRegs.pc, MAP_EXEC);
-        if ((PCSX::g_emulator.m_psxCpu->m_psxRegs.code >> 26) == 3) {
+        MarkMap(PCSX::g_emulator->m_psxCpu->m_psxRegs.pc, MAP_EXEC);
+        if ((PCSX::g_emulator->m_psxCpu->m_psxRegs.code >> 26) == 3) {
             MarkMap(_JumpTarget_, MAP_EXEC_JAL);
         }
-        if (((PCSX::g_emulator.m_psxCpu->m_psxRegs.code >> 26) == 0) &&
-            ((PCSX::g_emulator.m_psxCpu->m_psxRegs.code & 0x3F) == 9)) {
+        if (((PCSX::g_emulator->m_psxCpu->m_psxRegs.code >> 26) == 0) &&
+            ((PCSX::g_emulator->m_psxCpu->m_psxRegs.code & 0x3F) == 9)) {
             MarkMap(_Rd_, MAP_EXEC_JAL);
         }
     }
     while (s_paused) {
         GetClient();
         ProcessCommands();
-        PCSX::g_emulator.m_gpu->updateLace();
+        PCSX::g_emulator->m_gpu->updateLace();
         PCSX::g_system->update();
     }
 }
@@ -463,7 +463,7 @@ void PCSX::Debug::ProcessCommands() {
                 sprintf(reply, "203 %i\r\n", s_paused ? 1 : s_trace ? 2 : 0);
                 break;
             case 0x110:
-                sprintf(reply, "210 PC=%08X\r\n", PCSX::g_emulator.m_psxCpu->m_psxRegs.pc);
+                sprintf(reply, "210 PC=%08X\r\n", PCSX::g_emulator->m_psxCpu->m_psxRegs.pc);
                 break;
             case 0x111:
                 if (arguments) {
@@ -476,20 +476,20 @@ void PCSX::Debug::ProcessCommands() {
                     reply[0] = 0;
                     for (i = 0; i < 32; i++) {
                         sprintf(reply, "%s211 %02X(%2.2s)=%08X\r\n", reply, i, PCSX::Disasm::s_disRNameGPR[i],
-                                PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.r[i]);
+                                PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.r[i]);
                     }
                 } else {
                     if ((code >= 0) && (code < 32)) {
                         sprintf(reply, "211 %02X(%2.2s)=%08X\r\n", code, PCSX::Disasm::s_disRNameGPR[code],
-                                PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.r[code]);
+                                PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.r[code]);
                     } else {
                         sprintf(reply, "511 Invalid GPR register: %X\r\n", code);
                     }
                 }
                 break;
             case 0x112:
-                sprintf(reply, "212 LO=%08X HI=%08X\r\n", PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.n.lo,
-                        PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.n.hi);
+                sprintf(reply, "212 LO=%08X HI=%08X\r\n", PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.n.lo,
+                        PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.n.hi);
                 break;
             case 0x113:
                 if (arguments) {
@@ -502,12 +502,12 @@ void PCSX::Debug::ProcessCommands() {
                     reply[0] = 0;
                     for (i = 0; i < 32; i++) {
                         sprintf(reply, "%s213 %02X(%8.8s)=%08X\r\n", reply, i, PCSX::Disasm::s_disRNameCP0[i],
-                                PCSX::g_emulator.m_psxCpu->m_psxRegs.CP0.r[i]);
+                                PCSX::g_emulator->m_psxCpu->m_psxRegs.CP0.r[i]);
                     }
                 } else {
                     if ((code >= 0) && (code < 32)) {
                         sprintf(reply, "213 %02X(%8.8s)=%08X\r\n", code, PCSX::Disasm::s_disRNameCP0[code],
-                                PCSX::g_emulator.m_psxCpu->m_psxRegs.CP0.r[code]);
+                                PCSX::g_emulator->m_psxCpu->m_psxRegs.CP0.r[code]);
                     } else {
                         sprintf(reply, "511 Invalid COP0 register: %X\r\n", code);
                     }
@@ -524,12 +524,12 @@ void PCSX::Debug::ProcessCommands() {
                     reply[0] = 0;
                     for (i = 0; i < 32; i++) {
                         sprintf(reply, "%s214 %02X(%6.6s)=%08X\r\n", reply, i, PCSX::Disasm::s_disRNameCP2C[i],
-                                PCSX::g_emulator.m_psxCpu->m_psxRegs.CP2C.r[i]);
+                                PCSX::g_emulator->m_psxCpu->m_psxRegs.CP2C.r[i]);
                     }
                 } else {
                     if ((code >= 0) && (code < 32)) {
                         sprintf(reply, "214 %02X(%6.6s)=%08X\r\n", code, PCSX::Disasm::s_disRNameCP2C[code],
-                                PCSX::g_emulator.m_psxCpu->m_psxRegs.CP2C.r[code]);
+                                PCSX::g_emulator->m_psxCpu->m_psxRegs.CP2C.r[code]);
                     } else {
                         sprintf(reply, "511 Invalid COP2C register: %X\r\n", code);
                     }
@@ -546,12 +546,12 @@ void PCSX::Debug::ProcessCommands() {
                     reply[0] = 0;
                     for (i = 0; i < 32; i++) {
                         sprintf(reply, "%s215 %02X(%4.4s)=%08X\r\n", reply, i, PCSX::Disasm::s_disRNameCP2D[i],
-                                PCSX::g_emulator.m_psxCpu->m_psxRegs.CP2D.r[i]);
+                                PCSX::g_emulator->m_psxCpu->m_psxRegs.CP2D.r[i]);
                     }
                 } else {
                     if ((code >= 0) && (code < 32)) {
                         sprintf(reply, "215 %02X(%4.4s)=%08X\r\n", code, PCSX::Disasm::s_disRNameCP2D[code],
-                                PCSX::g_emulator.m_psxCpu->m_psxRegs.CP2D.r[code]);
+                                PCSX::g_emulator->m_psxCpu->m_psxRegs.CP2D.r[code]);
                     } else {
                         sprintf(reply, "511 Invalid COP2D register: %X\r\n", code);
                     }
@@ -564,10 +564,10 @@ void PCSX::Debug::ProcessCommands() {
                         break;
                     }
                 }
-                if (!arguments) code = PCSX::g_emulator.m_psxCpu->m_psxRegs.pc;
+                if (!arguments) code = PCSX::g_emulator->m_psxCpu->m_psxRegs.pc;
 
                 {
-                    std::string ins = Disasm::asString(g_emulator.m_psxMem->psxMemRead32(code), 0, code);
+                    std::string ins = Disasm::asString(g_emulator->m_psxMem->psxMemRead32(code), 0, code);
                     sprintf(reply, "219 %s\r\n", ins.c_str());
                 }
                 break;
@@ -578,7 +578,7 @@ void PCSX::Debug::ProcessCommands() {
                 }
 
                 if (reg < 32) {
-                    PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.r[reg] = value;
+                    PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.r[reg] = value;
                     sprintf(reply, "221 %02X=%08X\r\n", reg, value);
                 } else {
                     sprintf(reply, "512 Invalid GPR register: %02X\r\n", reg);
@@ -598,9 +598,9 @@ void PCSX::Debug::ProcessCommands() {
                 if (sscanf(arguments + 3, "%08X", &value) != 1) {
                     sprintf(reply, "500 Malformed 122 command '%s'\r\n", arguments);
                 } else {
-                    PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.r[reg] = value;
-                    sprintf(reply, "222 LO=%08X HI=%08X\r\n", PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.n.lo,
-                            PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.n.hi);
+                    PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.r[reg] = value;
+                    sprintf(reply, "222 LO=%08X HI=%08X\r\n", PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.n.lo,
+                            PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.n.hi);
                 }
                 break;
             case 0x123:
@@ -610,7 +610,7 @@ void PCSX::Debug::ProcessCommands() {
                 }
 
                 if (reg < 32) {
-                    PCSX::g_emulator.m_psxCpu->m_psxRegs.CP0.r[reg] = value;
+                    PCSX::g_emulator->m_psxCpu->m_psxRegs.CP0.r[reg] = value;
                     sprintf(reply, "223 %02X=%08X\r\n", reg, value);
                 } else {
                     sprintf(reply, "512 Invalid COP0 register: %02X\r\n", reg);
@@ -623,7 +623,7 @@ void PCSX::Debug::ProcessCommands() {
                 }
 
                 if (reg < 32) {
-                    PCSX::g_emulator.m_psxCpu->m_psxRegs.CP2C.r[reg] = value;
+                    PCSX::g_emulator->m_psxCpu->m_psxRegs.CP2C.r[reg] = value;
                     sprintf(reply, "224 %02X=%08X\r\n", reg, value);
                 } else {
                     sprintf(reply, "512 Invalid COP2C register: %02X\r\n", reg);
@@ -636,7 +636,7 @@ void PCSX::Debug::ProcessCommands() {
                 }
 
                 if (reg < 32) {
-                    PCSX::g_emulator.m_psxCpu->m_psxRegs.CP2D.r[reg] = value;
+                    PCSX::g_emulator->m_psxCpu->m_psxRegs.CP2D.r[reg] = value;
                     sprintf(reply, "225 %02X=%08X\r\n", reg, value);
                 } else {
                     sprintf(reply, "512 Invalid COP2D register: %02X\r\n", reg);
@@ -1107,13 +1107,14 @@ void PCSX::Debug::ProcessCommands() {
             case 0x3A1:
                 // step over (jal)
                 if (s_paused) {
-                    uint32_t opcode = PCSX::g_emulator.m_psxMem->psxMemRead32(PCSX::g_emulator.m_psxCpu->m_psxRegs.pc);
+                    uint32_t pc = PCSX::g_emulator->m_psxCpu->m_psxRegs.pc;
+                    uint32_t opcode = PCSX::g_emulator->m_psxMem->psxMemRead32(pc);
                     if ((opcode >> 26) == 3) {
                         s_step_over = 1;
-                        s_step_over_addr = PCSX::g_emulator.m_psxCpu->m_psxRegs.pc + 8;
+                        s_step_over_addr = PCSX::g_emulator->m_psxCpu->m_psxRegs.pc + 8;
                         s_paused = 0;
 
-                        sprintf(reply, "4A1 step over addr %08X\r\n", PCSX::g_emulator.m_psxCpu->m_psxRegs.pc);
+                        sprintf(reply, "4A1 step over addr %08X\r\n", PCSX::g_emulator->m_psxCpu->m_psxRegs.pc);
                     } else {
                         s_trace = 1;
                         s_paused = 0;
@@ -1144,7 +1145,7 @@ void PCSX::Debug::DebugCheckBP(uint32_t address, enum breakpoint_types type) {
 
     for (bp = s_firstBP; bp; bp = next_breakpoint(bp)) {
         if ((bp->type == type) && (bp->address == address)) {
-            sprintf(reply, "030 %X@%08X\r\n", bp->number, PCSX::g_emulator.m_psxCpu->m_psxRegs.pc);
+            sprintf(reply, "030 %X@%08X\r\n", bp->number, PCSX::g_emulator->m_psxCpu->m_psxRegs.pc);
             WriteSocket(reply, strlen(reply));
             s_paused = 1;
             return;
@@ -1152,49 +1153,49 @@ void PCSX::Debug::DebugCheckBP(uint32_t address, enum breakpoint_types type) {
     }
     if (s_breakmp_e && type == BE) {
         if (!IsMapMarked(address, MAP_EXEC)) {
-            sprintf(reply, "010 %08X@%08X\r\n", address, PCSX::g_emulator.m_psxCpu->m_psxRegs.pc);
+            sprintf(reply, "010 %08X@%08X\r\n", address, PCSX::g_emulator->m_psxCpu->m_psxRegs.pc);
             WriteSocket(reply, strlen(reply));
             s_paused = 1;
         }
     }
     if (s_breakmp_r8 && type == BR1) {
         if (!IsMapMarked(address, MAP_R8)) {
-            sprintf(reply, "011 %08X@%08X\r\n", address, PCSX::g_emulator.m_psxCpu->m_psxRegs.pc);
+            sprintf(reply, "011 %08X@%08X\r\n", address, PCSX::g_emulator->m_psxCpu->m_psxRegs.pc);
             WriteSocket(reply, strlen(reply));
             s_paused = 1;
         }
     }
     if (s_breakmp_r16 && type == BR2) {
         if (!IsMapMarked(address, MAP_R16)) {
-            sprintf(reply, "012 %08X@%08X\r\n", address, PCSX::g_emulator.m_psxCpu->m_psxRegs.pc);
+            sprintf(reply, "012 %08X@%08X\r\n", address, PCSX::g_emulator->m_psxCpu->m_psxRegs.pc);
             WriteSocket(reply, strlen(reply));
             s_paused = 1;
         }
     }
     if (s_breakmp_r32 && type == BR4) {
         if (!IsMapMarked(address, MAP_R32)) {
-            sprintf(reply, "013 %08X@%08X\r\n", address, PCSX::g_emulator.m_psxCpu->m_psxRegs.pc);
+            sprintf(reply, "013 %08X@%08X\r\n", address, PCSX::g_emulator->m_psxCpu->m_psxRegs.pc);
             WriteSocket(reply, strlen(reply));
             s_paused = 1;
         }
     }
     if (s_breakmp_w8 && type == BW1) {
         if (!IsMapMarked(address, MAP_W8)) {
-            sprintf(reply, "014 %08X@%08X\r\n", address, PCSX::g_emulator.m_psxCpu->m_psxRegs.pc);
+            sprintf(reply, "014 %08X@%08X\r\n", address, PCSX::g_emulator->m_psxCpu->m_psxRegs.pc);
             WriteSocket(reply, strlen(reply));
             s_paused = 1;
         }
     }
     if (s_breakmp_w16 && type == BW2) {
         if (!IsMapMarked(address, MAP_W16)) {
-            sprintf(reply, "015 %08X@%08X\r\n", address, PCSX::g_emulator.m_psxCpu->m_psxRegs.pc);
+            sprintf(reply, "015 %08X@%08X\r\n", address, PCSX::g_emulator->m_psxCpu->m_psxRegs.pc);
             WriteSocket(reply, strlen(reply));
             s_paused = 1;
         }
     }
     if (s_breakmp_w32 && type == BW4) {
         if (!IsMapMarked(address, MAP_W32)) {
-            sprintf(reply, "016 %08X@%08X\r\n", address, PCSX::g_emulator.m_psxCpu->m_psxRegs.pc);
+            sprintf(reply, "016 %08X@%08X\r\n", address, PCSX::g_emulator->m_psxCpu->m_psxRegs.pc);
             WriteSocket(reply, strlen(reply));
             s_paused = 1;
         }
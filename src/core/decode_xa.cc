@@ -21,35 +21,20 @@
  * XA audio decoding functions (Kazzuya).
  */
 
+#include "core/adpcm.h"
 #include "core/decode_xa.h"
 
-//#define FIXED
-
-#define NOT(_X_) (!(_X_))
-#define XACLAMP(_X_, _MI_, _MA_)    \
-    {                               \
-        if (_X_ < _MI_) _X_ = _MI_; \
-        if (_X_ > _MA_) _X_ = _MA_; \
-    }
-
-#define SH 4
-#define SHC 10
-
 //============================================
 //===  ADPCM DECODING ROUTINES
 //============================================
 
-#ifndef FIXED
-static const double s_K0[4] = {0.0, 0.9375, 1.796875, 1.53125};
-
-static const double s_K1[4] = {0.0, 0.0, -0.8125, -0.859375};
-#else
-static const int s_K0[4] = {0.0 * (1 << SHC), 0.9375 * (1 << SHC), 1.796875 * (1 << SHC), 1.53125 * (1 << SHC)};
-
-static const int s_K1[4] = {0.0 * (1 << SHC), 0.0 * (1 << SHC), -0.8125 * (1 << SHC), -0.859375 * (1 << SHC)};
-#endif
-
-#define BLKSIZ 28 /* block size (32 - 4 nibbles) */
+// The 4 bits samples of a sound unit get gathered into an SPU-style 16 bytes block, which carries
+// the filter/range byte as its header, so both the XA and the SPU paths share the same decoder.
+static inline void ADPCM_DecodeBlock16(ADPCM_Decode_t *decp, uint8_t filter_range, uint8_t *block, short *destp,
+                                       int inc) {
+    block[0] = filter_range;
+    PCSX::ADPCM::decodeXABlock(block, destp, inc, &decp->y0, &decp->y1);
+}
 
 //===========================================
 static void ADPCM_InitDecode(ADPCM_Decode_t *decp) {
@@ -57,73 +42,6 @@ static void ADPCM_InitDecode(ADPCM_Decode_t *decp) {
     decp->y1 = 0;
 }
 
-//===========================================
-#ifndef FIXED
-#define IK0(fid) ((int)((-s_K0[fid]) * (1 << SHC)))
-#define IK1(fid) ((int)((-s_K1[fid]) * (1 << SHC)))
-#else
-#define IK0(fid) (-s_K0[fid])
-#define IK1(fid) (-s_K1[fid])
-#endif
-
-static inline void ADPCM_DecodeBlock16(ADPCM_Decode_t *decp, uint8_t filter_range, const void *vblockp, short *destp,
-                                       int inc) {
-    int i;
-    int range, filterid;
-    int32_t fy0, fy1;
-    const uint16_t *blockp;
-
-    blockp = (const unsigned short *)vblockp;
-    filterid = (filter_range >> 4) & 0x0f;
-    range = (filter_range >> 0) & 0x0f;
-
-    fy0 = decp->y0;
-    fy1 = decp->y1;
-
-    for (i = BLKSIZ / 4; i; --i) {
-        int32_t y;
-        int32_t x0, x1, x2, x3;
-
-        y = *blockp++;
-        x3 = (short)(y & 0xf000) >> range;
-        x3 <<= SH;
-        x2 = (short)((y << 4) & 0xf000) >> range;
-        x2 <<= SH;
-        x1 = (short)((y << 8) & 0xf000) >> range;
-        x1 <<= SH;
-        x0 = (short)((y << 12) & 0xf000) >> range;
-        x0 <<= SH;
-
-        x0 -= (IK0(filterid) * fy0 + (IK1(filterid) * fy1)) >> SHC;
-        fy1 = fy0;
-        fy0 = x0;
-        x1 -= (IK0(filterid) * fy0 + (IK1(filterid) * fy1)) >> SHC;
-        fy1 = fy0;
-        fy0 = x1;
-        x2 -= (IK0(filterid) * fy0 + (IK1(filterid) * fy1)) >> SHC;
-        fy1 = fy0;
-        fy0 = x2;
-        x3 -= (IK0(filterid) * fy0 + (IK1(filterid) * fy1)) >> SHC;
-        fy1 = fy0;
-        fy0 = x3;
-
-        XACLAMP(x0, -32768 << SH, 32767 << SH);
-        *destp = x0 >> SH;
-        destp += inc;
-        XACLAMP(x1, -32768 << SH, 32767 << SH);
-        *destp = x1 >> SH;
-        destp += inc;
-        XACLAMP(x2, -32768 << SH, 32767 << SH);
-        *destp = x2 >> SH;
-        destp += inc;
-        XACLAMP(x3, -32768 << SH, 32767 << SH);
-        *destp = x3 >> SH;
-        destp += inc;
-    }
-    decp->y0 = fy0;
-    decp->y1 = fy1;
-}
-
 static const int s_headtable[4] = {0, 2, 8, 10};
 
 //===========================================
@@ -131,7 +49,7 @@ static void xa_decode_data(xa_decode_t *xdp, unsigned char *srcp) {
     const uint8_t *sound_groupsp;
     const uint8_t *sound_datap, *sound_datap2;
     int i, j, k, nbits;
-    uint16_t data[4096], *datap;
+    uint8_t data[PCSX::ADPCM::BLOCK_SIZE] = {0}, *datap;
     short *destp;
 
     destp = xdp->pcm;
@@ -144,19 +62,21 @@ static void xa_decode_data(xa_decode_t *xdp, unsigned char *srcp) {
                 sound_datap = sound_groupsp + 16;  // sound data just after the header
 
                 for (i = 0; i < nbits; i++) {
-                    datap = data;
+                    datap = data + 2;
                     sound_datap2 = sound_datap + i;
 
-                    for (k = 0; k < 14; k++, sound_datap2 += 8) {
-                        *(datap++) = (uint16_t)sound_datap2[0] | (uint16_t)(sound_datap2[4] << 8);
+                    for (k = 0; k < 7; k++, sound_datap2 += 8) {
+                        *(datap++) = sound_datap2[0];
+                        *(datap++) = sound_datap2[4];
                     }
 
                     ADPCM_DecodeBlock16(&xdp->left, sound_groupsp[s_headtable[i] + 0], data, destp + 0, 2);
 
-                    datap = data;
+                    datap = data + 2;
                     sound_datap2 = sound_datap + i;
-                    for (k = 0; k < 14; k++, sound_datap2 += 8) {
-                        *(datap++) = (uint16_t)sound_datap2[0] | (uint16_t)(sound_datap2[4] << 8);
+                    for (k = 0; k < 7; k++, sound_datap2 += 8) {
+                        *(datap++) = sound_datap2[0];
+                        *(datap++) = sound_datap2[4];
                     }
                     ADPCM_DecodeBlock16(&xdp->right, sound_groupsp[s_headtable[i] + 1], data, destp + 1, 2);
 
@@ -169,22 +89,20 @@ static void xa_decode_data(xa_decode_t *xdp, unsigned char *srcp) {
                 sound_datap = sound_groupsp + 16;  // sound data just after the header
 
                 for (i = 0; i < nbits; i++) {
-                    datap = data;
+                    datap = data + 2;
                     sound_datap2 = sound_datap + i;
 
                     for (k = 0; k < 7; k++, sound_datap2 += 16) {
-                        *(datap++) = (uint16_t)(sound_datap2[0] & 0x0f) | ((uint16_t)(sound_datap2[4] & 0x0f) << 4) |
-                                     ((uint16_t)(sound_datap2[8] & 0x0f) << 8) |
-                                     ((uint16_t)(sound_datap2[12] & 0x0f) << 12);
+                        *(datap++) = (sound_datap2[0] & 0x0f) | ((sound_datap2[4] & 0x0f) << 4);
+                        *(datap++) = (sound_datap2[8] & 0x0f) | ((sound_datap2[12] & 0x0f) << 4);
                     }
                     ADPCM_DecodeBlock16(&xdp->left, sound_groupsp[s_headtable[i] + 0], data, destp + 0, 2);
 
-                    datap = data;
+                    datap = data + 2;
                     sound_datap2 = sound_datap + i;
                     for (k = 0; k < 7; k++, sound_datap2 += 16) {
-                        *(datap++) = (uint16_t)(sound_datap2[0] >> 4) | ((uint16_t)(sound_datap2[4] >> 4) << 4) |
-                                     ((uint16_t)(sound_datap2[8] >> 4) << 8) |
-                                     ((uint16_t)(sound_datap2[12] >> 4) << 12);
+                        *(datap++) = (sound_datap2[0] >> 4) | (sound_datap2[4] & 0xf0);
+                        *(datap++) = (sound_datap2[8] >> 4) | (sound_datap2[12] & 0xf0);
                     }
                     ADPCM_DecodeBlock16(&xdp->right, sound_groupsp[s_headtable[i] + 1], data, destp + 1, 2);
 
@@ -199,19 +117,21 @@ static void xa_decode_data(xa_decode_t *xdp, unsigned char *srcp) {
                 sound_datap = sound_groupsp + 16;  // sound data just after the header
 
                 for (i = 0; i < nbits; i++) {
-                    datap = data;
+                    datap = data + 2;
                     sound_datap2 = sound_datap + i;
-                    for (k = 0; k < 14; k++, sound_datap2 += 8) {
-                        *(datap++) = (uint16_t)sound_datap2[0] | (uint16_t)(sound_datap2[4] << 8);
+                    for (k = 0; k < 7; k++, sound_datap2 += 8) {
+                        *(datap++) = sound_datap2[0];
+                        *(datap++) = sound_datap2[4];
                     }
                     ADPCM_DecodeBlock16(&xdp->left, sound_groupsp[s_headtable[i] + 0], data, destp, 1);
 
                     destp += 28;
 
-                    datap = data;
+                    datap = data + 2;
                     sound_datap2 = sound_datap + i;
-                    for (k = 0; k < 14; k++, sound_datap2 += 8) {
-                        *(datap++) = (uint16_t)sound_datap2[0] | (uint16_t)(sound_datap2[4] << 8);
+                    for (k = 0; k < 7; k++, sound_datap2 += 8) {
+                        *(datap++) = sound_datap2[0];
+                        *(datap++) = sound_datap2[4];
                     }
                     ADPCM_DecodeBlock16(&xdp->left, sound_groupsp[s_headtable[i] + 1], data, destp, 1);
 
@@ -224,23 +144,21 @@ static void xa_decode_data(xa_decode_t *xdp, unsigned char *srcp) {
                 sound_datap = sound_groupsp + 16;  // sound data just after the header
 
                 for (i = 0; i < nbits; i++) {
-                    datap = data;
+                    datap = data + 2;
                     sound_datap2 = sound_datap + i;
                     for (k = 0; k < 7; k++, sound_datap2 += 16) {
-                        *(datap++) = (uint16_t)(sound_datap2[0] & 0x0f) | ((uint16_t)(sound_datap2[4] & 0x0f) << 4) |
-                                     ((uint16_t)(sound_datap2[8] & 0x0f) << 8) |
-                                     ((uint16_t)(sound_datap2[12] & 0x0f) << 12);
+                        *(datap++) = (sound_datap2[0] & 0x0f) | ((sound_datap2[4] & 0x0f) << 4);
+                        *(datap++) = (sound_datap2[8] & 0x0f) | ((sound_datap2[12] & 0x0f) << 4);
                     }
                     ADPCM_DecodeBlock16(&xdp->left, sound_groupsp[s_headtable[i] + 0], data, destp, 1);
 
                     destp += 28;
 
-                    datap = data;
+                    datap = data + 2;
                     sound_datap2 = sound_datap + i;
                     for (k = 0; k < 7; k++, sound_datap2 += 16) {
-                        *(datap++) = (uint16_t)(sound_datap2[0] >> 4) | ((uint16_t)(sound_datap2[4] >> 4) << 4) |
-                                     ((uint16_t)(sound_datap2[8] >> 4) << 8) |
-                                     ((uint16_t)(sound_datap2[12] >> 4) << 12);
+                        *(datap++) = (sound_datap2[0] >> 4) | (sound_datap2[4] & 0xf0);
+                        *(datap++) = (sound_datap2[8] >> 4) | (sound_datap2[12] & 0xf0);
                     }
                     ADPCM_DecodeBlock16(&xdp->left, sound_groupsp[s_headtable[i] + 1], data, destp, 1);
 
@@ -0,0 +1,155 @@
+/*  PPF Patch Support for PCSX-Reloaded
+ *  Copyright (c) 2009, Wei Mingzhi <whistler_wmz@users.sf.net>.
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "core/eccedc.h"
+
+#include <string.h>
+
+// PCSX_NO_SIMD builds the portable code only, for tools/kernelcheck to compare against
+#if !defined(PCSX_NO_SIMD) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define ECC_SSE2 1
+#include <emmintrin.h>
+#endif
+
+namespace {
+
+uint32_t get32lsb(const uint8_t *src) {
+    return (((uint32_t)(src[0])) << 0) | (((uint32_t)(src[1])) << 8) | (((uint32_t)(src[2])) << 16) |
+           (((uint32_t)(src[3])) << 24);
+}
+
+}  // namespace
+
+PCSX::EccEdc::EccEdc() {
+    size_t i;
+    for (i = 0; i < 256; i++) {
+        uint32_t edc = i;
+        size_t j = (i << 1) ^ (i & 0x80 ? 0x11D : 0);
+        m_ecc_f_lut[i] = j;
+        m_ecc_b_lut[i ^ j] = i;
+        for (j = 0; j < 8; j++) {
+            edc = (edc >> 1) ^ (edc & 1 ? 0xD8018001 : 0);
+        }
+        m_edc_lut[0][i] = edc;
+    }
+    // m_edc_lut[n][i] is the EDC of the byte i followed by n zeroes
+    for (i = 0; i < 256; i++) {
+        for (size_t n = 1; n < 8; n++) {
+            uint32_t edc = m_edc_lut[n - 1][i];
+            m_edc_lut[n][i] = (edc >> 8) ^ m_edc_lut[0][edc & 0xFF];
+        }
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+//
+// Compute EDC for a block
+//
+uint32_t PCSX::EccEdc::edc_compute(uint32_t edc, const uint8_t *src, size_t size) const {
+    // slicing by 8: the contributions of 8 bytes to the CRC are independent lookups
+    for (; size >= 8; size -= 8, src += 8) {
+        uint32_t lo = edc ^ get32lsb(src);
+        uint32_t hi = get32lsb(src + 4);
+        edc = m_edc_lut[7][lo & 0xFF] ^ m_edc_lut[6][(lo >> 8) & 0xFF] ^ m_edc_lut[5][(lo >> 16) & 0xFF] ^
+              m_edc_lut[4][lo >> 24] ^ m_edc_lut[3][hi & 0xFF] ^ m_edc_lut[2][(hi >> 8) & 0xFF] ^
+              m_edc_lut[1][(hi >> 16) & 0xFF] ^ m_edc_lut[0][hi >> 24];
+    }
+    for (; size; size--) {
+        edc = (edc >> 8) ^ m_edc_lut[0][(edc ^ (*src++)) & 0xFF];
+    }
+    return edc;
+}
+
+//
+// Write ECC block (either P or Q)
+//
+// Each major is a Horner evaluation over its minor_count bytes, independent from the other ones. The bytes
+// get laid out so that the same step of all the majors is one row, and the rows are then processed 16 majors
+// at a time, the multiplication by 2 in GF(2^8) being a shift and a conditional xor.
+void PCSX::EccEdc::ecc_writepq(const uint8_t *address, const uint8_t *data, size_t major_count, size_t minor_count,
+                               size_t major_mult, size_t minor_inc, uint8_t *ecc) const {
+    static const size_t STRIDE = 96;  // the largest major_count, rounded up to the vector size
+    const size_t size = major_count * minor_count;
+    uint8_t block[52 * 43 + STRIDE];  // the largest block, and what the vector loop reads past P
+    uint8_t gathered[43 * STRIDE];
+    uint8_t ecc_a[STRIDE];
+    uint8_t ecc_b[STRIDE];
+    const uint8_t *rows;
+    size_t stride;
+
+    memcpy(block, address, 4);
+    memcpy(block + 4, data, size - 4);
+    if (major_mult == 2 && minor_inc == major_count) {
+        // P: the bytes of one step are contiguous already
+        rows = block;
+        stride = major_count;
+    } else {
+        // Q runs along diagonals, which have to be gathered first
+        for (size_t major = 0; major < major_count; major++) {
+            size_t index = (major >> 1) * major_mult + (major & 1);
+            for (size_t minor = 0; minor < minor_count; minor++) {
+                gathered[minor * STRIDE + major] = block[index];
+                index += minor_inc;
+                if (index >= size) index -= size;
+            }
+        }
+        rows = gathered;
+        stride = STRIDE;
+    }
+
+#ifdef ECC_SSE2
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i poly = _mm_set1_epi8(0x1D);
+    for (size_t major = 0; major < major_count; major += 16) {
+        __m128i a = zero;
+        __m128i b = zero;
+        for (size_t minor = 0; minor < minor_count; minor++) {
+            __m128i temp = _mm_loadu_si128(reinterpret_cast<const __m128i *>(rows + minor * stride + major));
+            a = _mm_xor_si128(a, temp);
+            b = _mm_xor_si128(b, temp);
+            a = _mm_xor_si128(_mm_add_epi8(a, a), _mm_and_si128(_mm_cmplt_epi8(a, zero), poly));
+        }
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(ecc_a + major), a);
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(ecc_b + major), b);
+    }
+#else
+    memset(ecc_a, 0, major_count);
+    memset(ecc_b, 0, major_count);
+    for (size_t minor = 0; minor < minor_count; minor++) {
+        const uint8_t *row = rows + minor * stride;
+        for (size_t major = 0; major < major_count; major++) {
+            ecc_a[major] = m_ecc_f_lut[ecc_a[major] ^ row[major]];
+            ecc_b[major] ^= row[major];
+        }
+    }
+#endif
+
+    for (size_t major = 0; major < major_count; major++) {
+        uint8_t a = m_ecc_b_lut[m_ecc_f_lut[ecc_a[major]] ^ ecc_b[major]];
+        ecc[major] = a;
+        ecc[major + major_count] = a ^ ecc_b[major];
+    }
+}
+
+//
+// Write ECC P and Q codes for a sector
+//
+void PCSX::EccEdc::ecc_writesector(const uint8_t *address, const uint8_t *data, uint8_t *ecc) const {
+    ecc_writepq(address, data, 86, 24, 2, 86, ecc);          // P
+    ecc_writepq(address, data, 52, 43, 86, 88, ecc + 0xAC);  // Q
+}
@@ -0,0 +1,46 @@
+/*  PPF Patch Support for PCSX-Reloaded
+ *  Copyright (c) 2009, Wei Mingzhi <whistler_wmz@users.sf.net>.
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace PCSX {
+
+// The error detection and correction codes of mode 1 and mode 2 sectors, for the image formats that
+// drop them and leave them to be computed again when reading.
+class EccEdc {
+  public:
+    EccEdc();
+
+    // the EDC of size bytes, carrying on from edc; start with 0
+    uint32_t edc_compute(uint32_t edc, const uint8_t* src, size_t size) const;
+    // one of the two ECC blocks of a sector, over its 4 bytes address and the data that follows
+    void ecc_writepq(const uint8_t* address, const uint8_t* data, size_t major_count, size_t minor_count,
+                     size_t major_mult, size_t minor_inc, uint8_t* ecc) const;
+    // the P and Q blocks of a sector; mode 2 sectors compute them with a zero address
+    void ecc_writesector(const uint8_t* address, const uint8_t* data, uint8_t* ecc) const;
+
+  private:
+    uint8_t m_ecc_f_lut[256];
+    uint8_t m_ecc_b_lut[256];
+    uint32_t m_edc_lut[8][256];  // slicing by 8
+};
+
+}  // namespace PCSX
@@ -17,7 +17,6 @@
  */
 
 #include "core/gpu.h"
-#include "core/pgxp_mem.h"
 #include "core/psxdma.h"
 #include "core/psxhw.h"
 
@@ -107,7 +106,7 @@ void PCSX::GPU::dma(uint32_t madr, uint32_t bcr, uint32_t chcr) {  // GPU
             // BA blocks * BS words (word = 32-bits)
             size = (bcr >> 16) * (bcr & 0xffff);
             readDataMem(ptr, size);
-            PCSX::g_emulator.m_psxCpu->Clear(madr, size);
+            PCSX::g_emulator->m_psxCpu->Clear(madr, size);
 #if 1
             // already 32-bit word size ((size * 4) / 4)
             GPUDMA_INT(size);
@@ -127,7 +126,6 @@ void PCSX::GPU::dma(uint32_t madr, uint32_t bcr, uint32_t chcr) {  // GPU
                 PSXDMA_LOG("*** DMA2 GPU - mem2vram *** NULL Pointer!!!\n");
                 break;
             }
-            pgxpMemory(PGXP_ConvertAddress(madr), PGXP_GetMem());
             writeDataMem(ptr, size);
 
 #if 0
@@ -144,7 +142,7 @@ void PCSX::GPU::dma(uint32_t madr, uint32_t bcr, uint32_t chcr) {  // GPU
             PSXDMA_LOG("*** DMA 2 - GPU dma chain *** %8.8lx addr = %lx size = %lx\n", chcr, madr, bcr);
 
             size = gpuDmaChainSize(madr);
-            dmaChain((uint32_t *)PCSX::g_emulator.m_psxMem->g_psxM, madr & 0x1fffff);
+            dmaChain((uint32_t *)PCSX::g_emulator->m_psxMem->g_psxM, madr & 0x1fffff);
 
             // Tekken 3 = use 1.0 only (not 1.5x)
 
@@ -33,6 +33,7 @@ class GPU {
 
     virtual long init() = 0;
     virtual long shutdown() = 0;
+    // a null GUI runs headless: drawing only goes to VRAM, and nothing is presented nor throttled
     virtual long open(GUI*) = 0;
     virtual long close() = 0;
     virtual uint32_t readData() = 0;
@@ -57,7 +58,6 @@ class GPU {
     virtual void cursor(int player, int x, int y) {}
     virtual void addVertex(short sx, short sy, int64_t fx, int64_t fy, int64_t fz) {}
     virtual void setSpeed(float newSpeed) {}
-    virtual void pgxpMemory(unsigned int addr, unsigned char *pVRAM) {}
     virtual void pgxpCacheVertex(short sx, short sy, const unsigned char *_pVertex) {}
     virtual long test(void) { return 0; }
     virtual void about(void) {}
@@ -22,8 +22,8 @@
 #include "core/psxemulator.h"
 #include "core/r3000a.h"
 
-#define gteoB (PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.r[_Rs_] + _Imm_)
-#define gteop (PCSX::g_emulator.m_psxCpu->m_psxRegs.code & 0x1ffffff)
+#define gteoB (PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.r[_Rs_] + _Imm_)
+#define gteop (PCSX::g_emulator->m_psxCpu->m_psxRegs.code & 0x1ffffff)
 
 namespace PCSX {
 
@@ -32,17 +32,17 @@ class GTE {
     void MFC2() {
         // CPU[Rt] = GTE_D[Rd]
         if (!_Rt_) return;
-        PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.r[_Rt_] = MFC2_internal(_Rd_);
+        PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.r[_Rt_] = MFC2_internal(_Rd_);
     }
     void CFC2() {
         // CPU[Rt] = GTE_C[Rd]
         if (!_Rt_) return;
-        PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.r[_Rt_] = PCSX::g_emulator.m_psxCpu->m_psxRegs.CP2C.p[_Rd_].d;
+        PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.r[_Rt_] = PCSX::g_emulator->m_psxCpu->m_psxRegs.CP2C.p[_Rd_].d;
     }
-    void MTC2() { MTC2_internal(PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.r[_Rt_], _Rd_); }
-    void CTC2() { CTC2_internal(PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.r[_Rt_], _Rd_); }
-    void LWC2() { MTC2_internal(PCSX::g_emulator.m_psxMem->psxMemRead32(gteoB), _Rt_); }
-    void SWC2() { PCSX::g_emulator.m_psxMem->psxMemWrite32(gteoB, MFC2_internal(_Rt_)); }
+    void MTC2() { MTC2_internal(PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.r[_Rt_], _Rd_); }
+    void CTC2() { CTC2_internal(PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.r[_Rt_], _Rd_); }
+    void LWC2() { MTC2_internal(PCSX::g_emulator->m_psxMem->psxMemRead32(gteoB), _Rt_); }
+    void SWC2() { PCSX::g_emulator->m_psxMem->psxMemWrite32(gteoB, MFC2_internal(_Rt_)); }
 
     void RTPS() { docop2(gteop); }
     void NCLIP() { docop2(gteop); }
@@ -67,6 +67,11 @@ class GTE {
     void GPL() { docop2(gteop); }
     void NCCT() { docop2(gteop); }
 
+    // for the recompiler, which passes the opcode along rather than through m_psxRegs.code
+    void COP2(uint32_t op) { docop2(op); }
+    uint32_t MFC2_internal(int reg);
+    void MTC2_internal(uint32_t value, int reg);
+
   private:
     int s_sf;
     int64_t s_mac0;
@@ -79,8 +84,6 @@ class GTE {
     int64_t F(int64_t a);
     int docop2(int op);
 
-    uint32_t MFC2_internal(int reg);
-    void MTC2_internal(uint32_t value, int reg);
     void CTC2_internal(uint32_t value, int reg);
 };
 
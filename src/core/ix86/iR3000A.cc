@@ -55,24 +55,24 @@ void SysBiosPrintfWrapper(const char *fmt, ...) {
     PCSX::g_system->biosPrintf(fmt, a);
     va_end(a);
 }
-uint8_t psxMemRead8Wrapper(uint32_t mem) { return PCSX::g_emulator.m_psxMem->psxMemRead8(mem); }
-uint16_t psxMemRead16Wrapper(uint32_t mem) { return PCSX::g_emulator.m_psxMem->psxMemRead16(mem); }
-uint32_t psxMemRead32Wrapper(uint32_t mem) { return PCSX::g_emulator.m_psxMem->psxMemRead32(mem); }
-void psxMemWrite8Wrapper(uint32_t mem, uint8_t value) { PCSX::g_emulator.m_psxMem->psxMemWrite8(mem, value); }
-void psxMemWrite16Wrapper(uint32_t mem, uint16_t value) { PCSX::g_emulator.m_psxMem->psxMemWrite16(mem, value); }
-void psxMemWrite32Wrapper(uint32_t mem, uint32_t value) { PCSX::g_emulator.m_psxMem->psxMemWrite32(mem, value); }
-uint32_t psxRcntRcountWrapper(uint32_t index) { return PCSX::g_emulator.m_psxCounters->psxRcntRcount(index); }
-uint32_t psxRcntRmodeWrapper(uint32_t index) { return PCSX::g_emulator.m_psxCounters->psxRcntRmode(index); }
-uint32_t psxRcntRtargetWrapper(uint32_t index) { return PCSX::g_emulator.m_psxCounters->psxRcntRtarget(index); }
-
-unsigned long GPU_readDataWrapper() { return PCSX::g_emulator.m_gpu->readData(); }
-unsigned long GPU_readStatusWrapper() { return PCSX::g_emulator.m_gpu->readStatus(); }
-void GPU_writeDataWrapper(uint32_t gdata) { PCSX::g_emulator.m_gpu->writeData(gdata); }
-void GPU_writeStatusWrapper(unsigned long gdata) { PCSX::g_emulator.m_gpu->writeStatus(gdata); }
-
-unsigned short SPUreadRegisterWrapper(unsigned long addr) { return PCSX::g_emulator.m_spu->readRegister(addr); }
+uint8_t psxMemRead8Wrapper(uint32_t mem) { return PCSX::g_emulator->m_psxMem->psxMemRead8(mem); }
+uint16_t psxMemRead16Wrapper(uint32_t mem) { return PCSX::g_emulator->m_psxMem->psxMemRead16(mem); }
+uint32_t psxMemRead32Wrapper(uint32_t mem) { return PCSX::g_emulator->m_psxMem->psxMemRead32(mem); }
+void psxMemWrite8Wrapper(uint32_t mem, uint8_t value) { PCSX::g_emulator->m_psxMem->psxMemWrite8(mem, value); }
+void psxMemWrite16Wrapper(uint32_t mem, uint16_t value) { PCSX::g_emulator->m_psxMem->psxMemWrite16(mem, value); }
+void psxMemWrite32Wrapper(uint32_t mem, uint32_t value) { PCSX::g_emulator->m_psxMem->psxMemWrite32(mem, value); }
+uint32_t psxRcntRcountWrapper(uint32_t index) { return PCSX::g_emulator->m_psxCounters->psxRcntRcount(index); }
+uint32_t psxRcntRmodeWrapper(uint32_t index) { return PCSX::g_emulator->m_psxCounters->psxRcntRmode(index); }
+uint32_t psxRcntRtargetWrapper(uint32_t index) { return PCSX::g_emulator->m_psxCounters->psxRcntRtarget(index); }
+
+unsigned long GPU_readDataWrapper() { return PCSX::g_emulator->m_gpu->readData(); }
+unsigned long GPU_readStatusWrapper() { return PCSX::g_emulator->m_gpu->readStatus(); }
+void GPU_writeDataWrapper(uint32_t gdata) { PCSX::g_emulator->m_gpu->writeData(gdata); }
+void GPU_writeStatusWrapper(unsigned long gdata) { PCSX::g_emulator->m_gpu->writeStatus(gdata); }
+
+unsigned short SPUreadRegisterWrapper(unsigned long addr) { return PCSX::g_emulator->m_spu->readRegister(addr); }
 void SPUwriteRegisterWrapper(unsigned long addr, unsigned short value) {
-    PCSX::g_emulator.m_spu->writeRegister(addr, value);
+    PCSX::g_emulator->m_spu->writeRegister(addr, value);
 }
 
 #undef PC_REC
@@ -154,6 +154,7 @@ class X86DynaRecCPU : public PCSX::InterpretedCPU {
     static const func_t m_pgxpRecBSC[64];
     static const func_t m_pgxpRecSPC[64];
     static const func_t m_pgxpRecCP0[32];
+    static const func_t m_pgxpRecCP2[64];
     static const func_t m_pgxpRecCP2BSC[32];
     static const func_t m_pgxpRecBSCMem[64];
 
@@ -281,24 +282,35 @@ class X86DynaRecCPU : public PCSX::InterpretedCPU {
 
     void recRecompile();
 
-#define CP2_FUNC(f)                                                         \
-    static void gte##f##Wrapper() { PCSX::g_emulator.m_gte->f(); }          \
-    void rec##f() {                                                         \
-        iFlushRegs();                                                       \
-        gen.MOV32ItoM((uint32_t)&m_psxRegs.code, (uint32_t)m_psxRegs.code); \
-        gen.CALLFunc((uint32_t)gte##f##Wrapper);                            \
-        /*  branch = 2; */                                                  \
-    }
+    void iGteReadData(int reg);
+    void iGteWriteData(int reg);
+    void iGteLmB(int reg, int lm);
+    void iGteF();
+    void iGteAVSZ(int first, int zsf);
+    void iGteCall();
+
+    void recMFC2();
+    void recCFC2();
+    void recMTC2();
+    void recCTC2();
+    void recLWC2();
+    void recSWC2();
+    void recNCLIP();
+    void recOP();
+    void recSQR();
+    void recAVSZ3();
+    void recAVSZ4();
+
+    static uint32_t gteMFC2Wrapper(int reg) { return PCSX::g_emulator->m_gte->MFC2_internal(reg); }
+    static void gteMTC2Wrapper(uint32_t value, int reg) { PCSX::g_emulator->m_gte->MTC2_internal(value, reg); }
+    static void gteCOP2Wrapper(uint32_t op) { PCSX::g_emulator->m_gte->COP2(op); }
+
+    uint32_t m_gteTemp[2] = {0, 0};
+
+#define CP2_FUNC(f) \
+    void rec##f() { iGteCall(); }
 
-    CP2_FUNC(MFC2);
-    CP2_FUNC(MTC2);
-    CP2_FUNC(CFC2);
-    CP2_FUNC(CTC2);
-    CP2_FUNC(LWC2);
-    CP2_FUNC(SWC2);
     CP2_FUNC(RTPS);
-    CP2_FUNC(OP);
-    CP2_FUNC(NCLIP);
     CP2_FUNC(DPCS);
     CP2_FUNC(INTPL);
     CP2_FUNC(MVMVA);
@@ -309,16 +321,16 @@ class X86DynaRecCPU : public PCSX::InterpretedCPU {
     CP2_FUNC(CC);
     CP2_FUNC(NCS);
     CP2_FUNC(NCT);
-    CP2_FUNC(SQR);
     CP2_FUNC(DCPL);
     CP2_FUNC(DPCT);
-    CP2_FUNC(AVSZ3);
-    CP2_FUNC(AVSZ4);
     CP2_FUNC(RTPT);
     CP2_FUNC(GPF);
     CP2_FUNC(GPL);
     CP2_FUNC(NCCT);
 
+    // PGXP may replace the result with its own, computed from the precise vertices
+    void pgxpRecNCLIP() { iGteCall(); }
+
     /////////////////////////////////////////////
     // PGXP wrapper functions
     /////////////////////////////////////////////
@@ -1047,12 +1059,13 @@ void X86DynaRecCPU::recCOP0() {
 void X86DynaRecCPU::recCOP2() {
     gen.MOV32MtoR(PCSX::ix86::EAX, (uint32_t)&m_psxRegs.CP0.n.Status);
     gen.AND32ItoR(PCSX::ix86::EAX, 0x40000000);
-    unsigned slot = gen.JZ8(0);
+    // the inlined GTE operations don't fit in a short jump
+    unsigned slot = gen.JZ32(0);
 
     func_t func = m_pRecCP2[_Funct_];
     (*this.*func)();
 
-    gen.x86SetJ8(slot);
+    gen.x86SetJ32(slot);
 }
 
 void X86DynaRecCPU::recBASIC() {
@@ -1790,7 +1803,7 @@ void X86DynaRecCPU::recLB() {
             if (!_Rt_) return;
             m_iRegs[_Rt_].state = ST_UNK;
 
-            gen.MOVSX32M8toR(PCSX::ix86::EAX, (uint32_t)&PCSX::g_emulator.m_psxMem->g_psxM[addr & 0x1fffff]);
+            gen.MOVSX32M8toR(PCSX::ix86::EAX, (uint32_t)&PCSX::g_emulator->m_psxMem->g_psxM[addr & 0x1fffff]);
             gen.MOV32RtoM((uint32_t)&m_psxRegs.GPR.r[_Rt_], PCSX::ix86::EAX);
             return;
         }
@@ -1798,7 +1811,7 @@ void X86DynaRecCPU::recLB() {
             if (!_Rt_) return;
             m_iRegs[_Rt_].state = ST_UNK;
 
-            gen.MOVSX32M8toR(PCSX::ix86::EAX, (uint32_t)&PCSX::g_emulator.m_psxMem->g_psxH[addr & 0xfff]);
+            gen.MOVSX32M8toR(PCSX::ix86::EAX, (uint32_t)&PCSX::g_emulator->m_psxMem->g_psxH[addr & 0xfff]);
             gen.MOV32RtoM((uint32_t)&m_psxRegs.GPR.r[_Rt_], PCSX::ix86::EAX);
             return;
         }
@@ -1835,7 +1848,7 @@ void X86DynaRecCPU::recLBU() {
             if (!_Rt_) return;
             m_iRegs[_Rt_].state = ST_UNK;
 
-            gen.MOVZX32M8toR(PCSX::ix86::EAX, (uint32_t)&PCSX::g_emulator.m_psxMem->g_psxM[addr & 0x1fffff]);
+            gen.MOVZX32M8toR(PCSX::ix86::EAX, (uint32_t)&PCSX::g_emulator->m_psxMem->g_psxM[addr & 0x1fffff]);
             gen.MOV32RtoM((uint32_t)&m_psxRegs.GPR.r[_Rt_], PCSX::ix86::EAX);
             return;
         }
@@ -1843,7 +1856,7 @@ void X86DynaRecCPU::recLBU() {
             if (!_Rt_) return;
             m_iRegs[_Rt_].state = ST_UNK;
 
-            gen.MOVZX32M8toR(PCSX::ix86::EAX, (uint32_t)&PCSX::g_emulator.m_psxMem->g_psxH[addr & 0xfff]);
+            gen.MOVZX32M8toR(PCSX::ix86::EAX, (uint32_t)&PCSX::g_emulator->m_psxMem->g_psxH[addr & 0xfff]);
             gen.MOV32RtoM((uint32_t)&m_psxRegs.GPR.r[_Rt_], PCSX::ix86::EAX);
             return;
         }
@@ -1880,7 +1893,7 @@ void X86DynaRecCPU::recLH() {
             if (!_Rt_) return;
             m_iRegs[_Rt_].state = ST_UNK;
 
-            gen.MOVSX32M16toR(PCSX::ix86::EAX, (uint32_t)&PCSX::g_emulator.m_psxMem->g_psxM[addr & 0x1fffff]);
+            gen.MOVSX32M16toR(PCSX::ix86::EAX, (uint32_t)&PCSX::g_emulator->m_psxMem->g_psxM[addr & 0x1fffff]);
             gen.MOV32RtoM((uint32_t)&m_psxRegs.GPR.r[_Rt_], PCSX::ix86::EAX);
             return;
         }
@@ -1888,7 +1901,7 @@ void X86DynaRecCPU::recLH() {
             if (!_Rt_) return;
             m_iRegs[_Rt_].state = ST_UNK;
 
-            gen.MOVSX32M16toR(PCSX::ix86::EAX, (uint32_t)&PCSX::g_emulator.m_psxMem->g_psxH[addr & 0xfff]);
+            gen.MOVSX32M16toR(PCSX::ix86::EAX, (uint32_t)&PCSX::g_emulator->m_psxMem->g_psxH[addr & 0xfff]);
             gen.MOV32RtoM((uint32_t)&m_psxRegs.GPR.r[_Rt_], PCSX::ix86::EAX);
             return;
         }
@@ -1925,7 +1938,7 @@ void X86DynaRecCPU::recLHU() {
             if (!_Rt_) return;
             m_iRegs[_Rt_].state = ST_UNK;
 
-            gen.MOVZX32M16toR(PCSX::ix86::EAX, (uint32_t)&PCSX::g_emulator.m_psxMem->g_psxM[addr & 0x1fffff]);
+            gen.MOVZX32M16toR(PCSX::ix86::EAX, (uint32_t)&PCSX::g_emulator->m_psxMem->g_psxM[addr & 0x1fffff]);
             gen.MOV32RtoM((uint32_t)&m_psxRegs.GPR.r[_Rt_], PCSX::ix86::EAX);
             return;
         }
@@ -1933,7 +1946,7 @@ void X86DynaRecCPU::recLHU() {
             if (!_Rt_) return;
             m_iRegs[_Rt_].state = ST_UNK;
 
-            gen.MOVZX32M16toR(PCSX::ix86::EAX, (uint32_t)&PCSX::g_emulator.m_psxMem->g_psxH[addr & 0xfff]);
+            gen.MOVZX32M16toR(PCSX::ix86::EAX, (uint32_t)&PCSX::g_emulator->m_psxMem->g_psxH[addr & 0xfff]);
             gen.MOV32RtoM((uint32_t)&m_psxRegs.GPR.r[_Rt_], PCSX::ix86::EAX);
             return;
         }
@@ -2025,7 +2038,7 @@ void X86DynaRecCPU::recLW() {
             if (!_Rt_) return;
             m_iRegs[_Rt_].state = ST_UNK;
 
-            gen.MOV32MtoR(PCSX::ix86::EAX, (uint32_t)&PCSX::g_emulator.m_psxMem->g_psxM[addr & 0x1fffff]);
+            gen.MOV32MtoR(PCSX::ix86::EAX, (uint32_t)&PCSX::g_emulator->m_psxMem->g_psxM[addr & 0x1fffff]);
             gen.MOV32RtoM((uint32_t)&m_psxRegs.GPR.r[_Rt_], PCSX::ix86::EAX);
             return;
         }
@@ -2033,7 +2046,7 @@ void X86DynaRecCPU::recLW() {
             if (!_Rt_) return;
             m_iRegs[_Rt_].state = ST_UNK;
 
-            gen.MOV32MtoR(PCSX::ix86::EAX, (uint32_t)&PCSX::g_emulator.m_psxMem->g_psxH[addr & 0xfff]);
+            gen.MOV32MtoR(PCSX::ix86::EAX, (uint32_t)&PCSX::g_emulator->m_psxMem->g_psxH[addr & 0xfff]);
             gen.MOV32RtoM((uint32_t)&m_psxRegs.GPR.r[_Rt_], PCSX::ix86::EAX);
             return;
         }
@@ -2067,7 +2080,7 @@ void X86DynaRecCPU::recLW() {
                     if (!_Rt_) return;
                     m_iRegs[_Rt_].state = ST_UNK;
 
-                    gen.MOV32MtoR(PCSX::ix86::EAX, (uint32_t)&PCSX::g_emulator.m_psxMem->g_psxH[addr & 0xffff]);
+                    gen.MOV32MtoR(PCSX::ix86::EAX, (uint32_t)&PCSX::g_emulator->m_psxMem->g_psxH[addr & 0xffff]);
                     gen.MOV32RtoM((uint32_t)&m_psxRegs.GPR.r[_Rt_], PCSX::ix86::EAX);
                     return;
 
@@ -2120,7 +2133,7 @@ void X86DynaRecCPU::recLWL() {
         int t = addr >> 16;
 
         if ((t & 0x1fe0) == 0) {
-            gen.MOV32MtoR(PCSX::ix86::EAX, (uint32_t)&PCSX::g_emulator.m_psxMem->g_psxM[addr & 0x1ffffc]);
+            gen.MOV32MtoR(PCSX::ix86::EAX, (uint32_t)&PCSX::g_emulator->m_psxMem->g_psxM[addr & 0x1ffffc]);
             iLWLk(addr & 3);
 
             m_iRegs[_Rt_].state = ST_UNK;
@@ -2128,7 +2141,7 @@ void X86DynaRecCPU::recLWL() {
             return;
         }
         if (t == 0x1f80 && addr < 0x1f801000) {
-            gen.MOV32MtoR(PCSX::ix86::EAX, (uint32_t)&PCSX::g_emulator.m_psxMem->g_psxH[addr & 0xffc]);
+            gen.MOV32MtoR(PCSX::ix86::EAX, (uint32_t)&PCSX::g_emulator->m_psxMem->g_psxH[addr & 0xffc]);
             iLWLk(addr & 3);
 
             m_iRegs[_Rt_].state = ST_UNK;
@@ -2203,7 +2216,7 @@ void X86DynaRecCPU::recLWL() {
                     return;
                 m_iRegs[_fRt_(*code)].state = ST_UNK;
 
-                gen.MOV32MtoR(PCSX::ix86::EAX, (uint32_t)&PCSX::g_emulator.m_psxMem->g_psxM[addr & 0x1fffff]);
+                gen.MOV32MtoR(PCSX::ix86::EAX, (uint32_t)&PCSX::g_emulator->m_psxMem->g_psxM[addr & 0x1fffff]);
                 gen.MOV32RtoM((uint32_t)&m_psxRegs.GPR.r[_fRt_(*code)], PCSX::ix86::EAX);
             }
             return;
@@ -2272,7 +2285,7 @@ void X86DynaRecCPU::recLWR() {
         int t = addr >> 16;
 
         if ((t & 0x1fe0) == 0) {
-            gen.MOV32MtoR(PCSX::ix86::EAX, (uint32_t)&PCSX::g_emulator.m_psxMem->g_psxM[addr & 0x1ffffc]);
+            gen.MOV32MtoR(PCSX::ix86::EAX, (uint32_t)&PCSX::g_emulator->m_psxMem->g_psxM[addr & 0x1ffffc]);
             iLWRk(addr & 3);
 
             m_iRegs[_Rt_].state = ST_UNK;
@@ -2280,7 +2293,7 @@ void X86DynaRecCPU::recLWR() {
             return;
         }
         if (t == 0x1f80 && addr < 0x1f801000) {
-            gen.MOV32MtoR(PCSX::ix86::EAX, (uint32_t)&PCSX::g_emulator.m_psxMem->g_psxH[addr & 0xffc]);
+            gen.MOV32MtoR(PCSX::ix86::EAX, (uint32_t)&PCSX::g_emulator->m_psxMem->g_psxH[addr & 0xffc]);
             iLWRk(addr & 3);
 
             m_iRegs[_Rt_].state = ST_UNK;
@@ -2340,10 +2353,10 @@ void X86DynaRecCPU::recSB() {
 
         if ((t & 0x1fe0) == 0 && (t & 0x1fff) != 0) {
             if (IsConst(_Rt_)) {
-                gen.MOV8ItoM((uint32_t)&PCSX::g_emulator.m_psxMem->g_psxM[addr & 0x1fffff], (uint8_t)m_iRegs[_Rt_].k);
+                gen.MOV8ItoM((uint32_t)&PCSX::g_emulator->m_psxMem->g_psxM[addr & 0x1fffff], (uint8_t)m_iRegs[_Rt_].k);
             } else {
                 gen.MOV8MtoR(PCSX::ix86::EAX, (uint32_t)&m_psxRegs.GPR.r[_Rt_]);
-                gen.MOV8RtoM((uint32_t)&PCSX::g_emulator.m_psxMem->g_psxM[addr & 0x1fffff], PCSX::ix86::EAX);
+                gen.MOV8RtoM((uint32_t)&PCSX::g_emulator->m_psxMem->g_psxM[addr & 0x1fffff], PCSX::ix86::EAX);
             }
 
             gen.PUSH32I(1);
@@ -2356,10 +2369,10 @@ void X86DynaRecCPU::recSB() {
 
         if (t == 0x1f80 && addr < 0x1f801000) {
             if (IsConst(_Rt_)) {
-                gen.MOV8ItoM((uint32_t)&PCSX::g_emulator.m_psxMem->g_psxH[addr & 0xfff], (uint8_t)m_iRegs[_Rt_].k);
+                gen.MOV8ItoM((uint32_t)&PCSX::g_emulator->m_psxMem->g_psxH[addr & 0xfff], (uint8_t)m_iRegs[_Rt_].k);
             } else {
                 gen.MOV8MtoR(PCSX::ix86::EAX, (uint32_t)&m_psxRegs.GPR.r[_Rt_]);
-                gen.MOV8RtoM((uint32_t)&PCSX::g_emulator.m_psxMem->g_psxH[addr & 0xfff], PCSX::ix86::EAX);
+                gen.MOV8RtoM((uint32_t)&PCSX::g_emulator->m_psxMem->g_psxH[addr & 0xfff], PCSX::ix86::EAX);
             }
             return;
         }
@@ -2388,10 +2401,11 @@ void X86DynaRecCPU::recSH() {
 
         if ((t & 0x1fe0) == 0 && (t & 0x1fff) != 0) {
             if (IsConst(_Rt_)) {
-                gen.MOV16ItoM((uint32_t)&PCSX::g_emulator.m_psxMem->g_psxM[addr & 0x1fffff], (uint16_t)m_iRegs[_Rt_].k);
+                gen.MOV16ItoM((uint32_t)&PCSX::g_emulator->m_psxMem->g_psxM[addr & 0x1fffff],
+                              (uint16_t)m_iRegs[_Rt_].k);
             } else {
                 gen.MOV16MtoR(PCSX::ix86::EAX, (uint32_t)&m_psxRegs.GPR.r[_Rt_]);
-                gen.MOV16RtoM((uint32_t)&PCSX::g_emulator.m_psxMem->g_psxM[addr & 0x1fffff], PCSX::ix86::EAX);
+                gen.MOV16RtoM((uint32_t)&PCSX::g_emulator->m_psxMem->g_psxM[addr & 0x1fffff], PCSX::ix86::EAX);
             }
 
             gen.PUSH32I(1);
@@ -2404,10 +2418,10 @@ void X86DynaRecCPU::recSH() {
 
         if (t == 0x1f80 && addr < 0x1f801000) {
             if (IsConst(_Rt_)) {
-                gen.MOV16ItoM((uint32_t)&PCSX::g_emulator.m_psxMem->g_psxH[addr & 0xfff], (uint16_t)m_iRegs[_Rt_].k);
+                gen.MOV16ItoM((uint32_t)&PCSX::g_emulator->m_psxMem->g_psxH[addr & 0xfff], (uint16_t)m_iRegs[_Rt_].k);
             } else {
                 gen.MOV16MtoR(PCSX::ix86::EAX, (uint32_t)&m_psxRegs.GPR.r[_Rt_]);
-                gen.MOV16RtoM((uint32_t)&PCSX::g_emulator.m_psxMem->g_psxH[addr & 0xfff], PCSX::ix86::EAX);
+                gen.MOV16RtoM((uint32_t)&PCSX::g_emulator->m_psxMem->g_psxH[addr & 0xfff], PCSX::ix86::EAX);
             }
             return;
         }
@@ -2449,10 +2463,10 @@ void X86DynaRecCPU::recSW() {
 
         if ((t & 0x1fe0) == 0 && (t & 0x1fff) != 0) {
             if (IsConst(_Rt_)) {
-                gen.MOV32ItoM((uint32_t)&PCSX::g_emulator.m_psxMem->g_psxM[addr & 0x1fffff], m_iRegs[_Rt_].k);
+                gen.MOV32ItoM((uint32_t)&PCSX::g_emulator->m_psxMem->g_psxM[addr & 0x1fffff], m_iRegs[_Rt_].k);
             } else {
                 gen.MOV32MtoR(PCSX::ix86::EAX, (uint32_t)&m_psxRegs.GPR.r[_Rt_]);
-                gen.MOV32RtoM((uint32_t)&PCSX::g_emulator.m_psxMem->g_psxM[addr & 0x1fffff], PCSX::ix86::EAX);
+                gen.MOV32RtoM((uint32_t)&PCSX::g_emulator->m_psxMem->g_psxM[addr & 0x1fffff], PCSX::ix86::EAX);
             }
 
             gen.PUSH32I(1);
@@ -2465,10 +2479,10 @@ void X86DynaRecCPU::recSW() {
 
         if (t == 0x1f80 && addr < 0x1f801000) {
             if (IsConst(_Rt_)) {
-                gen.MOV32ItoM((uint32_t)&PCSX::g_emulator.m_psxMem->g_psxH[addr & 0xfff], m_iRegs[_Rt_].k);
+                gen.MOV32ItoM((uint32_t)&PCSX::g_emulator->m_psxMem->g_psxH[addr & 0xfff], m_iRegs[_Rt_].k);
             } else {
                 gen.MOV32MtoR(PCSX::ix86::EAX, (uint32_t)&m_psxRegs.GPR.r[_Rt_]);
-                gen.MOV32RtoM((uint32_t)&PCSX::g_emulator.m_psxMem->g_psxH[addr & 0xfff], PCSX::ix86::EAX);
+                gen.MOV32RtoM((uint32_t)&PCSX::g_emulator->m_psxMem->g_psxH[addr & 0xfff], PCSX::ix86::EAX);
             }
             return;
         }
@@ -2491,10 +2505,10 @@ void X86DynaRecCPU::recSW() {
                 case 0x1f801074:
                 case 0x1f8010f0:
                     if (IsConst(_Rt_)) {
-                        gen.MOV32ItoM((uint32_t)&PCSX::g_emulator.m_psxMem->g_psxH[addr & 0xffff], m_iRegs[_Rt_].k);
+                        gen.MOV32ItoM((uint32_t)&PCSX::g_emulator->m_psxMem->g_psxH[addr & 0xffff], m_iRegs[_Rt_].k);
                     } else {
                         gen.MOV32MtoR(PCSX::ix86::EAX, (uint32_t)&m_psxRegs.GPR.r[_Rt_]);
-                        gen.MOV32RtoM((uint32_t)&PCSX::g_emulator.m_psxMem->g_psxH[addr & 0xffff], PCSX::ix86::EAX);
+                        gen.MOV32RtoM((uint32_t)&PCSX::g_emulator->m_psxMem->g_psxH[addr & 0xffff], PCSX::ix86::EAX);
                     }
                     return;
 
@@ -2550,10 +2564,10 @@ void X86DynaRecCPU::recSW() {
         if ((t & 0x1fe0) == 0 && (t & 0x1fff) != 0) {
             for (i = 0; i < count; i++, code++, addr += 4) {
                 if (IsConst(_fRt_(*code))) {
-                    gen.MOV32ItoM((uint32_t)&PCSX::g_emulator.m_psxMem->g_psxM[addr & 0x1fffff], m_iRegs[_fRt_(*code)].k);
+                    gen.MOV32ItoM((uint32_t)&PCSX::g_emulator->m_psxMem->g_psxM[addr & 0x1fffff], m_iRegs[_fRt_(*code)].k);
                 } else {
                     gen.MOV32MtoR(PCSX::ix86::EAX, (uint32_t)&m_psxRegs.GPR.r[_fRt_(*code)]);
-                    gen.MOV32RtoM((uint32_t)&PCSX::g_emulator.m_psxMem->g_psxM[addr & 0x1fffff], PCSX::ix86::EAX);
+                    gen.MOV32RtoM((uint32_t)&PCSX::g_emulator->m_psxMem->g_psxM[addr & 0x1fffff], PCSX::ix86::EAX);
                 }
             }
             return;
@@ -2624,16 +2638,16 @@ void X86DynaRecCPU::recSWL() {
 
 #if 0
         if ((t & 0x1fe0) == 0 && (t & 0x1fff) != 0) {
-            gen.MOV32MtoR(PCSX::ix86::EAX, (uint32_t)&PCSX::g_emulator.m_psxMem->g_psxM[addr & 0x1ffffc]);
+            gen.MOV32MtoR(PCSX::ix86::EAX, (uint32_t)&PCSX::g_emulator->m_psxMem->g_psxM[addr & 0x1ffffc]);
             iSWLk(addr & 3);
-            gen.MOV32RtoM((uint32_t)&PCSX::g_emulator.m_psxMem->g_psxM[addr & 0x1ffffc], PCSX::ix86::EAX);
+            gen.MOV32RtoM((uint32_t)&PCSX::g_emulator->m_psxMem->g_psxM[addr & 0x1ffffc], PCSX::ix86::EAX);
             return;
         }
 #endif
         if (t == 0x1f80 && addr < 0x1f801000) {
-            gen.MOV32MtoR(PCSX::ix86::EAX, (uint32_t)&PCSX::g_emulator.m_psxMem->g_psxH[addr & 0xffc]);
+            gen.MOV32MtoR(PCSX::ix86::EAX, (uint32_t)&PCSX::g_emulator->m_psxMem->g_psxH[addr & 0xffc]);
             iSWLk(addr & 3);
-            gen.MOV32RtoM((uint32_t)&PCSX::g_emulator.m_psxMem->g_psxH[addr & 0xffc], PCSX::ix86::EAX);
+            gen.MOV32RtoM((uint32_t)&PCSX::g_emulator->m_psxMem->g_psxH[addr & 0xffc], PCSX::ix86::EAX);
             return;
         }
     }
@@ -2704,16 +2718,16 @@ void X86DynaRecCPU::recSWR() {
 
 #if 0
         if ((t & 0x1fe0) == 0 && (t & 0x1fff) != 0) {
-            gen.MOV32MtoR(PCSX::ix86::EAX, (uint32_t)&PCSX::g_emulator.m_psxMem->g_psxM[addr & 0x1ffffc]);
+            gen.MOV32MtoR(PCSX::ix86::EAX, (uint32_t)&PCSX::g_emulator->m_psxMem->g_psxM[addr & 0x1ffffc]);
             iSWRk(addr & 3);
-            gen.MOV32RtoM((uint32_t)&PCSX::g_emulator.m_psxMem->g_psxM[addr & 0x1ffffc], PCSX::ix86::EAX);
+            gen.MOV32RtoM((uint32_t)&PCSX::g_emulator->m_psxMem->g_psxM[addr & 0x1ffffc], PCSX::ix86::EAX);
             return;
         }
 #endif
         if (t == 0x1f80 && addr < 0x1f801000) {
-            gen.MOV32MtoR(PCSX::ix86::EAX, (uint32_t)&PCSX::g_emulator.m_psxMem->g_psxH[addr & 0xffc]);
+            gen.MOV32MtoR(PCSX::ix86::EAX, (uint32_t)&PCSX::g_emulator->m_psxMem->g_psxH[addr & 0xffc]);
             iSWRk(addr & 3);
-            gen.MOV32RtoM((uint32_t)&PCSX::g_emulator.m_psxMem->g_psxH[addr & 0xffc], PCSX::ix86::EAX);
+            gen.MOV32RtoM((uint32_t)&PCSX::g_emulator->m_psxMem->g_psxH[addr & 0xffc], PCSX::ix86::EAX);
             return;
         }
     }
@@ -3343,12 +3357,339 @@ void X86DynaRecCPU::recRFE() {
     }
 }
 
+/*********************************************************
+ * Coprocessor 2 (GTE)                                    *
+ * Register moves and the simple operations are inlined,  *
+ * the rest is called into the interpreter.               *
+ *********************************************************/
+
+#define GTE_DATA(reg) ((uint32_t)&m_psxRegs.CP2D.r[reg])
+#define GTE_CTRL(reg) ((uint32_t)&m_psxRegs.CP2C.r[reg])
+
+// EAX = Cop2D->reg, with the side effects of GTE::MFC2_internal
+void X86DynaRecCPU::iGteReadData(int reg) {
+    switch (reg) {
+        case 1:
+        case 3:
+        case 5:
+        case 8:
+        case 9:
+        case 10:
+        case 11:
+            gen.MOVSX32M16toR(PCSX::ix86::EAX, GTE_DATA(reg));
+            gen.MOV32RtoM(GTE_DATA(reg), PCSX::ix86::EAX);
+            break;
+
+        case 7:
+        case 16:
+        case 17:
+        case 18:
+        case 19:
+            gen.MOVZX32M16toR(PCSX::ix86::EAX, GTE_DATA(reg));
+            gen.MOV32RtoM(GTE_DATA(reg), PCSX::ix86::EAX);
+            break;
+
+        case 15:
+            gen.MOV32MtoR(PCSX::ix86::EAX, GTE_DATA(14));
+            gen.MOV32RtoM(GTE_DATA(15), PCSX::ix86::EAX);
+            break;
+
+        case 28:
+        case 29:
+            // packs the saturated IR1-3
+            gen.PUSH32I(reg);
+            gen.CALLFunc((uint32_t)gteMFC2Wrapper);
+            gen.ADD32ItoR(PCSX::ix86::ESP, 4);
+            break;
+
+        default:
+            gen.MOV32MtoR(PCSX::ix86::EAX, GTE_DATA(reg));
+            break;
+    }
+}
+
+// Cop2D->reg = EAX, with the side effects of GTE::MTC2_internal
+void X86DynaRecCPU::iGteWriteData(int reg) {
+    switch (reg) {
+        case 15:
+            // pushes onto the screen XY FIFO
+            gen.MOV32MtoR(PCSX::ix86::ECX, GTE_DATA(13));
+            gen.MOV32RtoM(GTE_DATA(12), PCSX::ix86::ECX);
+            gen.MOV32MtoR(PCSX::ix86::ECX, GTE_DATA(14));
+            gen.MOV32RtoM(GTE_DATA(13), PCSX::ix86::ECX);
+            gen.MOV32RtoM(GTE_DATA(14), PCSX::ix86::EAX);
+            gen.MOV32RtoM(GTE_DATA(15), PCSX::ix86::EAX);
+            break;
+
+        case 28:
+        case 30:
+            // unpacks into IR1-3, or counts the leading bits into LZCR
+            gen.PUSH32I(reg);
+            gen.PUSH32R(PCSX::ix86::EAX);
+            gen.CALLFunc((uint32_t)gteMTC2Wrapper);
+            gen.ADD32ItoR(PCSX::ix86::ESP, 8);
+            break;
+
+        case 31:
+            // LZCR is read only
+            break;
+
+        default:
+            gen.MOV32RtoM(GTE_DATA(reg), PCSX::ix86::EAX);
+            break;
+    }
+}
+
+// IRn = Lm_Bn(EAX)
+void X86DynaRecCPU::iGteLmB(int n, int lm) {
+    static const uint32_t flags[3] = {(1u << 31) | (1 << 24), (1u << 31) | (1 << 23), (1 << 22)};
+    const int32_t min = lm ? 0 : -0x8000;
+
+    gen.CMP32ItoR(PCSX::ix86::EAX, 0x7fff);
+    unsigned belowMax = gen.JLE8(0);
+    gen.MOV32ItoR(PCSX::ix86::EAX, 0x7fff);
+    gen.OR32ItoM(GTE_CTRL(31), flags[n - 1]);
+    unsigned done = gen.JMP8(0);
+
+    gen.x86SetJ8(belowMax);
+    gen.CMP32ItoR(PCSX::ix86::EAX, min);
+    unsigned aboveMin = gen.JGE8(0);
+    gen.MOV32ItoR(PCSX::ix86::EAX, min);
+    gen.OR32ItoM(GTE_CTRL(31), flags[n - 1]);
+
+    gen.x86SetJ8(aboveMin);
+    gen.x86SetJ8(done);
+    gen.MOV16RtoM(GTE_DATA(8 + n), PCSX::ix86::EAX);
+}
+
+// MAC0 = F(EDX:EAX), leaving EDX:EAX as it is
+void X86DynaRecCPU::iGteF() {
+    gen.MOV32RtoM(GTE_DATA(24), PCSX::ix86::EAX);
+    gen.MOV32RtoR(PCSX::ix86::ECX, PCSX::ix86::EAX);
+    gen.SAR32ItoR(PCSX::ix86::ECX, 31);
+    gen.CMP32RtoR(PCSX::ix86::ECX, PCSX::ix86::EDX);
+    unsigned fits = gen.JE8(0);
+    gen.TEST32RtoR(PCSX::ix86::EDX, PCSX::ix86::EDX);
+    unsigned negative = gen.JL8(0);
+    gen.OR32ItoM(GTE_CTRL(31), (1 << 31) | (1 << 16));
+    unsigned done = gen.JMP8(0);
+
+    gen.x86SetJ8(negative);
+    gen.OR32ItoM(GTE_CTRL(31), (1 << 31) | (1 << 15));
+
+    gen.x86SetJ8(fits);
+    gen.x86SetJ8(done);
+}
+
+// The other operations only touch the GTE registers, so the GPRs don't need flushing,
+// and the opcode is passed along instead of going through m_psxRegs.code.
+void X86DynaRecCPU::iGteCall() {
+    gen.PUSH32I(m_psxRegs.code & 0x1ffffff);
+    gen.CALLFunc((uint32_t)gteCOP2Wrapper);
+    gen.ADD32ItoR(PCSX::ix86::ESP, 4);
+}
+
+void X86DynaRecCPU::recMFC2() {
+    // Rt = Cop2D->Rd
+    if (!_Rt_) return;
+
+    iGteReadData(_Rd_);
+    m_iRegs[_Rt_].state = ST_UNK;
+    gen.MOV32RtoM((uint32_t)&m_psxRegs.GPR.r[_Rt_], PCSX::ix86::EAX);
+}
+
+void X86DynaRecCPU::recCFC2() {
+    // Rt = Cop2C->Rd
+    if (!_Rt_) return;
+
+    m_iRegs[_Rt_].state = ST_UNK;
+    gen.MOV32MtoR(PCSX::ix86::EAX, GTE_CTRL(_Rd_));
+    gen.MOV32RtoM((uint32_t)&m_psxRegs.GPR.r[_Rt_], PCSX::ix86::EAX);
+}
+
+void X86DynaRecCPU::recMTC2() {
+    // Cop2D->Rd = Rt
+    CPU_REG(_Rt_);
+    iGteWriteData(_Rd_);
+}
+
+void X86DynaRecCPU::recCTC2() {
+    // Cop2C->Rd = Rt
+    if (IsConst(_Rt_)) {
+        uint32_t value = m_iRegs[_Rt_].k;
+        switch (_Rd_) {
+            case 4:
+            case 12:
+            case 20:
+            case 26:
+            case 27:
+            case 29:
+            case 30:
+                value = (int32_t)(int16_t)value;
+                break;
+
+            case 31:
+                value = value & 0x7ffff000;
+                if ((value & 0x7f87e000) != 0) value |= 0x80000000;
+                break;
+        }
+        gen.MOV32ItoM(GTE_CTRL(_Rd_), value);
+        return;
+    }
+
+    switch (_Rd_) {
+        case 4:
+        case 12:
+        case 20:
+        case 26:
+        case 27:
+        case 29:
+        case 30:
+            gen.MOVSX32M16toR(PCSX::ix86::EAX, (uint32_t)&m_psxRegs.GPR.r[_Rt_]);
+            break;
+
+        case 31: {
+            gen.MOV32MtoR(PCSX::ix86::EAX, (uint32_t)&m_psxRegs.GPR.r[_Rt_]);
+            gen.AND32ItoR(PCSX::ix86::EAX, 0x7ffff000);
+            gen.TEST32ItoR(PCSX::ix86::EAX, 0x7f87e000);
+            unsigned slot = gen.JZ8(0);
+            gen.OR32ItoR(PCSX::ix86::EAX, 0x80000000);
+            gen.x86SetJ8(slot);
+            break;
+        }
+
+        default:
+            gen.MOV32MtoR(PCSX::ix86::EAX, (uint32_t)&m_psxRegs.GPR.r[_Rt_]);
+            break;
+    }
+    gen.MOV32RtoM(GTE_CTRL(_Rd_), PCSX::ix86::EAX);
+}
+
+void X86DynaRecCPU::recLWC2() {
+    // Cop2D->Rt = mem[Rs + Im]
+    iPushOfB();
+    gen.CALLFunc((uint32_t)psxMemRead32Wrapper);
+    m_resp += 4;
+    iGteWriteData(_Rt_);
+}
+
+void X86DynaRecCPU::recSWC2() {
+    // mem[Rs + Im] = Cop2D->Rt
+    iGteReadData(_Rt_);
+    gen.PUSH32R(PCSX::ix86::EAX);
+    iPushOfB();
+    gen.CALLFunc((uint32_t)psxMemWrite32Wrapper);
+    m_resp += 8;
+}
+
+void X86DynaRecCPU::recNCLIP() {
+    // MAC0 = SX0 * (SY1 - SY2) + SX1 * (SY2 - SY0) + SX2 * (SY0 - SY1)
+    // every term fits in 32 bits, but not their sum
+    gen.MOV32ItoM(GTE_CTRL(31), 0);
+    for (int i = 0; i < 3; i++) {
+        gen.MOVSX32M16toR(PCSX::ix86::EAX, GTE_DATA(12 + (i + 1) % 3) + 2);
+        gen.MOVSX32M16toR(PCSX::ix86::ECX, GTE_DATA(12 + (i + 2) % 3) + 2);
+        gen.SUB32RtoR(PCSX::ix86::EAX, PCSX::ix86::ECX);
+        gen.MOVSX32M16toR(PCSX::ix86::ECX, GTE_DATA(12 + i));
+        gen.IMUL32R(PCSX::ix86::ECX);
+        if (i != 0) {
+            gen.ADD32MtoR(PCSX::ix86::EAX, (uint32_t)&m_gteTemp[0]);
+            gen.ADC32MtoR(PCSX::ix86::EDX, (uint32_t)&m_gteTemp[1]);
+        }
+        if (i != 2) {
+            gen.MOV32RtoM((uint32_t)&m_gteTemp[0], PCSX::ix86::EAX);
+            gen.MOV32RtoM((uint32_t)&m_gteTemp[1], PCSX::ix86::EDX);
+        }
+    }
+    iGteF();
+}
+
+void X86DynaRecCPU::recOP() {
+    // MAC = (R11 R22 R33) x IR, IR = Lm_B(MAC)
+    // the products are 16 bits by 16 bits, and their differences can't overflow 32 bits
+    const int sf = (m_psxRegs.code >> 19) & 1;
+    const int lm = (m_psxRegs.code >> 10) & 1;
+    static const int diagonal[3] = {0, 2, 4};
+
+    gen.MOV32ItoM(GTE_CTRL(31), 0);
+    for (int i = 0; i < 3; i++) {
+        const int a = (i + 1) % 3, b = (i + 2) % 3;
+        gen.MOVSX32M16toR(PCSX::ix86::EAX, GTE_CTRL(diagonal[a]));
+        gen.MOVSX32M16toR(PCSX::ix86::ECX, GTE_DATA(9 + b));
+        gen.IMUL32RtoR(PCSX::ix86::EAX, PCSX::ix86::ECX);
+        gen.MOVSX32M16toR(PCSX::ix86::ECX, GTE_CTRL(diagonal[b]));
+        gen.MOVSX32M16toR(PCSX::ix86::EDX, GTE_DATA(9 + a));
+        gen.IMUL32RtoR(PCSX::ix86::ECX, PCSX::ix86::EDX);
+        gen.SUB32RtoR(PCSX::ix86::EAX, PCSX::ix86::ECX);
+        if (sf) gen.SAR32ItoR(PCSX::ix86::EAX, 12);
+        gen.MOV32RtoM(GTE_DATA(25 + i), PCSX::ix86::EAX);
+    }
+    for (int i = 0; i < 3; i++) {
+        gen.MOV32MtoR(PCSX::ix86::EAX, GTE_DATA(25 + i));
+        iGteLmB(i + 1, lm);
+    }
+}
+
+void X86DynaRecCPU::recSQR() {
+    // MAC = IR * IR, IR = Lm_B(MAC)
+    const int sf = (m_psxRegs.code >> 19) & 1;
+    const int lm = (m_psxRegs.code >> 10) & 1;
+
+    gen.MOV32ItoM(GTE_CTRL(31), 0);
+    for (int i = 1; i <= 3; i++) {
+        gen.MOVSX32M16toR(PCSX::ix86::EAX, GTE_DATA(8 + i));
+        gen.IMUL32RtoR(PCSX::ix86::EAX, PCSX::ix86::EAX);
+        if (sf) gen.SAR32ItoR(PCSX::ix86::EAX, 12);
+        gen.MOV32RtoM(GTE_DATA(24 + i), PCSX::ix86::EAX);
+        iGteLmB(i, lm);
+    }
+}
+
+// MAC0 = ZSF * (SZfirst + ... + SZ3), OTZ = Lm_D(MAC0 >> 12)
+void X86DynaRecCPU::iGteAVSZ(int first, int zsf) {
+    gen.MOV32ItoM(GTE_CTRL(31), 0);
+    gen.MOVZX32M16toR(PCSX::ix86::EAX, GTE_DATA(first));
+    for (int reg = first + 1; reg <= 19; reg++) {
+        gen.MOVZX32M16toR(PCSX::ix86::ECX, GTE_DATA(reg));
+        gen.ADD32RtoR(PCSX::ix86::EAX, PCSX::ix86::ECX);
+    }
+    gen.MOVSX32M16toR(PCSX::ix86::ECX, GTE_CTRL(zsf));
+    gen.IMUL32R(PCSX::ix86::ECX);
+    iGteF();
+
+    gen.SHR32ItoR(PCSX::ix86::EAX, 12);
+    gen.SHL32ItoR(PCSX::ix86::EDX, 20);
+    gen.OR32RtoR(PCSX::ix86::EAX, PCSX::ix86::EDX);
+    gen.CMP32ItoR(PCSX::ix86::EAX, 0xffff);
+    unsigned belowMax = gen.JLE8(0);
+    gen.MOV32ItoR(PCSX::ix86::EAX, 0xffff);
+    gen.OR32ItoM(GTE_CTRL(31), (1 << 31) | (1 << 18));
+    unsigned done = gen.JMP8(0);
+
+    gen.x86SetJ8(belowMax);
+    gen.TEST32RtoR(PCSX::ix86::EAX, PCSX::ix86::EAX);
+    unsigned positive = gen.JGE8(0);
+    gen.XOR32RtoR(PCSX::ix86::EAX, PCSX::ix86::EAX);
+    gen.OR32ItoM(GTE_CTRL(31), (1 << 31) | (1 << 18));
+
+    gen.x86SetJ8(positive);
+    gen.x86SetJ8(done);
+    gen.MOV16RtoM(GTE_DATA(7), PCSX::ix86::EAX);
+}
+
+void X86DynaRecCPU::recAVSZ3() { iGteAVSZ(17, 29); }
+
+void X86DynaRecCPU::recAVSZ4() { iGteAVSZ(16, 30); }
+
+#undef GTE_DATA
+#undef GTE_CTRL
+
 //
 
 void X86DynaRecCPU::recHLE() {
     iFlushRegs();
 
-    uint32_t hleCode = PCSX::g_emulator.m_psxCpu->m_psxRegs.code & 0x03ffffff;
+    uint32_t hleCode = PCSX::g_emulator->m_psxCpu->m_psxRegs.code & 0x03ffffff;
     if (hleCode >= (sizeof(psxHLEt) / sizeof(psxHLEt[0]))) {
         recNULL();
     } else {
@@ -3539,6 +3880,26 @@ const func_t X86DynaRecCPU::m_pgxpRecCP0[32] = {
     &X86DynaRecCPU::pgxpRecNULL, &X86DynaRecCPU::pgxpRecNULL,  // 1e
 };
 
+// NCLIP goes to the interpreter, which lets PGXP compute it
+const func_t X86DynaRecCPU::m_pgxpRecCP2[64] = {
+    &X86DynaRecCPU::recBASIC, &X86DynaRecCPU::recRTPS,  &X86DynaRecCPU::recNULL,  &X86DynaRecCPU::recNULL,  // 00
+    &X86DynaRecCPU::recNULL,  &X86DynaRecCPU::recNULL,  &X86DynaRecCPU::pgxpRecNCLIP, &X86DynaRecCPU::recNULL,  // 04
+    &X86DynaRecCPU::recNULL,  &X86DynaRecCPU::recNULL,  &X86DynaRecCPU::recNULL,  &X86DynaRecCPU::recNULL,  // 08
+    &X86DynaRecCPU::recOP,    &X86DynaRecCPU::recNULL,  &X86DynaRecCPU::recNULL,  &X86DynaRecCPU::recNULL,  // 0c
+    &X86DynaRecCPU::recDPCS,  &X86DynaRecCPU::recINTPL, &X86DynaRecCPU::recMVMVA, &X86DynaRecCPU::recNCDS,  // 10
+    &X86DynaRecCPU::recCDP,   &X86DynaRecCPU::recNULL,  &X86DynaRecCPU::recNCDT,  &X86DynaRecCPU::recNULL,  // 14
+    &X86DynaRecCPU::recNULL,  &X86DynaRecCPU::recNULL,  &X86DynaRecCPU::recNULL,  &X86DynaRecCPU::recNCCS,  // 18
+    &X86DynaRecCPU::recCC,    &X86DynaRecCPU::recNULL,  &X86DynaRecCPU::recNCS,   &X86DynaRecCPU::recNULL,  // 1c
+    &X86DynaRecCPU::recNCT,   &X86DynaRecCPU::recNULL,  &X86DynaRecCPU::recNULL,  &X86DynaRecCPU::recNULL,  // 20
+    &X86DynaRecCPU::recNULL,  &X86DynaRecCPU::recNULL,  &X86DynaRecCPU::recNULL,  &X86DynaRecCPU::recNULL,  // 24
+    &X86DynaRecCPU::recSQR,   &X86DynaRecCPU::recDCPL,  &X86DynaRecCPU::recDPCT,  &X86DynaRecCPU::recNULL,  // 28
+    &X86DynaRecCPU::recNULL,  &X86DynaRecCPU::recAVSZ3, &X86DynaRecCPU::recAVSZ4, &X86DynaRecCPU::recNULL,  // 2c
+    &X86DynaRecCPU::recRTPT,  &X86DynaRecCPU::recNULL,  &X86DynaRecCPU::recNULL,  &X86DynaRecCPU::recNULL,  // 30
+    &X86DynaRecCPU::recNULL,  &X86DynaRecCPU::recNULL,  &X86DynaRecCPU::recNULL,  &X86DynaRecCPU::recNULL,  // 34
+    &X86DynaRecCPU::recNULL,  &X86DynaRecCPU::recNULL,  &X86DynaRecCPU::recNULL,  &X86DynaRecCPU::recNULL,  // 38
+    &X86DynaRecCPU::recNULL,  &X86DynaRecCPU::recGPF,   &X86DynaRecCPU::recGPL,   &X86DynaRecCPU::recNCCT,  // 3c
+};
+
 const func_t X86DynaRecCPU::m_pgxpRecCP2BSC[32] = {
     &X86DynaRecCPU::pgxpRecMFC2, &X86DynaRecCPU::pgxpRecNULL,  // 00
     &X86DynaRecCPU::pgxpRecCFC2, &X86DynaRecCPU::pgxpRecNULL,  // 02
@@ -3650,7 +4011,7 @@ void X86DynaRecCPU::SetPGXPMode(uint32_t pgxpMode) {
             m_pRecSPC = m_recSPC;
             m_pRecREG = m_recREG;
             m_pRecCP0 = m_pgxpRecCP0;
-            m_pRecCP2 = m_recCP2;
+            m_pRecCP2 = m_pgxpRecCP2;
             m_pRecCP2BSC = m_pgxpRecCP2BSC;
             break;
         case 2:  // PGXP_MODE_FULL:
@@ -3658,7 +4019,7 @@ void X86DynaRecCPU::SetPGXPMode(uint32_t pgxpMode) {
             m_pRecSPC = m_pgxpRecSPC;
             m_pRecREG = m_recREG;
             m_pRecCP0 = m_pgxpRecCP0;
-            m_pRecCP2 = m_recCP2;
+            m_pRecCP2 = m_pgxpRecCP2;
             m_pRecCP2BSC = m_pgxpRecCP2BSC;
             break;
     }
@@ -19,159 +19,21 @@
  ***************************************************************************/
 
 #include "core/mdec.h"
+#include "core/profiler.h"
 
-#define AAN_CONST_BITS 12
-#define AAN_PRESCALE_BITS 16
+#include <algorithm>
 
-#define AAN_CONST_SIZE 24
-#define AAN_CONST_SCALE (AAN_CONST_SIZE - AAN_CONST_BITS)
+#define AAN_PRESCALE_BITS 16
 
 #define AAN_PRESCALE_SIZE 20
 #define AAN_PRESCALE_SCALE (AAN_PRESCALE_SIZE - AAN_PRESCALE_BITS)
 #define AAN_EXTRA 12
 
-#define SCALE(x, n) ((x) >> (n))
 #define SCALER(x, n) (((x) + ((1 << (n)) >> 1)) >> (n))
 
-#define MULS(var, const) (SCALE((var) * (const), AAN_CONST_BITS))
-
 #define RLE_RUN(a) ((a) >> 10)
 #define RLE_VAL(a) (((int)(a) << (sizeof(int) * 8 - 10)) >> (sizeof(int) * 8 - 10))
 
-#define FIX_1_082392200 SCALER(18159528, AAN_CONST_SCALE)  // B6
-#define FIX_1_414213562 SCALER(23726566, AAN_CONST_SCALE)  // A4
-#define FIX_1_847759065 SCALER(31000253, AAN_CONST_SCALE)  // A2
-#define FIX_2_613125930 SCALER(43840978, AAN_CONST_SCALE)  // B2
-
-static inline void fillcol(int *blk, int val) {
-    blk[0 * PCSX::MDEC::DSIZE] = blk[1 * PCSX::MDEC::DSIZE] = blk[2 * PCSX::MDEC::DSIZE] = blk[3 * PCSX::MDEC::DSIZE] =
-        blk[4 * PCSX::MDEC::DSIZE] = blk[5 * PCSX::MDEC::DSIZE] = blk[6 * PCSX::MDEC::DSIZE] =
-            blk[7 * PCSX::MDEC::DSIZE] = val;
-}
-
-static inline void fillrow(int *blk, int val) {
-    blk[0] = blk[1] = blk[2] = blk[3] = blk[4] = blk[5] = blk[6] = blk[7] = val;
-}
-
-static void idct(int *block, int used_col) {
-    int tmp0, tmp1, tmp2, tmp3, tmp4, tmp5, tmp6, tmp7;
-    int z5, z10, z11, z12, z13;
-    int *ptr;
-    int i;
-
-    // the block has only the DC coefficient
-    if (used_col == -1) {
-        int v = block[0];
-        for (i = 0; i < PCSX::MDEC::DSIZE2; i++) block[i] = v;
-        return;
-    }
-
-    // last_col keeps track of the highest column with non zero coefficients
-    ptr = block;
-    for (i = 0; i < PCSX::MDEC::DSIZE; i++, ptr++) {
-        if ((used_col & (1 << i)) == 0) {
-            // the column is empty or has only the DC coefficient
-            if (ptr[PCSX::MDEC::DSIZE * 0]) {
-                fillcol(ptr, ptr[0]);
-                used_col |= (1 << i);
-            }
-            continue;
-        }
-
-        // further optimization could be made by keeping track of
-        // last_row in rl2blk
-        z10 = ptr[PCSX::MDEC::DSIZE * 0] + ptr[PCSX::MDEC::DSIZE * 4];  // s04
-        z11 = ptr[PCSX::MDEC::DSIZE * 0] - ptr[PCSX::MDEC::DSIZE * 4];  // d04
-        z13 = ptr[PCSX::MDEC::DSIZE * 2] + ptr[PCSX::MDEC::DSIZE * 6];  // s26
-        z12 = MULS(ptr[PCSX::MDEC::DSIZE * 2] - ptr[PCSX::MDEC::DSIZE * 6], FIX_1_414213562) - z13;
-        //^^^^  d26=d26*2*A4-s26
-
-        tmp0 = z10 + z13;  // os07 = s04 + s26
-        tmp3 = z10 - z13;  // os34 = s04 - s26
-        tmp1 = z11 + z12;  // os16 = d04 + d26
-        tmp2 = z11 - z12;  // os25 = d04 - d26
-
-        z13 = ptr[PCSX::MDEC::DSIZE * 3] + ptr[PCSX::MDEC::DSIZE * 5];  // s53
-        z10 = ptr[PCSX::MDEC::DSIZE * 3] - ptr[PCSX::MDEC::DSIZE * 5];  //-d53
-        z11 = ptr[PCSX::MDEC::DSIZE * 1] + ptr[PCSX::MDEC::DSIZE * 7];  // s17
-        z12 = ptr[PCSX::MDEC::DSIZE * 1] - ptr[PCSX::MDEC::DSIZE * 7];  // d17
-
-        tmp7 = z11 + z13;  // od07 = s17 + s53
-
-        z5 = (z12 - z10) * (FIX_1_847759065);
-        tmp6 = SCALE(z10 * (FIX_2_613125930) + z5, AAN_CONST_BITS) - tmp7;
-        tmp5 = MULS(z11 - z13, FIX_1_414213562) - tmp6;
-        tmp4 = SCALE(z12 * (FIX_1_082392200)-z5, AAN_CONST_BITS) + tmp5;
-
-        // path #1
-        // z5 = (z12 - z10)* FIX_1_847759065;
-        // tmp0 = (d17 + d53) * 2*A2
-
-        // tmp6 = DESCALE(z10*FIX_2_613125930 + z5, CONST_BITS) - tmp7;
-        // od16 = (d53*-2*B2 + tmp0) - od07
-
-        // tmp4 = DESCALE(z12*FIX_1_082392200 - z5, CONST_BITS) + tmp5;
-        // od34 = (d17*2*B6 - tmp0) + od25
-
-        // path #2
-
-        // od34 = d17*2*(B6-A2) - d53*2*A2
-        // od16 = d53*2*(A2-B2) + d17*2*A2
-
-        // end
-
-        //    tmp5 = MULS(z11 - z13, FIX_1_414213562) - tmp6;
-        // od25 = (s17 - s53)*2*A4 - od16
-
-        ptr[PCSX::MDEC::DSIZE * 0] = (tmp0 + tmp7);  // os07 + od07
-        ptr[PCSX::MDEC::DSIZE * 7] = (tmp0 - tmp7);  // os07 - od07
-        ptr[PCSX::MDEC::DSIZE * 1] = (tmp1 + tmp6);  // os16 + od16
-        ptr[PCSX::MDEC::DSIZE * 6] = (tmp1 - tmp6);  // os16 - od16
-        ptr[PCSX::MDEC::DSIZE * 2] = (tmp2 + tmp5);  // os25 + od25
-        ptr[PCSX::MDEC::DSIZE * 5] = (tmp2 - tmp5);  // os25 - od25
-        ptr[PCSX::MDEC::DSIZE * 4] = (tmp3 + tmp4);  // os34 + od34
-        ptr[PCSX::MDEC::DSIZE * 3] = (tmp3 - tmp4);  // os34 - od34
-    }
-
-    ptr = block;
-    if (used_col == 1) {
-        for (i = 0; i < PCSX::MDEC::DSIZE; i++) fillrow(block + PCSX::MDEC::DSIZE * i, block[PCSX::MDEC::DSIZE * i]);
-    } else {
-        for (i = 0; i < PCSX::MDEC::DSIZE; i++, ptr += PCSX::MDEC::DSIZE) {
-            z10 = ptr[0] + ptr[4];
-            z11 = ptr[0] - ptr[4];
-            z13 = ptr[2] + ptr[6];
-            z12 = MULS(ptr[2] - ptr[6], FIX_1_414213562) - z13;
-
-            tmp0 = z10 + z13;
-            tmp3 = z10 - z13;
-            tmp1 = z11 + z12;
-            tmp2 = z11 - z12;
-
-            z13 = ptr[3] + ptr[5];
-            z10 = ptr[3] - ptr[5];
-            z11 = ptr[1] + ptr[7];
-            z12 = ptr[1] - ptr[7];
-
-            tmp7 = z11 + z13;
-            z5 = (z12 - z10) * FIX_1_847759065;
-            tmp6 = SCALE(z10 * FIX_2_613125930 + z5, AAN_CONST_BITS) - tmp7;
-            tmp5 = MULS(z11 - z13, FIX_1_414213562) - tmp6;
-            tmp4 = SCALE(z12 * FIX_1_082392200 - z5, AAN_CONST_BITS) + tmp5;
-
-            ptr[0] = tmp0 + tmp7;
-
-            ptr[7] = tmp0 - tmp7;
-            ptr[1] = tmp1 + tmp6;
-            ptr[6] = tmp1 - tmp6;
-            ptr[2] = tmp2 + tmp5;
-            ptr[5] = tmp2 - tmp5;
-            ptr[4] = tmp3 + tmp4;
-            ptr[3] = tmp3 - tmp4;
-        }
-    }
-}
-
 enum {
     // mdec0: command register
     MDEC0_STP = 0x02000000,
@@ -234,158 +96,32 @@ unsigned short *PCSX::MDEC::rl2blk(int *blk, unsigned short *mdec_rl) {
         // at least one non zero cofficient in the rows 1-7
         // single coefficients in row 0 are treted specially
         // in the idtc function
-        idct(blk, used_col);
+        MDECKernels::idct(blk, used_col);
         blk += DSIZE2;
     }
     return mdec_rl;
 }
 
-// full scale (JPEG)
-// Y/Cb/Cr[0...255] -> R/G/B[0...255]
-// R = 1.000 * (Y) + 1.400 * (Cr - 128)
-// G = 1.000 * (Y) - 0.343 * (Cb - 128) - 0.711 (Cr - 128)
-// B = 1.000 * (Y) + 1.765 * (Cb - 128)
-#define MULR(a) ((1434 * (a)))
-#define MULB(a) ((1807 * (a)))
-#define MULG2(a, b) ((-351 * (a)-728 * (b)))
-#define MULY(a) ((a) << 10)
-
-#define MAKERGB15(r, g, b, a) (SWAP_LE16(a | ((b) << 10) | ((g) << 5) | (r)))
-#define SCALE8(c) SCALER(c, 20)
-#define SCALE5(c) SCALER(c, 23)
-
-#define CLAMP5(c) (((c) < -16) ? 0 : (((c) > (31 - 16)) ? 31 : ((c) + 16)))
-#define CLAMP8(c) (((c) < -128) ? 0 : (((c) > (255 - 128)) ? 255 : ((c) + 128)))
-
-#define CLAMP_SCALE8(a) (CLAMP8(SCALE8(a)))
-#define CLAMP_SCALE5(a) (CLAMP5(SCALE5(a)))
-
-inline void PCSX::MDEC::putlinebw15(uint16_t *image, int *Yblk) {
-    int i;
-    int A = (mdec.reg0 & MDEC0_STP) ? 0x8000 : 0;
-
-    for (i = 0; i < 8; i++, Yblk++) {
-        int Y = *Yblk;
-        // missing rounding
-        image[i] = SWAP_LE16((CLAMP5(Y >> 3) * 0x421) | A);
-    }
-}
-
-inline void PCSX::MDEC::putquadrgb15(uint16_t *image, int *Yblk, int Cr, int Cb) {
-    int Y, R, G, B;
-    int A = (mdec.reg0 & MDEC0_STP) ? 0x8000 : 0;
-    R = MULR(Cr);
-    G = MULG2(Cb, Cr);
-    B = MULB(Cb);
-
-    // added transparency
-    Y = MULY(Yblk[0]);
-    image[0] = MAKERGB15(CLAMP_SCALE5(Y + R), CLAMP_SCALE5(Y + G), CLAMP_SCALE5(Y + B), A);
-    Y = MULY(Yblk[1]);
-    image[1] = MAKERGB15(CLAMP_SCALE5(Y + R), CLAMP_SCALE5(Y + G), CLAMP_SCALE5(Y + B), A);
-    Y = MULY(Yblk[8]);
-    image[16] = MAKERGB15(CLAMP_SCALE5(Y + R), CLAMP_SCALE5(Y + G), CLAMP_SCALE5(Y + B), A);
-    Y = MULY(Yblk[9]);
-    image[17] = MAKERGB15(CLAMP_SCALE5(Y + R), CLAMP_SCALE5(Y + G), CLAMP_SCALE5(Y + B), A);
-}
-
-inline void PCSX::MDEC::yuv2rgb15(int *blk, unsigned short *image) {
-    int x, y;
-    int *Yblk = blk + DSIZE2 * 2;
-    int *Crblk = blk;
-    int *Cbblk = blk + DSIZE2;
-
-    if (!PCSX::g_emulator.settings.get<PCSX::Emulator::SettingBnWMdec>()) {
-        for (y = 0; y < 16; y += 2, Crblk += 4, Cbblk += 4, Yblk += 8, image += 24) {
-            if (y == 8) Yblk += DSIZE2;
-            for (x = 0; x < 4; x++, image += 2, Crblk++, Cbblk++, Yblk += 2) {
-                putquadrgb15(image, Yblk, *Crblk, *Cbblk);
-                putquadrgb15(image + 8, Yblk + DSIZE2, *(Crblk + 4), *(Cbblk + 4));
-            }
-        }
-    } else {
-        for (y = 0; y < 16; y++, Yblk += 8, image += 16) {
-            if (y == 8) Yblk += DSIZE2;
-            putlinebw15(image, Yblk);
-            putlinebw15(image + 8, Yblk + DSIZE2);
-        }
-    }
-}
-
-static inline void putlinebw24(uint8_t *image, int *Yblk) {
-    int i;
-    unsigned char Y;
-    for (i = 0; i < 8 * 3; i += 3, Yblk++) {
-        Y = CLAMP8(*Yblk);
-        image[i + 0] = Y;
-        image[i + 1] = Y;
-        image[i + 2] = Y;
-    }
-}
-
-static inline void putquadrgb24(uint8_t *image, int *Yblk, int Cr, int Cb) {
-    int Y, R, G, B;
-
-    R = MULR(Cr);
-    G = MULG2(Cb, Cr);
-    B = MULB(Cb);
-
-    Y = MULY(Yblk[0]);
-    image[0 * 3 + 0] = CLAMP_SCALE8(Y + R);
-    image[0 * 3 + 1] = CLAMP_SCALE8(Y + G);
-    image[0 * 3 + 2] = CLAMP_SCALE8(Y + B);
-    Y = MULY(Yblk[1]);
-    image[1 * 3 + 0] = CLAMP_SCALE8(Y + R);
-    image[1 * 3 + 1] = CLAMP_SCALE8(Y + G);
-    image[1 * 3 + 2] = CLAMP_SCALE8(Y + B);
-    Y = MULY(Yblk[8]);
-    image[16 * 3 + 0] = CLAMP_SCALE8(Y + R);
-    image[16 * 3 + 1] = CLAMP_SCALE8(Y + G);
-    image[16 * 3 + 2] = CLAMP_SCALE8(Y + B);
-    Y = MULY(Yblk[9]);
-    image[17 * 3 + 0] = CLAMP_SCALE8(Y + R);
-    image[17 * 3 + 1] = CLAMP_SCALE8(Y + G);
-    image[17 * 3 + 2] = CLAMP_SCALE8(Y + B);
-}
-
-void yuv2rgb24(int *blk, uint8_t *image) {
-    int x, y;
-    int *Yblk = blk + PCSX::MDEC::DSIZE2 * 2;
-    int *Crblk = blk;
-    int *Cbblk = blk + PCSX::MDEC::DSIZE2;
-
-    if (!PCSX::g_emulator.settings.get<PCSX::Emulator::SettingBnWMdec>()) {
-        for (y = 0; y < 16; y += 2, Crblk += 4, Cbblk += 4, Yblk += 8, image += 8 * 3 * 3) {
-            if (y == 8) Yblk += PCSX::MDEC::DSIZE2;
-            for (x = 0; x < 4; x++, image += 6, Crblk++, Cbblk++, Yblk += 2) {
-                putquadrgb24(image, Yblk, *Crblk, *Cbblk);
-                putquadrgb24(image + 8 * 3, Yblk + PCSX::MDEC::DSIZE2, *(Crblk + 4), *(Cbblk + 4));
-            }
-        }
-    } else {
-        for (y = 0; y < 16; y++, Yblk += 8, image += 16 * 3) {
-            if (y == 8) Yblk += PCSX::MDEC::DSIZE2;
-            putlinebw24(image, Yblk);
-            putlinebw24(image + 8 * 3, Yblk + PCSX::MDEC::DSIZE2);
-        }
-    }
-}
-
 void PCSX::MDEC::mdecInit(void) {
+    cancelDecode();
     memset(&mdec, 0, sizeof(mdec));
     memset(iq_y, 0, sizeof(iq_y));
     memset(iq_uv, 0, sizeof(iq_uv));
-    mdec.rl = (uint16_t *)&PCSX::g_emulator.m_psxMem->g_psxM[0x100000];
+    mdec.rl = (uint16_t *)&PCSX::g_emulator->m_psxMem->g_psxM[0x100000];
 }
 
 // command register
-void PCSX::MDEC::mdecWrite0(uint32_t data) { mdec.reg0 = data; }
+void PCSX::MDEC::mdecWrite0(uint32_t data) {
+    cancelDecode();
+    mdec.reg0 = data;
+}
 
 uint32_t PCSX::MDEC::mdecRead0(void) { return mdec.reg0; }
 
 // status register
 void PCSX::MDEC::mdecWrite1(uint32_t data) {
     if (data & MDEC1_RESET) {  // mdec reset
+        cancelDecode();
         mdec.reg0 = 0;
         mdec.reg1 = 0;
         mdec.pending_dma1.adr = 0;
@@ -399,6 +135,7 @@ uint32_t PCSX::MDEC::mdecRead1(void) {
 }
 
 void PCSX::MDEC::psxDma0(uint32_t adr, uint32_t bcr, uint32_t chcr) {
+    Profiler::Scope profile(Profiler::MDEC);
     int cmd = mdec.reg0;
     int size;
 
@@ -406,6 +143,8 @@ void PCSX::MDEC::psxDma0(uint32_t adr, uint32_t bcr, uint32_t chcr) {
         return;
     }
 
+    cancelDecode();
+
     /* mdec is STP till dma0 is released */
     mdec.reg1 |= MDEC1_STP;
 
@@ -425,6 +164,11 @@ void PCSX::MDEC::psxDma0(uint32_t adr, uint32_t bcr, uint32_t chcr) {
                 return;
             }
 
+            // a dma1 that is already pending consumes the whole output right below, which leaves
+            // nothing for the worker to overlap with; it only pays off when the game starts the
+            // dma1 later, which gives it until then to get ahead
+            if (!mdec.pending_dma1.adr) decodeAhead();
+
             /* process the pending dma1 */
             if (mdec.pending_dma1.adr) {
                 psxDma1(mdec.pending_dma1.adr, mdec.pending_dma1.bcr, mdec.pending_dma1.chcr);
@@ -468,8 +212,141 @@ void PCSX::MDEC::mdec0Interrupt() {
 #define SIZE_OF_24B_BLOCK (16 * 16 * 3)
 #define SIZE_OF_16B_BLOCK (16 * 16 * 2)
 
-void PCSX::MDEC::psxDma1(uint32_t adr, uint32_t bcr, uint32_t chcr) {
+// the longest a macroblock can be: 6 blocks, each a header and at most 64 coefficients
+static const uint32_t MAX_MACROBLOCK = 6 * (1 + PCSX::MDEC::DSIZE2);
+
+void PCSX::MDEC::decodeMacroblock(uint8_t *image) {
+    const bool rgb15 = mdec.reg0 & MDEC0_RGB24;
+
+    // only this thread ever changes m_decodeActive
+    if (m_decodeActive) {
+        std::unique_lock<std::mutex> lock(m_decodeLock);
+        m_decoded.wait(lock, [&] { return m_produced != m_consumed || m_decodeDone; });
+        const Decoded &slot = m_decodeSlots[m_consumed % DECODE_SLOTS];
+        if (m_produced != m_consumed && m_decodeBase + slot.start == mdec.rl) {
+            memcpy(image, slot.pixels, rgb15 ? SIZE_OF_16B_BLOCK : SIZE_OF_24B_BLOCK);
+            mdec.rl = m_decodeBase + slot.end;
+            m_consumed++;
+            lock.unlock();
+            m_decodeWake.notify_one();
+            return;
+        }
+        lock.unlock();
+        // past what the worker could decode, or mdec.rl moved under it
+        cancelDecode();
+    }
+
+    int blk[DSIZE2 * 6];
+    const bool bnw = PCSX::g_emulator->settings.get<PCSX::Emulator::SettingBnWMdec>();
+    mdec.rl = rl2blk(blk, mdec.rl);
+    if (rgb15) {
+        MDECKernels::yuv2rgb15(blk, (uint16_t *)image, bnw, mdec.reg0 & MDEC0_STP);
+    } else {
+        MDECKernels::yuv2rgb24(blk, image, bnw);
+    }
+}
+
+void PCSX::MDEC::decodeAhead() {
+    cancelDecode();
+    if (!PCSX::g_emulator->settings.get<PCSX::Emulator::SettingMdecThread>()) return;
+
+    uint16_t *ram = (uint16_t *)PCSX::g_emulator->m_psxMem->g_psxM;
+    uint16_t *ramEnd = ram + 0x200000 / 2;
+    if (mdec.rl < ram || mdec.rl >= ramEnd) return;
+
+    if (!m_decodeThread.joinable()) {
+        m_decodeStop = false;
+        // the conversion looks at the settings of the machine the decoding is for
+        m_decodeThread = std::thread([this, emulator = PCSX::g_emulator, system = PCSX::g_system]() {
+            PCSX::g_emulator = emulator;
+            PCSX::g_system = system;
+            decodeWorker();
+        });
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_decodeLock);
+        m_decodeBase = mdec.rl;
+        m_decodeSize = std::min(mdec.rl_end, ramEnd) - mdec.rl;
+        // rl2blk doesn't stop at the end of the input, so leave room for the last macroblock to run over it
+        m_decodeInput.assign(mdec.rl, mdec.rl + std::min<ptrdiff_t>(m_decodeSize + MAX_MACROBLOCK, ramEnd - mdec.rl));
+        m_decodeNext = 0;
+        // the GUI can change the setting at any time; a command gets decoded with what it was when sent
+        m_decodeBnW = PCSX::g_emulator->settings.get<PCSX::Emulator::SettingBnWMdec>();
+        m_produced = m_consumed = 0;
+        m_decodeDone = false;
+        m_decodeActive = true;
+    }
+    m_decodeWake.notify_one();
+}
+
+void PCSX::MDEC::cancelDecode() {
+    if (!m_decodeActive) return;
+    std::unique_lock<std::mutex> lock(m_decodeLock);
+    m_decodeActive = false;
+    m_decoded.wait(lock, [&] { return !m_decodeWorking; });
+    m_produced = m_consumed = 0;
+}
+
+void PCSX::MDEC::stopDecoder() {
+    if (!m_decodeThread.joinable()) return;
+    cancelDecode();
+    {
+        std::lock_guard<std::mutex> lock(m_decodeLock);
+        m_decodeStop = true;
+    }
+    m_decodeWake.notify_one();
+    m_decodeThread.join();
+}
+
+// decodes the input of the current command in order, as long as there are free slots; the
+// emulation thread never touches reg0 or the quantization tables without cancelling first, and
+// the settings are only ever read through the snapshot taken by decodeAhead
+void PCSX::MDEC::decodeWorker() {
     int blk[DSIZE2 * 6];
+    std::unique_lock<std::mutex> lock(m_decodeLock);
+
+    while (true) {
+        m_decodeWake.wait(lock, [&] {
+            return m_decodeStop || (m_decodeActive && !m_decodeDone && m_produced - m_consumed < DECODE_SLOTS);
+        });
+        if (m_decodeStop) break;
+
+        uint16_t *input = m_decodeInput.data();
+        const uint32_t start = m_decodeNext;
+        if (start >= m_decodeSize || start + MAX_MACROBLOCK > m_decodeInput.size() ||
+            SWAP_LE16(input[start]) == MDEC_END_OF_DATA) {
+            m_decodeDone = true;
+            m_decoded.notify_all();
+            continue;
+        }
+
+        // the consumer doesn't look at this slot until m_produced moves past it
+        Decoded &slot = m_decodeSlots[m_produced % DECODE_SLOTS];
+        m_decodeWorking = true;
+        lock.unlock();
+
+        const uint32_t end = rl2blk(blk, input + start) - input;
+        if (mdec.reg0 & MDEC0_RGB24) {
+            MDECKernels::yuv2rgb15(blk, (uint16_t *)slot.pixels, m_decodeBnW, mdec.reg0 & MDEC0_STP);
+        } else {
+            MDECKernels::yuv2rgb24(blk, slot.pixels, m_decodeBnW);
+        }
+
+        lock.lock();
+        m_decodeWorking = false;
+        if (m_decodeActive) {
+            slot.start = start;
+            slot.end = end;
+            m_decodeNext = end;
+            m_produced++;
+        }
+        m_decoded.notify_all();
+    }
+}
+
+void PCSX::MDEC::psxDma1(uint32_t adr, uint32_t bcr, uint32_t chcr) {
+    Profiler::Scope profile(Profiler::MDEC);
     uint8_t *image;
     int size;
     int dmacnt;
@@ -507,15 +384,13 @@ void PCSX::MDEC::psxDma1(uint32_t adr, uint32_t bcr, uint32_t chcr) {
             }
 
             while (size >= SIZE_OF_16B_BLOCK) {
-                mdec.rl = rl2blk(blk, mdec.rl);
-                yuv2rgb15(blk, (uint16_t *)image);
+                decodeMacroblock(image);
                 image += SIZE_OF_16B_BLOCK;
                 size -= SIZE_OF_16B_BLOCK;
             }
 
             if (size != 0) {
-                mdec.rl = rl2blk(blk, mdec.rl);
-                yuv2rgb15(blk, (uint16_t *)mdec.block_buffer);
+                decodeMacroblock(mdec.block_buffer);
                 memcpy(image, mdec.block_buffer, size);
                 mdec.block_buffer_pos = mdec.block_buffer + size;
             }
@@ -536,15 +411,13 @@ void PCSX::MDEC::psxDma1(uint32_t adr, uint32_t bcr, uint32_t chcr) {
             }
 
             while (size >= SIZE_OF_24B_BLOCK) {
-                mdec.rl = rl2blk(blk, mdec.rl);
-                yuv2rgb24(blk, image);
+                decodeMacroblock(image);
                 image += SIZE_OF_24B_BLOCK;
                 size -= SIZE_OF_24B_BLOCK;
             }
 
             if (size != 0) {
-                mdec.rl = rl2blk(blk, mdec.rl);
-                yuv2rgb24(blk, mdec.block_buffer);
+                decodeMacroblock(mdec.block_buffer);
                 memcpy(image, mdec.block_buffer, size);
                 mdec.block_buffer_pos = mdec.block_buffer + size;
             }
@@ -556,6 +429,7 @@ void PCSX::MDEC::psxDma1(uint32_t adr, uint32_t bcr, uint32_t chcr) {
 }
 
 void PCSX::MDEC::mdec1Interrupt() {
+    Profiler::Scope profile(Profiler::MDEC);
     /* Author : gschwind
      *
      * in that case we have done all decoding stuff
@@ -599,9 +473,11 @@ void PCSX::MDEC::mdec1Interrupt() {
 }
 
 int PCSX::MDEC::mdecFreeze(gzFile f, int Mode) {
-    uint8_t *base = (uint8_t *)&PCSX::g_emulator.m_psxMem->g_psxM[0x100000];
+    uint8_t *base = (uint8_t *)&PCSX::g_emulator->m_psxMem->g_psxM[0x100000];
     uint32_t v;
 
+    cancelDecode();
+
     gzfreeze(&mdec.reg0, sizeof(mdec.reg0));
     gzfreeze(&mdec.reg1, sizeof(mdec.reg1));
 
@@ -19,6 +19,12 @@
 
 #pragma once
 
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "core/mdeckernels.h"
 #include "core/psxdma.h"
 #include "core/psxemulator.h"
 #include "core/psxhw.h"
@@ -28,6 +34,7 @@ namespace PCSX {
 
 class MDEC {
   public:
+    ~MDEC() { stopDecoder(); }
     void mdecInit();
     void mdecWrite0(uint32_t data);
     void mdecWrite1(uint32_t data);
@@ -39,12 +46,14 @@ class MDEC {
     void mdec1Interrupt();
     int mdecFreeze(gzFile f, int Mode);
 
-    static const unsigned DSIZE = 8;
-    static const unsigned DSIZE2 = DSIZE * DSIZE;
+    static const unsigned DSIZE = MDECKernels::DSIZE;
+    static const unsigned DSIZE2 = MDECKernels::DSIZE2;
+    // macroblocks the worker can decode ahead of psxDma1
+    static const unsigned DECODE_SLOTS = 32;
 
   private:
     /* memory speed is 1 byte per MDEC_BIAS psx clock
-     * That mean (PCSX::g_emulator.m_psxClockSpeed / MDEC_BIAS) B/s
+     * That mean (PCSX::g_emulator->m_psxClockSpeed / MDEC_BIAS) B/s
      * MDEC_BIAS = 2.0 => ~16MB/s
      * MDEC_BIAS = 3.0 => ~11MB/s
      * and so on ...
@@ -93,11 +102,43 @@ class MDEC {
         289301,  401273,  377991,  340183,  289301,  227303,  156569, 79818    // 38
     };
 
-    void putlinebw15(uint16_t *image, int *Yblk);
-    void putquadrgb15(uint16_t *image, int *Yblk, int Cr, int Cb);
-    void yuv2rgb15(int *blk, unsigned short *image);
     void iqtab_init(int *iqtab, unsigned char *iq_y);
     unsigned short *rl2blk(int *blk, unsigned short *mdec_rl);
+
+    // decodes the macroblock at mdec.rl into image, in the format selected by reg0, and moves mdec.rl past it
+    void decodeMacroblock(uint8_t *image);
+    // hands the input of the decode command to the worker thread
+    void decodeAhead();
+    // waits for the worker to be idle and drops what it decoded; has to happen before anything
+    // the decoding depends on (reg0, the quantization tables) gets changed
+    void cancelDecode();
+    void stopDecoder();
+    void decodeWorker();
+
+    struct Decoded {
+        // in halfwords from the start of the input
+        uint32_t start;
+        uint32_t end;
+        uint8_t pixels[16 * 16 * 3];
+    };
+
+    std::thread m_decodeThread;
+    std::mutex m_decodeLock;
+    std::condition_variable m_decodeWake;  // a command got queued or cancelled, or a slot got consumed
+    std::condition_variable m_decoded;     // the worker filled a slot, ran out of input, or went idle
+    bool m_decodeStop = false;
+    bool m_decodeActive = false;   // there is a command to decode
+    bool m_decodeWorking = false;  // the worker is decoding, outside of the lock
+    bool m_decodeDone = false;     // the worker went as far as it could in the input
+    // copy of the input, taken when the command is sent, since psxDma1 can come much later
+    std::vector<uint16_t> m_decodeInput;
+    uint16_t *m_decodeBase = nullptr;  // where the input is in the emulated memory
+    uint32_t m_decodeSize = 0;         // halfwords the command asked for; the copy has some slack after
+    uint32_t m_decodeNext = 0;         // where the worker is in the input
+    bool m_decodeBnW = false;          // the black and white setting, as of when the command got sent
+    unsigned m_produced = 0;
+    unsigned m_consumed = 0;
+    Decoded m_decodeSlots[DECODE_SLOTS];
 };
 
 }  // namespace PCSX
@@ -0,0 +1,526 @@
+/*  PPF Patch Support for PCSX-Reloaded
+ *  Copyright (c) 2009, Wei Mingzhi <whistler_wmz@users.sf.net>.
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#include "core/mdeckernels.h"
+
+#include <string.h>
+
+#include "core/psxmem.h"
+
+// PCSX_NO_SIMD builds the portable code only, for tools/kernelcheck to compare against
+#if !defined(PCSX_NO_SIMD) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define MDEC_SSE2 1
+#include <emmintrin.h>
+#endif
+
+#define AAN_CONST_BITS 12
+#define AAN_CONST_SIZE 24
+#define AAN_CONST_SCALE (AAN_CONST_SIZE - AAN_CONST_BITS)
+
+#define SCALE(x, n) ((x) >> (n))
+#define SCALER(x, n) (((x) + ((1 << (n)) >> 1)) >> (n))
+
+#define MULS(var, const) (SCALE((var) * (const), AAN_CONST_BITS))
+
+#define FIX_1_082392200 SCALER(18159528, AAN_CONST_SCALE)  // B6
+#define FIX_1_414213562 SCALER(23726566, AAN_CONST_SCALE)  // A4
+#define FIX_1_847759065 SCALER(31000253, AAN_CONST_SCALE)  // A2
+#define FIX_2_613125930 SCALER(43840978, AAN_CONST_SCALE)  // B2
+
+#ifdef MDEC_SSE2
+namespace {
+
+// x * c, wrapping around like the scalar code, for a constant c below 1 << 16: SSE2 has no 32x32->32
+// multiply, but splitting x in halves only needs 16 bits ones; c is broadcast in all 16 bits lanes
+inline __m128i mulConst(__m128i x, __m128i c) {
+    return _mm_add_epi32(_mm_mullo_epi16(x, c), _mm_slli_epi32(_mm_mulhi_epu16(x, c), 16));
+}
+
+inline void transpose4(__m128i &r0, __m128i &r1, __m128i &r2, __m128i &r3) {
+    __m128i t0 = _mm_unpacklo_epi32(r0, r1);
+    __m128i t1 = _mm_unpacklo_epi32(r2, r3);
+    __m128i t2 = _mm_unpackhi_epi32(r0, r1);
+    __m128i t3 = _mm_unpackhi_epi32(r2, r3);
+    r0 = _mm_unpacklo_epi64(t0, t1);
+    r1 = _mm_unpackhi_epi64(t0, t1);
+    r2 = _mm_unpacklo_epi64(t2, t3);
+    r3 = _mm_unpackhi_epi64(t2, t3);
+}
+
+// one pass of the AAN IDCT below, 4 lines at once; v[k] holds the k-th coefficient of each of them
+inline void idct4(__m128i *v) {
+    const __m128i a4 = _mm_set1_epi16(FIX_1_414213562);
+    const __m128i a2 = _mm_set1_epi16(FIX_1_847759065);
+    const __m128i b2 = _mm_set1_epi16(FIX_2_613125930);
+    const __m128i b6 = _mm_set1_epi16(FIX_1_082392200);
+
+    __m128i z10 = _mm_add_epi32(v[0], v[4]);
+    __m128i z11 = _mm_sub_epi32(v[0], v[4]);
+    __m128i z13 = _mm_add_epi32(v[2], v[6]);
+    __m128i z12 = _mm_sub_epi32(_mm_srai_epi32(mulConst(_mm_sub_epi32(v[2], v[6]), a4), AAN_CONST_BITS), z13);
+
+    __m128i tmp0 = _mm_add_epi32(z10, z13);
+    __m128i tmp3 = _mm_sub_epi32(z10, z13);
+    __m128i tmp1 = _mm_add_epi32(z11, z12);
+    __m128i tmp2 = _mm_sub_epi32(z11, z12);
+
+    z13 = _mm_add_epi32(v[3], v[5]);
+    z10 = _mm_sub_epi32(v[3], v[5]);
+    z11 = _mm_add_epi32(v[1], v[7]);
+    z12 = _mm_sub_epi32(v[1], v[7]);
+
+    __m128i tmp7 = _mm_add_epi32(z11, z13);
+    __m128i z5 = mulConst(_mm_sub_epi32(z12, z10), a2);
+    __m128i tmp6 = _mm_sub_epi32(_mm_srai_epi32(_mm_add_epi32(mulConst(z10, b2), z5), AAN_CONST_BITS), tmp7);
+    __m128i tmp5 = _mm_sub_epi32(_mm_srai_epi32(mulConst(_mm_sub_epi32(z11, z13), a4), AAN_CONST_BITS), tmp6);
+    __m128i tmp4 = _mm_add_epi32(_mm_srai_epi32(_mm_sub_epi32(mulConst(z12, b6), z5), AAN_CONST_BITS), tmp5);
+
+    v[0] = _mm_add_epi32(tmp0, tmp7);
+    v[7] = _mm_sub_epi32(tmp0, tmp7);
+    v[1] = _mm_add_epi32(tmp1, tmp6);
+    v[6] = _mm_sub_epi32(tmp1, tmp6);
+    v[2] = _mm_add_epi32(tmp2, tmp5);
+    v[5] = _mm_sub_epi32(tmp2, tmp5);
+    v[4] = _mm_add_epi32(tmp3, tmp4);
+    v[3] = _mm_sub_epi32(tmp3, tmp4);
+}
+
+}  // namespace
+#endif
+
+static inline void fillcol(int *blk, int val) {
+    using PCSX::MDECKernels::DSIZE;
+    blk[0 * DSIZE] = blk[1 * DSIZE] = blk[2 * DSIZE] = blk[3 * DSIZE] = blk[4 * DSIZE] = blk[5 * DSIZE] =
+        blk[6 * DSIZE] = blk[7 * DSIZE] = val;
+}
+
+static inline void fillrow(int *blk, int val) {
+    blk[0] = blk[1] = blk[2] = blk[3] = blk[4] = blk[5] = blk[6] = blk[7] = val;
+}
+
+void PCSX::MDECKernels::idct(int *block, int used_col) {
+    int i;
+
+    // the block has only the DC coefficient
+    if (used_col == -1) {
+        int v = block[0];
+        for (i = 0; i < DSIZE2; i++) block[i] = v;
+        return;
+    }
+
+#ifdef MDEC_SSE2
+    // the full pass over a column with only its DC coefficient, or none at all, fills it the same way
+    // fillcol does, so all the columns go through it; only used_col has to be kept in sync
+    int sparse = ~used_col;
+    for (i = 0; i < DSIZE; i++) {
+        if (block[i]) used_col |= (1 << i);
+    }
+    for (i = 0; i < 2; i++) {
+        if (((sparse >> (4 * i)) & 0xf) == 0xf) {
+            // nothing below row 0 in these 4 columns
+            for (int k = 1; k < DSIZE; k++) {
+                memcpy(block + DSIZE * k + 4 * i, block + 4 * i, 4 * sizeof(int));
+            }
+            continue;
+        }
+        __m128i v[DSIZE];
+        for (int k = 0; k < DSIZE; k++) {
+            v[k] = _mm_loadu_si128(reinterpret_cast<const __m128i *>(block + DSIZE * k + 4 * i));
+        }
+        idct4(v);
+        for (int k = 0; k < DSIZE; k++) {
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(block + DSIZE * k + 4 * i), v[k]);
+        }
+    }
+
+    if (used_col == 1) {
+        for (i = 0; i < DSIZE; i++) fillrow(block + DSIZE * i, block[DSIZE * i]);
+        return;
+    }
+    // the rows go through the same pass, 4 at a time, transposed
+    for (i = 0; i < 2; i++) {
+        __m128i v[DSIZE];
+        __m128i *rows = reinterpret_cast<__m128i *>(block + DSIZE * 4 * i);
+        for (int k = 0; k < 4; k++) {
+            v[k] = _mm_loadu_si128(rows + 2 * k);
+            v[k + 4] = _mm_loadu_si128(rows + 2 * k + 1);
+        }
+        transpose4(v[0], v[1], v[2], v[3]);
+        transpose4(v[4], v[5], v[6], v[7]);
+        idct4(v);
+        transpose4(v[0], v[1], v[2], v[3]);
+        transpose4(v[4], v[5], v[6], v[7]);
+        for (int k = 0; k < 4; k++) {
+            _mm_storeu_si128(rows + 2 * k, v[k]);
+            _mm_storeu_si128(rows + 2 * k + 1, v[k + 4]);
+        }
+    }
+#else
+    int tmp0, tmp1, tmp2, tmp3, tmp4, tmp5, tmp6, tmp7;
+    int z5, z10, z11, z12, z13;
+    int *ptr;
+
+    // last_col keeps track of the highest column with non zero coefficients
+    ptr = block;
+    for (i = 0; i < DSIZE; i++, ptr++) {
+        if ((used_col & (1 << i)) == 0) {
+            // the column is empty or has only the DC coefficient
+            if (ptr[DSIZE * 0]) {
+                fillcol(ptr, ptr[0]);
+                used_col |= (1 << i);
+            }
+            continue;
+        }
+
+        // further optimization could be made by keeping track of
+        // last_row in rl2blk
+        z10 = ptr[DSIZE * 0] + ptr[DSIZE * 4];  // s04
+        z11 = ptr[DSIZE * 0] - ptr[DSIZE * 4];  // d04
+        z13 = ptr[DSIZE * 2] + ptr[DSIZE * 6];  // s26
+        z12 = MULS(ptr[DSIZE * 2] - ptr[DSIZE * 6], FIX_1_414213562) - z13;
+        //^^^^  d26=d26*2*A4-s26
+
+        tmp0 = z10 + z13;  // os07 = s04 + s26
+        tmp3 = z10 - z13;  // os34 = s04 - s26
+        tmp1 = z11 + z12;  // os16 = d04 + d26
+        tmp2 = z11 - z12;  // os25 = d04 - d26
+
+        z13 = ptr[DSIZE * 3] + ptr[DSIZE * 5];  // s53
+        z10 = ptr[DSIZE * 3] - ptr[DSIZE * 5];  //-d53
+        z11 = ptr[DSIZE * 1] + ptr[DSIZE * 7];  // s17
+        z12 = ptr[DSIZE * 1] - ptr[DSIZE * 7];  // d17
+
+        tmp7 = z11 + z13;  // od07 = s17 + s53
+
+        z5 = (z12 - z10) * (FIX_1_847759065);
+        tmp6 = SCALE(z10 * (FIX_2_613125930) + z5, AAN_CONST_BITS) - tmp7;
+        tmp5 = MULS(z11 - z13, FIX_1_414213562) - tmp6;
+        tmp4 = SCALE(z12 * (FIX_1_082392200)-z5, AAN_CONST_BITS) + tmp5;
+
+        // path #1
+        // z5 = (z12 - z10)* FIX_1_847759065;
+        // tmp0 = (d17 + d53) * 2*A2
+
+        // tmp6 = DESCALE(z10*FIX_2_613125930 + z5, CONST_BITS) - tmp7;
+        // od16 = (d53*-2*B2 + tmp0) - od07
+
+        // tmp4 = DESCALE(z12*FIX_1_082392200 - z5, CONST_BITS) + tmp5;
+        // od34 = (d17*2*B6 - tmp0) + od25
+
+        // path #2
+
+        // od34 = d17*2*(B6-A2) - d53*2*A2
+        // od16 = d53*2*(A2-B2) + d17*2*A2
+
+        // end
+
+        //    tmp5 = MULS(z11 - z13, FIX_1_414213562) - tmp6;
+        // od25 = (s17 - s53)*2*A4 - od16
+
+        ptr[DSIZE * 0] = (tmp0 + tmp7);  // os07 + od07
+        ptr[DSIZE * 7] = (tmp0 - tmp7);  // os07 - od07
+        ptr[DSIZE * 1] = (tmp1 + tmp6);  // os16 + od16
+        ptr[DSIZE * 6] = (tmp1 - tmp6);  // os16 - od16
+        ptr[DSIZE * 2] = (tmp2 + tmp5);  // os25 + od25
+        ptr[DSIZE * 5] = (tmp2 - tmp5);  // os25 - od25
+        ptr[DSIZE * 4] = (tmp3 + tmp4);  // os34 + od34
+        ptr[DSIZE * 3] = (tmp3 - tmp4);  // os34 - od34
+    }
+
+    ptr = block;
+    if (used_col == 1) {
+        for (i = 0; i < DSIZE; i++) fillrow(block + DSIZE * i, block[DSIZE * i]);
+    } else {
+        for (i = 0; i < DSIZE; i++, ptr += DSIZE) {
+            z10 = ptr[0] + ptr[4];
+            z11 = ptr[0] - ptr[4];
+            z13 = ptr[2] + ptr[6];
+            z12 = MULS(ptr[2] - ptr[6], FIX_1_414213562) - z13;
+
+            tmp0 = z10 + z13;
+            tmp3 = z10 - z13;
+            tmp1 = z11 + z12;
+            tmp2 = z11 - z12;
+
+            z13 = ptr[3] + ptr[5];
+            z10 = ptr[3] - ptr[5];
+            z11 = ptr[1] + ptr[7];
+            z12 = ptr[1] - ptr[7];
+
+            tmp7 = z11 + z13;
+            z5 = (z12 - z10) * FIX_1_847759065;
+            tmp6 = SCALE(z10 * FIX_2_613125930 + z5, AAN_CONST_BITS) - tmp7;
+            tmp5 = MULS(z11 - z13, FIX_1_414213562) - tmp6;
+            tmp4 = SCALE(z12 * FIX_1_082392200 - z5, AAN_CONST_BITS) + tmp5;
+
+            ptr[0] = tmp0 + tmp7;
+
+            ptr[7] = tmp0 - tmp7;
+            ptr[1] = tmp1 + tmp6;
+            ptr[6] = tmp1 - tmp6;
+            ptr[2] = tmp2 + tmp5;
+            ptr[5] = tmp2 - tmp5;
+            ptr[4] = tmp3 + tmp4;
+            ptr[3] = tmp3 - tmp4;
+        }
+    }
+#endif
+}
+
+// full scale (JPEG)
+// Y/Cb/Cr[0...255] -> R/G/B[0...255]
+// R = 1.000 * (Y) + 1.400 * (Cr - 128)
+// G = 1.000 * (Y) - 0.343 * (Cb - 128) - 0.711 (Cr - 128)
+// B = 1.000 * (Y) + 1.765 * (Cb - 128)
+#define MULR(a) ((1434 * (a)))
+#define MULB(a) ((1807 * (a)))
+#define MULG2(a, b) ((-351 * (a)-728 * (b)))
+#define MULY(a) ((a) << 10)
+
+#define MAKERGB15(r, g, b, a) (SWAP_LE16(a | ((b) << 10) | ((g) << 5) | (r)))
+#define SCALE8(c) SCALER(c, 20)
+#define SCALE5(c) SCALER(c, 23)
+
+#define CLAMP5(c) (((c) < -16) ? 0 : (((c) > (31 - 16)) ? 31 : ((c) + 16)))
+#define CLAMP8(c) (((c) < -128) ? 0 : (((c) > (255 - 128)) ? 255 : ((c) + 128)))
+
+#define CLAMP_SCALE8(a) (CLAMP8(SCALE8(a)))
+#define CLAMP_SCALE5(a) (CLAMP5(SCALE5(a)))
+
+#ifdef MDEC_SSE2
+namespace {
+
+// R, G and B contributions of 4 chroma samples, as MULR, MULG2 and MULB compute them
+inline void chroma4(const int *Crblk, const int *Cbblk, __m128i &R, __m128i &G, __m128i &B) {
+    __m128i cr = _mm_loadu_si128(reinterpret_cast<const __m128i *>(Crblk));
+    __m128i cb = _mm_loadu_si128(reinterpret_cast<const __m128i *>(Cbblk));
+    R = mulConst(cr, _mm_set1_epi16(1434));
+    G = _mm_sub_epi32(_mm_sub_epi32(_mm_setzero_si128(), mulConst(cb, _mm_set1_epi16(351))),
+                      mulConst(cr, _mm_set1_epi16(728)));
+    B = mulConst(cb, _mm_set1_epi16(1807));
+}
+
+// SCALER(MULY(Y) + C, shift) for 8 pixels of a luma line, each chroma sample covering 2 of them; the
+// results are small enough for 16 bits lanes, which then make the clamping cheap
+template <int shift>
+inline __m128i scaleLine(__m128i y0, __m128i y1, __m128i c) {
+    const __m128i round = _mm_set1_epi32(1 << (shift - 1));
+    __m128i lo = _mm_add_epi32(_mm_add_epi32(y0, _mm_unpacklo_epi32(c, c)), round);
+    __m128i hi = _mm_add_epi32(_mm_add_epi32(y1, _mm_unpackhi_epi32(c, c)), round);
+    return _mm_packs_epi32(_mm_srai_epi32(lo, shift), _mm_srai_epi32(hi, shift));
+}
+
+inline void loadLuma(const int *Yblk, __m128i &y0, __m128i &y1) {
+    y0 = _mm_slli_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i *>(Yblk)), 10);
+    y1 = _mm_slli_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i *>(Yblk + 4)), 10);
+}
+
+// CLAMP5, on values which went through the saturation of the 16 bits packing already
+inline __m128i clamp5(__m128i c) {
+    return _mm_min_epi16(_mm_max_epi16(_mm_adds_epi16(c, _mm_set1_epi16(16)), _mm_setzero_si128()),
+                         _mm_set1_epi16(31));
+}
+
+// CLAMP8 for a whole line of 16, packed to bytes
+inline __m128i clamp8(__m128i left, __m128i right) {
+    const __m128i bias = _mm_set1_epi16(128);
+    return _mm_packus_epi16(_mm_adds_epi16(left, bias), _mm_adds_epi16(right, bias));
+}
+
+// 16 pixels of 24 bits: the pixels are first widened to 32 bits, then written 3 bytes apart, each write
+// overwriting the padding byte of the previous one
+inline void interleave24(uint8_t *image, __m128i r, __m128i g, __m128i b) {
+    const __m128i zero = _mm_setzero_si128();
+    uint32_t pixels[16];
+    __m128i rg = _mm_unpacklo_epi8(r, g);
+    __m128i b0 = _mm_unpacklo_epi8(b, zero);
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(pixels), _mm_unpacklo_epi16(rg, b0));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(pixels + 4), _mm_unpackhi_epi16(rg, b0));
+    rg = _mm_unpackhi_epi8(r, g);
+    b0 = _mm_unpackhi_epi8(b, zero);
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(pixels + 8), _mm_unpacklo_epi16(rg, b0));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(pixels + 12), _mm_unpackhi_epi16(rg, b0));
+    for (unsigned i = 0; i < 15; i++) memcpy(image + i * 3, pixels + i, 4);
+    memcpy(image + 15 * 3, pixels + 15, 3);
+}
+
+}  // namespace
+#endif
+
+static inline void putlinebw15(uint16_t *image, int *Yblk, int A) {
+    int i;
+
+    for (i = 0; i < 8; i++, Yblk++) {
+        int Y = *Yblk;
+        // missing rounding
+        image[i] = SWAP_LE16((CLAMP5(Y >> 3) * 0x421) | A);
+    }
+}
+
+static inline void putquadrgb15(uint16_t *image, int *Yblk, int Cr, int Cb, int A) {
+    int Y, R, G, B;
+    R = MULR(Cr);
+    G = MULG2(Cb, Cr);
+    B = MULB(Cb);
+
+    // added transparency
+    Y = MULY(Yblk[0]);
+    image[0] = MAKERGB15(CLAMP_SCALE5(Y + R), CLAMP_SCALE5(Y + G), CLAMP_SCALE5(Y + B), A);
+    Y = MULY(Yblk[1]);
+    image[1] = MAKERGB15(CLAMP_SCALE5(Y + R), CLAMP_SCALE5(Y + G), CLAMP_SCALE5(Y + B), A);
+    Y = MULY(Yblk[8]);
+    image[16] = MAKERGB15(CLAMP_SCALE5(Y + R), CLAMP_SCALE5(Y + G), CLAMP_SCALE5(Y + B), A);
+    Y = MULY(Yblk[9]);
+    image[17] = MAKERGB15(CLAMP_SCALE5(Y + R), CLAMP_SCALE5(Y + G), CLAMP_SCALE5(Y + B), A);
+}
+
+void PCSX::MDECKernels::yuv2rgb15(int *blk, uint16_t *image, bool bnw, bool stp) {
+    int x, y;
+    const int A = stp ? 0x8000 : 0;
+    int *Yblk = blk + DSIZE2 * 2;
+    int *Crblk = blk;
+    int *Cbblk = blk + DSIZE2;
+
+#ifdef MDEC_SSE2
+    // whole lines of 8 pixels, the macroblock being Y1 Y2 on top of Y3 Y4
+    const __m128i alpha = _mm_set1_epi16(A);
+    for (y = 0; y < 16; y++, Yblk += 8, image += 16) {
+        if (y == 8) Yblk += DSIZE2;
+        for (x = 0; x < 2; x++) {
+            const int *line = Yblk + DSIZE2 * x;
+            __m128i pixels;
+            if (bnw) {
+                __m128i y0 = _mm_srai_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i *>(line)), 3);
+                __m128i y1 = _mm_srai_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i *>(line + 4)), 3);
+                __m128i c = clamp5(_mm_packs_epi32(y0, y1));
+                pixels = _mm_or_si128(_mm_or_si128(c, _mm_slli_epi16(c, 5)), _mm_slli_epi16(c, 10));
+            } else {
+                __m128i R, G, B, y0, y1;
+                const unsigned offset = DSIZE * (y >> 1) + 4 * x;
+                chroma4(Crblk + offset, Cbblk + offset, R, G, B);
+                loadLuma(line, y0, y1);
+                R = clamp5(scaleLine<23>(y0, y1, R));
+                G = clamp5(scaleLine<23>(y0, y1, G));
+                B = clamp5(scaleLine<23>(y0, y1, B));
+                pixels = _mm_or_si128(_mm_or_si128(R, _mm_slli_epi16(G, 5)), _mm_slli_epi16(B, 10));
+            }
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(image + 8 * x), _mm_or_si128(pixels, alpha));
+        }
+    }
+#else
+    if (!bnw) {
+        for (y = 0; y < 16; y += 2, Crblk += 4, Cbblk += 4, Yblk += 8, image += 24) {
+            if (y == 8) Yblk += DSIZE2;
+            for (x = 0; x < 4; x++, image += 2, Crblk++, Cbblk++, Yblk += 2) {
+                putquadrgb15(image, Yblk, *Crblk, *Cbblk, A);
+                putquadrgb15(image + 8, Yblk + DSIZE2, *(Crblk + 4), *(Cbblk + 4), A);
+            }
+        }
+    } else {
+        for (y = 0; y < 16; y++, Yblk += 8, image += 16) {
+            if (y == 8) Yblk += DSIZE2;
+            putlinebw15(image, Yblk, A);
+            putlinebw15(image + 8, Yblk + DSIZE2, A);
+        }
+    }
+#endif
+}
+
+static inline void putlinebw24(uint8_t *image, int *Yblk) {
+    int i;
+    unsigned char Y;
+    for (i = 0; i < 8 * 3; i += 3, Yblk++) {
+        Y = CLAMP8(*Yblk);
+        image[i + 0] = Y;
+        image[i + 1] = Y;
+        image[i + 2] = Y;
+    }
+}
+
+static inline void putquadrgb24(uint8_t *image, int *Yblk, int Cr, int Cb) {
+    int Y, R, G, B;
+
+    R = MULR(Cr);
+    G = MULG2(Cb, Cr);
+    B = MULB(Cb);
+
+    Y = MULY(Yblk[0]);
+    image[0 * 3 + 0] = CLAMP_SCALE8(Y + R);
+    image[0 * 3 + 1] = CLAMP_SCALE8(Y + G);
+    image[0 * 3 + 2] = CLAMP_SCALE8(Y + B);
+    Y = MULY(Yblk[1]);
+    image[1 * 3 + 0] = CLAMP_SCALE8(Y + R);
+    image[1 * 3 + 1] = CLAMP_SCALE8(Y + G);
+    image[1 * 3 + 2] = CLAMP_SCALE8(Y + B);
+    Y = MULY(Yblk[8]);
+    image[16 * 3 + 0] = CLAMP_SCALE8(Y + R);
+    image[16 * 3 + 1] = CLAMP_SCALE8(Y + G);
+    image[16 * 3 + 2] = CLAMP_SCALE8(Y + B);
+    Y = MULY(Yblk[9]);
+    image[17 * 3 + 0] = CLAMP_SCALE8(Y + R);
+    image[17 * 3 + 1] = CLAMP_SCALE8(Y + G);
+    image[17 * 3 + 2] = CLAMP_SCALE8(Y + B);
+}
+
+void PCSX::MDECKernels::yuv2rgb24(int *blk, uint8_t *image, bool bnw) {
+    int x, y;
+    int *Yblk = blk + DSIZE2 * 2;
+    int *Crblk = blk;
+    int *Cbblk = blk + DSIZE2;
+
+#ifdef MDEC_SSE2
+    for (y = 0; y < 16; y++, Yblk += 8, image += 16 * 3) {
+        if (y == 8) Yblk += DSIZE2;
+        __m128i lines[2][3];
+        for (x = 0; x < 2; x++) {
+            const int *line = Yblk + DSIZE2 * x;
+            if (bnw) {
+                __m128i y0 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(line));
+                __m128i y1 = _mm_loadu_si128(reinterpret_cast<const __m128i *>(line + 4));
+                lines[x][0] = lines[x][1] = lines[x][2] = _mm_packs_epi32(y0, y1);
+            } else {
+                __m128i R, G, B, y0, y1;
+                const unsigned offset = DSIZE * (y >> 1) + 4 * x;
+                chroma4(Crblk + offset, Cbblk + offset, R, G, B);
+                loadLuma(line, y0, y1);
+                lines[x][0] = scaleLine<20>(y0, y1, R);
+                lines[x][1] = scaleLine<20>(y0, y1, G);
+                lines[x][2] = scaleLine<20>(y0, y1, B);
+            }
+        }
+        interleave24(image, clamp8(lines[0][0], lines[1][0]), clamp8(lines[0][1], lines[1][1]),
+                     clamp8(lines[0][2], lines[1][2]));
+    }
+#else
+    if (!bnw) {
+        for (y = 0; y < 16; y += 2, Crblk += 4, Cbblk += 4, Yblk += 8, image += 8 * 3 * 3) {
+            if (y == 8) Yblk += DSIZE2;
+            for (x = 0; x < 4; x++, image += 6, Crblk++, Cbblk++, Yblk += 2) {
+                putquadrgb24(image, Yblk, *Crblk, *Cbblk);
+                putquadrgb24(image + 8 * 3, Yblk + DSIZE2, *(Crblk + 4), *(Cbblk + 4));
+            }
+        }
+    } else {
+        for (y = 0; y < 16; y++, Yblk += 8, image += 16 * 3) {
+            if (y == 8) Yblk += DSIZE2;
+            putlinebw24(image, Yblk);
+            putlinebw24(image + 8 * 3, Yblk + DSIZE2);
+        }
+    }
+#endif
+}
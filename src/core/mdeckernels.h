@@ -0,0 +1,43 @@
+/*  PPF Patch Support for PCSX-Reloaded
+ *  Copyright (c) 2009, Wei Mingzhi <whistler_wmz@users.sf.net>.
+ *
+ *  This program is free software; you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation; either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  This program is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with this program; if not, write to the Free Software
+ *  Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+namespace PCSX {
+
+namespace MDECKernels {
+
+// The pixel crunching of the MDEC, away from its registers and DMA: a decoded block is DSIZE lines of
+// DSIZE coefficients.
+static const unsigned DSIZE = 8;
+static const unsigned DSIZE2 = DSIZE * DSIZE;
+
+// Inverse DCT of a block, in place. used_col is -1 when the block has only its DC coefficient, and
+// otherwise the mask of the columns which have non zero coefficients below row 0.
+void idct(int *block, int used_col);
+
+// A macroblock, as the 6 blocks Cr Cb Y1 Y2 Y3 Y4, converted to 16x16 pixels of 15 bits, with the mask
+// bit set when stp is, or of 24 bits; bnw converts the luma only, into shades of grey.
+void yuv2rgb15(int *blk, uint16_t *image, bool bnw, bool stp);
+void yuv2rgb24(int *blk, uint8_t *image, bool bnw);
+
+}  // namespace MDECKernels
+
+}  // namespace PCSX
@@ -33,8 +33,8 @@
 struct PGXP_value_Tag;
 typedef struct PGXP_value_Tag PGXP_value;
 
-extern PGXP_value* g_GTE_data_reg;
-extern PGXP_value* g_GTE_ctrl_reg;
+extern thread_local PGXP_value g_GTE_data_reg[32];
+extern thread_local PGXP_value g_GTE_ctrl_reg[32];
 
 void PGXP_InitGTE();
 
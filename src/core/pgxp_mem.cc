@@ -1,15 +1,27 @@
 #include "core/pgxp_mem.h"
+
+#include <memory>
+
 #include "core/pgxp_cpu.h"
 #include "core/pgxp_gte.h"
 #include "core/pgxp_value.h"
 
-static PGXP_value s_mem[3 * 2048 * 1024 / 4];  // mirror 2MB in 32-bit words * 3
+// Mirrors 2MB in 32-bit words * 3, but sparsely: a page only gets allocated on its first write,
+// and untouched words all read as the same zeroed, ie uninitialised, value.
 static const uint32_t s_userMemOffset = 0;
 static const uint32_t s_scratchOffset = 2048 * 1024 / 4;
 static const uint32_t s_registerOffset = 2 * 2048 * 1024 / 4;
 static const uint32_t s_invalidAddress = 3 * 2048 * 1024 / 4;
 
-void PGXP_InitMem() { memset(s_mem, 0, sizeof(s_mem)); }
+static const uint32_t s_pageShift = 10;  // 4KB of PSX memory
+static const uint32_t s_pageSize = 1 << s_pageShift;
+static thread_local std::unique_ptr<PGXP_value[]> s_pages[s_invalidAddress >> s_pageShift];
+static const PGXP_value s_untouched = {};
+
+// releases every page
+void PGXP_InitMem() {
+    for (auto& page : s_pages) page.reset();
+}
 
 void PGXP_Init() {
     PGXP_InitMem();
@@ -17,10 +29,6 @@ void PGXP_Init() {
     PGXP_InitGTE();
 }
 
-uint8_t* PGXP_GetMem() {
-    return (uint8_t*)(s_mem);  // PCSX::g_emulator.config().PGXP_GTE ? (char*)(s_mem) : NULL;
-}
-
 /*  Playstation Memory Map (from Playstation doc by Joshua Walker)
 0x0000_0000-0x0000_ffff     Kernel (64K)
 0x0001_0000-0x001f_ffff     User Memory (1.9 Meg)
@@ -106,11 +114,23 @@ uint32_t PGXP_ConvertAddress(uint32_t addr) {
     return paddr;
 }
 
+// for reading only: untouched words all point to the same value
 PGXP_value* PGXP_GetPtr(uint32_t addr) {
     addr = PGXP_ConvertAddress(addr);
 
-    if (addr != s_invalidAddress) return &s_mem[addr];
-    return NULL;
+    if (addr == s_invalidAddress) return NULL;
+    PGXP_value* page = s_pages[addr >> s_pageShift].get();
+    if (!page) return const_cast<PGXP_value*>(&s_untouched);
+    return &page[addr & (s_pageSize - 1)];
+}
+
+static PGXP_value* GetWritePtr(uint32_t addr) {
+    addr = PGXP_ConvertAddress(addr);
+
+    if (addr == s_invalidAddress) return NULL;
+    auto& page = s_pages[addr >> s_pageShift];
+    if (!page) page.reset(new PGXP_value[s_pageSize]());
+    return &page[addr & (s_pageSize - 1)];
 }
 
 PGXP_value* PGXP_ReadMem(uint32_t addr) { return PGXP_GetPtr(addr); }
@@ -118,7 +138,8 @@ PGXP_value* PGXP_ReadMem(uint32_t addr) { return PGXP_GetPtr(addr); }
 void ValidateAndCopyMem(PGXP_value* dest, uint32_t addr, uint32_t value) {
     PGXP_value* pMem = PGXP_GetPtr(addr);
     if (pMem != NULL) {
-        Validate(pMem, value);
+        // an untouched word has no valid flag to clear
+        if (pMem != &s_untouched) Validate(pMem, value);
         *dest = *pMem;
         return;
     }
@@ -144,7 +165,7 @@ void ValidateAndCopyMem16(PGXP_value* dest, uint32_t addr, uint32_t value, int s
         }
 
         // validate and copy whole value
-        MaskValidate(pMem, val.d, mask.d, validMask);
+        if (pMem != &s_untouched) MaskValidate(pMem, val.d, mask.d, validMask);
         *dest = *pMem;
 
         // if high word then shift
@@ -166,13 +187,13 @@ void ValidateAndCopyMem16(PGXP_value* dest, uint32_t addr, uint32_t value, int s
 }
 
 void WriteMem(PGXP_value* value, uint32_t addr) {
-    PGXP_value* pMem = PGXP_GetPtr(addr);
+    PGXP_value* pMem = GetWritePtr(addr);
 
     if (pMem) *pMem = *value;
 }
 
 void WriteMem16(PGXP_value* src, uint32_t addr) {
-    PGXP_value* dest = PGXP_GetPtr(addr);
+    PGXP_value* dest = GetWritePtr(addr);
     psx_value* pVal = NULL;
 
     if (dest) {
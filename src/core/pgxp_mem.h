@@ -30,14 +30,13 @@
 
 #include "core/psxemulator.h"
 
-void PGXP_Init();        // initialise memory
-uint8_t* PGXP_GetMem();  // return pointer to precision memory
+void PGXP_Init();  // initialise memory, releasing what got allocated
 uint32_t PGXP_ConvertAddress(uint32_t addr);
 
 struct PGXP_value_Tag;
 typedef struct PGXP_value_Tag PGXP_value;
 
-PGXP_value* PGXP_GetPtr(uint32_t addr);
+PGXP_value* PGXP_GetPtr(uint32_t addr);  // read only
 PGXP_value* PGXP_ReadMem(uint32_t addr);
 
 void ValidateAndCopyMem(PGXP_value* dest, uint32_t addr, uint32_t value);
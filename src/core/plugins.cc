@@ -29,10 +29,11 @@
 #include "core/psxemulator.h"
 #include "spu/interface.h"
 
-static char IsoFile[MAXPATHLEN] = "";
-static char ExeFile[MAXPATHLEN] = "";
-static char AppPath[MAXPATHLEN] = "";  // Application path(== pcsxr.exe directory)
-static char LdrFile[MAXPATHLEN] = "";  // bin-load file
+// what each machine runs is its own; the application path is the same for all of them
+static thread_local char IsoFile[MAXPATHLEN] = "";
+static thread_local char ExeFile[MAXPATHLEN] = "";
+static char AppPath[MAXPATHLEN] = "";               // Application path(== pcsxr.exe directory)
+static thread_local char LdrFile[MAXPATHLEN] = "";  // bin-load file
 
 #if 0
 
@@ -143,7 +144,7 @@ PADquery PAD1_query;
 PADreadPort1 PAD1_readPort1;
 PADkeypressed PAD1_keypressed;
 PADstartPoll PAD1_startPoll;
-PADpoll PCSX::g_emulator.m_pad1->poll;
+PADpoll PCSX::g_emulator->m_pad1->poll;
 PADsetSensitive PAD1_setSensitive;
 PADregisterVibration PAD1_registerVibration;
 PADregisterCursor PAD1_registerCursor;
@@ -159,7 +160,7 @@ PADquery PAD2_query;
 PADreadPort2 PAD2_readPort2;
 PADkeypressed PAD2_keypressed;
 PADstartPoll PAD2_startPoll;
-PADpoll PCSX::g_emulator.m_pad2->poll;
+PADpoll PCSX::g_emulator->m_pad2->poll;
 PADsetSensitive PAD2_setSensitive;
 PADregisterVibration PAD2_registerVibration;
 PADregisterCursor PAD2_registerCursor;
@@ -482,7 +483,7 @@ static int LoadPAD1plugin() {
     PAD1_about = PAD1__about;
     PAD1_keypressed = PAD1__keypressed;
     PAD1_startPoll = PAD1__startPoll;
-    PCSX::g_emulator.m_pad1->poll = PAD1__poll;
+    PCSX::g_emulator->m_pad1->poll = PAD1__poll;
     PAD1_registerVibration = PAD1__registerVibration;
     PAD1_registerCursor = PAD1__registerCursor;
 
@@ -545,7 +546,7 @@ static int LoadPAD2plugin() {
     PAD2_about = PAD2__about;
     PAD2_keypressed = PAD2__keypressed;
     PAD2_startPoll = PAD2__startPoll;
-    PCSX::g_emulator.m_pad2->poll = PAD2__poll;
+    PCSX::g_emulator->m_pad2->poll = PAD2__poll;
     PAD2_registerVibration = PAD2__registerVibration;
     PAD2_registerCursor = PAD2__registerCursor;
 
@@ -676,7 +677,7 @@ static int LoadSIO1plugin(const char *SIO1dll) {
 
 #endif
 
-void clearDynarec(void) { PCSX::g_emulator.m_psxCpu->Reset(); }
+void clearDynarec(void) { PCSX::g_emulator->m_psxCpu->Reset(); }
 
 int LoadPlugins() {
     long ret;
@@ -684,25 +685,25 @@ int LoadPlugins() {
     ReleasePlugins();
 
     if (LoadGPUplugin() == -1) return -1;
-    if (LoadNETplugin() == -1) PCSX::g_emulator.config().UseNet = false;
+    if (LoadNETplugin() == -1) PCSX::g_emulator->config().UseNet = false;
 
 #ifdef ENABLE_SIO1API
     if (LoadSIO1plugin() == -1) return -1;
 #endif
 
-    PCSX::g_emulator.m_cdrom->m_iso.init();
-    ret = PCSX::g_emulator.m_gpu->init();
+    PCSX::g_emulator->m_cdrom->m_iso.init();
+    ret = PCSX::g_emulator->m_gpu->init();
     if (ret < 0) {
         PCSX::g_system->message(_("Error initializing GPU plugin: %d"), ret);
         return -1;
     }
-    ret = PCSX::g_emulator.m_spu->init();
+    ret = PCSX::g_emulator->m_spu->init();
     if (ret < 0) {
         PCSX::g_system->message(_("Error initializing SPU plugin: %d"), ret);
         return -1;
     }
 
-    if (PCSX::g_emulator.config().UseNet) {
+    if (PCSX::g_emulator->config().UseNet) {
         ret = NET_init();
         if (ret < 0) {
             PCSX::g_system->message(_("Error initializing NetPlay plugin: %d"), ret);
@@ -723,15 +724,15 @@ int LoadPlugins() {
 }
 
 void ReleasePlugins() {
-    if (PCSX::g_emulator.config().UseNet) {
+    if (PCSX::g_emulator->config().UseNet) {
         long ret = NET_close();
-        if (ret < 0) PCSX::g_emulator.config().UseNet = false;
+        if (ret < 0) PCSX::g_emulator->config().UseNet = false;
     }
 
-    PCSX::g_emulator.m_cdrom->m_iso.shutdown();
-    PCSX::g_emulator.m_gpu->shutdown();
-    PCSX::g_emulator.m_spu->shutdown();
-    if (PCSX::g_emulator.config().UseNet && NET_shutdown) NET_shutdown();
+    PCSX::g_emulator->m_cdrom->m_iso.shutdown();
+    PCSX::g_emulator->m_gpu->shutdown();
+    PCSX::g_emulator->m_spu->shutdown();
+    if (PCSX::g_emulator->config().UseNet && NET_shutdown) NET_shutdown();
 
 #ifdef ENABLE_SIO1API
     SIO1_shutdown();
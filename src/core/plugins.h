@@ -170,7 +170,7 @@ extern PADquery PAD1_query;
 extern PADreadPort1 PAD1_readPort1;
 extern PADkeypressed PAD1_keypressed;
 extern PADstartPoll PAD1_startPoll;
-extern PADpoll PCSX::g_emulator.m_pad1->poll;
+extern PADpoll PCSX::g_emulator->m_pad1->poll;
 extern PADsetSensitive PAD1_setSensitive;
 extern PADregisterVibration PAD1_registerVibration;
 extern PADregisterCursor PAD1_registerCursor;
@@ -185,7 +185,7 @@ extern PADquery PAD2_query;
 extern PADreadPort2 PAD2_readPort2;
 extern PADkeypressed PAD2_keypressed;
 extern PADstartPoll PAD2_startPoll;
-extern PADpoll PCSX::g_emulator.m_pad2->poll;
+extern PADpoll PCSX::g_emulator->m_pad2->poll;
 extern PADsetSensitive PAD2_setSensitive;
 extern PADregisterVibration PAD2_registerVibration;
 extern PADregisterCursor PAD2_registerCursor;
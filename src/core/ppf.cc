@@ -184,23 +184,23 @@ void PCSX::PPF::BuildPPFCache() {
 
     FreePPFCache();
 
-    if (PCSX::g_emulator.m_cdromId[0] == '\0') return;
+    if (PCSX::g_emulator->m_cdromId[0] == '\0') return;
 
     // Generate filename in the format of SLUS_123.45
-    buffer[0] = toupper(PCSX::g_emulator.m_cdromId[0]);
-    buffer[1] = toupper(PCSX::g_emulator.m_cdromId[1]);
-    buffer[2] = toupper(PCSX::g_emulator.m_cdromId[2]);
-    buffer[3] = toupper(PCSX::g_emulator.m_cdromId[3]);
+    buffer[0] = toupper(PCSX::g_emulator->m_cdromId[0]);
+    buffer[1] = toupper(PCSX::g_emulator->m_cdromId[1]);
+    buffer[2] = toupper(PCSX::g_emulator->m_cdromId[2]);
+    buffer[3] = toupper(PCSX::g_emulator->m_cdromId[3]);
     buffer[4] = '_';
-    buffer[5] = PCSX::g_emulator.m_cdromId[4];
-    buffer[6] = PCSX::g_emulator.m_cdromId[5];
-    buffer[7] = PCSX::g_emulator.m_cdromId[6];
+    buffer[5] = PCSX::g_emulator->m_cdromId[4];
+    buffer[6] = PCSX::g_emulator->m_cdromId[5];
+    buffer[7] = PCSX::g_emulator->m_cdromId[6];
     buffer[8] = '.';
-    buffer[9] = PCSX::g_emulator.m_cdromId[7];
-    buffer[10] = PCSX::g_emulator.m_cdromId[8];
+    buffer[9] = PCSX::g_emulator->m_cdromId[7];
+    buffer[10] = PCSX::g_emulator->m_cdromId[8];
     buffer[11] = '\0';
 
-    sprintf(szPPF, "%s/%s", PCSX::g_emulator.settings.get<Emulator::SettingPpfDir>().c_str(), buffer);
+    sprintf(szPPF, "%s/%s", PCSX::g_emulator->settings.get<Emulator::SettingPpfDir>().c_str(), buffer);
 
     ppffile = fopen(szPPF, "rb");
     if (ppffile == NULL) return;
@@ -27,6 +27,7 @@ class PPF {
     void BuildPPFCache();
     void FreePPFCache();
     void CheckPPFCache(uint8_t *pB, uint8_t m, uint8_t s, uint8_t f);
+    bool isActive() const { return s_ppfCache != nullptr; }
 
   private:
     struct PPF_DATA {
@@ -0,0 +1,76 @@
+/***************************************************************************
+ *   Copyright (C) 2019 PCSX-Redux authors                                 *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.           *
+ ***************************************************************************/
+
+
+#include "core/profiler.h"
+
+#include <algorithm>
+#include <chrono>
+
+typedef std::chrono::steady_clock Clock;
+
+static int64_t now() { return Clock::now().time_since_epoch().count(); }
+
+static double toSeconds(double ticks) { return ticks * Clock::period::num / Clock::period::den; }
+
+void PCSX::Profiler::start() {
+    std::fill(std::begin(m_time), std::end(m_time), 0);
+    std::fill(std::begin(m_switches), std::end(m_switches), 0);
+    std::fill(std::begin(m_calls), std::end(m_calls), 0);
+
+    static const int CALIBRATION = 10000;
+    int64_t first = now(), last = first;
+    for (int i = 0; i < CALIBRATION; i++) last = now();
+    m_clockCost = double(last - first) / CALIBRATION;
+
+    m_current = CPU;
+    m_last = now();
+}
+
+PCSX::Profiler::Section PCSX::Profiler::enter(Section section) {
+    int64_t time = now();
+    m_time[m_current] += time - m_last;
+    m_switches[m_current]++;
+    m_last = time;
+    Section previous = m_current;
+    m_current = section;
+    return previous;
+}
+
+double PCSX::Profiler::seconds(Section section) const {
+    double times[SECTIONS];
+    for (int i = 0; i < SECTIONS; i++) times[i] = std::max(0.0, m_time[i] - m_clockCost * m_switches[i]);
+
+    // the calls to sampled sections that weren't timed ran as part of the CPU core
+    for (int i = 0; i < SECTIONS; i++) {
+        uint64_t timed = m_calls[i] / SAMPLING;
+        if (!timed) continue;
+        double extra = std::min(times[i] * (m_calls[i] - timed) / timed, times[CPU]);
+        times[i] += extra;
+        times[CPU] -= extra;
+    }
+
+    return toSeconds(times[section]);
+}
+
+double PCSX::Profiler::overhead() const {
+    uint64_t switches = 0;
+    for (auto count : m_switches) switches += count;
+    return toSeconds(m_clockCost * switches);
+}
@@ -0,0 +1,102 @@
+/***************************************************************************
+ *   Copyright (C) 2019 PCSX-Redux authors                                 *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.           *
+ ***************************************************************************/
+
+#pragma once
+
+#include <stdint.h>
+
+#include "core/psxemulator.h"
+
+namespace PCSX {
+
+// Splits the host time of the emulation thread between the parts of the machine, for the
+// benchmark runner. It only exists while benchmarking; otherwise a section costs a null check.
+// The accounting is exclusive: entering a section pauses the one it was entered from, and
+// whatever runs outside of any section is the CPU core's. The cost of reading the clock is
+// measured when starting, and taken back out of the sections it got charged to.
+class Profiler {
+  public:
+    enum Section { CPU, GTE, GPU, SPU, MDEC, CDROM, PRESENT, SECTIONS };
+    // sampled sections only time one call in SAMPLING, and extrapolate the others from it
+    static const unsigned SAMPLING = 64;
+
+    // short names, for the json report
+    static const char *name(Section section) {
+        static const char *names[SECTIONS] = {"cpu", "gte", "gpu", "spu", "mdec", "cdrom", "present"};
+        return names[section];
+    }
+    static const char *description(Section section) {
+        static const char *descriptions[SECTIONS] = {
+            "CPU core", "GTE", "GPU rasterization", "SPU mixing", "MDEC", "CD I/O", "presentation",
+        };
+        return descriptions[section];
+    }
+
+    void start();
+    // accounts for the time since the last switch
+    void stop() { enter(CPU); }
+    double seconds(Section section) const;
+    // what reading the clock cost over the run, already taken out of the sections
+    double overhead() const;
+
+    // returns the section that was running, for the caller to go back to it
+    Section enter(Section section);
+    // counts a call to a sampled section; true for the ones to time
+    bool sample(Section section) { return ++m_calls[section] % SAMPLING == 0; }
+
+    // times the rest of the enclosing block as part of a section; only for the emulation thread
+    class Scope {
+      public:
+        explicit Scope(Section section) : m_profiler(g_emulator->m_profiler.get()) {
+            if (m_profiler) m_previous = m_profiler->enter(section);
+        }
+        ~Scope() {
+            if (m_profiler) m_profiler->enter(m_previous);
+        }
+        Scope(const Scope &) = delete;
+        Scope &operator=(const Scope &) = delete;
+
+      protected:
+        Scope() = default;
+        Profiler *m_profiler = nullptr;
+        Section m_previous = CPU;
+    };
+
+    // for the sections called so often that timing each call would mostly measure the clock;
+    // they have to be entered from the CPU core, which gets the extrapolated time taken back
+    class SampledScope : public Scope {
+      public:
+        explicit SampledScope(Section section) {
+            Profiler *profiler = g_emulator->m_profiler.get();
+            if (!profiler || !profiler->sample(section)) return;
+            m_profiler = profiler;
+            m_previous = profiler->enter(section);
+        }
+    };
+
+  private:
+    int64_t m_time[SECTIONS] = {};      // in clock ticks
+    uint64_t m_switches[SECTIONS] = {};  // how many times each section was left, each time reading the clock
+    uint64_t m_calls[SECTIONS] = {};     // for the sampled sections
+    int64_t m_last = 0;
+    double m_clockCost = 0;  // in ticks, per reading
+    Section m_current = CPU;
+};
+
+}  // namespace PCSX
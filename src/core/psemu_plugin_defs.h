@@ -201,7 +201,7 @@ struct PadDataS {
 typedef struct {
         char EmuName[32];
         char CdromID[9];    // ie. 'SCPH12345', no \0 trailing character
-        char PCSX::g_emulator.m_cdromLabel[11];
+        char PCSX::g_emulator->m_cdromLabel[11];
         void *psxMem;
         GPUshowScreenPic GPU_showScreenPic;
         GPUdisplayText GPU_displayText;
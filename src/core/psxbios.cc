@@ -359,39 +359,39 @@ const char *PCSX::Bios::C0names[256] = {
     "PatchAOTable",
 };
 
-//#define r0 (PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.n.r0)
-#define at (PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.n.at)
-#define v0 (PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.n.v0)
-#define v1 (PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.n.v1)
-#define a0 (PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.n.a0)
-#define a1 (PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.n.a1)
-#define a2 (PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.n.a2)
-#define a3 (PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.n.a3)
-#define t0 (PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.n.t0)
-#define t1 (PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.n.t1)
-#define t2 (PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.n.t2)
-#define t3 (PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.n.t3)
-#define t4 (PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.n.t4)
-#define t5 (PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.n.t5)
-#define t6 (PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.n.t6)
-#define t7 (PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.n.t7)
-#define t8 (PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.n.t8)
-#define t9 (PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.n.t9)
-#define s0 (PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.n.s0)
-#define s1 (PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.n.s1)
-#define s2 (PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.n.s2)
-#define s3 (PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.n.s3)
-#define s4 (PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.n.s4)
-#define s5 (PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.n.s5)
-#define s6 (PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.n.s6)
-#define s7 (PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.n.s7)
-#define k0 (PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.n.k0)
-#define k1 (PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.n.k1)
-#define gp (PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.n.gp)
-#define sp (PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.n.sp)
-#define fp (PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.n.s8)
-#define ra (PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.n.ra)
-#define pc0 (PCSX::g_emulator.m_psxCpu->m_psxRegs.pc)
+//#define r0 (PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.n.r0)
+#define at (PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.n.at)
+#define v0 (PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.n.v0)
+#define v1 (PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.n.v1)
+#define a0 (PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.n.a0)
+#define a1 (PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.n.a1)
+#define a2 (PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.n.a2)
+#define a3 (PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.n.a3)
+#define t0 (PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.n.t0)
+#define t1 (PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.n.t1)
+#define t2 (PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.n.t2)
+#define t3 (PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.n.t3)
+#define t4 (PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.n.t4)
+#define t5 (PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.n.t5)
+#define t6 (PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.n.t6)
+#define t7 (PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.n.t7)
+#define t8 (PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.n.t8)
+#define t9 (PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.n.t9)
+#define s0 (PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.n.s0)
+#define s1 (PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.n.s1)
+#define s2 (PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.n.s2)
+#define s3 (PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.n.s3)
+#define s4 (PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.n.s4)
+#define s5 (PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.n.s5)
+#define s6 (PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.n.s6)
+#define s7 (PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.n.s7)
+#define k0 (PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.n.k0)
+#define k1 (PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.n.k1)
+#define gp (PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.n.gp)
+#define sp (PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.n.sp)
+#define fp (PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.n.s8)
+#define ra (PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.n.ra)
+#define pc0 (PCSX::g_emulator->m_psxCpu->m_psxRegs.pc)
 
 #define Ra0 (assert(PSXM(a0) != NULL), (char *)PSXM(a0))
 #define Ra1 (assert(PSXM(a1) != NULL), (char *)PSXM(a1))
@@ -493,7 +493,7 @@ class BiosImpl : public PCSX::Bios {
 
         m_hleSoftCall = true;
 
-        while (pc0 != 0x80001000) PCSX::g_emulator.m_psxCpu->ExecuteBlock();
+        while (pc0 != 0x80001000) PCSX::g_emulator->m_psxCpu->ExecuteBlock();
 
         m_hleSoftCall = false;
     }
@@ -505,7 +505,7 @@ class BiosImpl : public PCSX::Bios {
 
         m_hleSoftCall = true;
 
-        while (pc0 != 0x80001000) PCSX::g_emulator.m_psxCpu->ExecuteBlock();
+        while (pc0 != 0x80001000) PCSX::g_emulator->m_psxCpu->ExecuteBlock();
         ra = sra;
 
         m_hleSoftCall = false;
@@ -522,16 +522,16 @@ class BiosImpl : public PCSX::Bios {
     }
 
     inline void SaveRegs() {
-        memcpy(s_regs, PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.r, 32 * 4);
-        s_regs[32] = PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.n.lo;
-        s_regs[33] = PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.n.hi;
-        s_regs[34] = PCSX::g_emulator.m_psxCpu->m_psxRegs.pc;
+        memcpy(s_regs, PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.r, 32 * 4);
+        s_regs[32] = PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.n.lo;
+        s_regs[33] = PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.n.hi;
+        s_regs[34] = PCSX::g_emulator->m_psxCpu->m_psxRegs.pc;
     }
 
     inline void LoadRegs() {
-        memcpy(PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.r, s_regs, 32 * 4);
-        PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.n.lo = s_regs[32];
-        PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.n.hi = s_regs[33];
+        memcpy(PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.r, s_regs, 32 * 4);
+        PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.n.lo = s_regs[32];
+        PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.n.hi = s_regs[33];
     }
 
     /*                                           *
@@ -590,7 +590,7 @@ class BiosImpl : public PCSX::Bios {
         jmp_buf[1] = sp;
         jmp_buf[2] = fp;
         for (i = 0; i < 8; i++)  // s0-s7
-            jmp_buf[3 + i] = PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.r[16 + i];
+            jmp_buf[3 + i] = PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.r[16 + i];
         jmp_buf[11] = gp;
 
         v0 = 0;
@@ -607,7 +607,7 @@ class BiosImpl : public PCSX::Bios {
         sp = jmp_buf[1];         /* sp */
         fp = jmp_buf[2];         /* fp */
         for (i = 0; i < 8; i++)  // s0-s7
-            PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.r[16 + i] = jmp_buf[3 + i];
+            PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.r[16 + i] = jmp_buf[3 + i];
         gp = jmp_buf[11]; /* gp */
 
         v0 = a1;
@@ -1126,7 +1126,7 @@ class BiosImpl : public PCSX::Bios {
         }
 
         // return pointer to allocated memory
-        v0 = ((unsigned long)chunk - (unsigned long)PCSX::g_emulator.m_psxMem->g_psxM) + 4;
+        v0 = ((unsigned long)chunk - (unsigned long)PCSX::g_emulator->m_psxMem->g_psxM) + 4;
         v0 |= 0x80000000;
         PCSX::g_system->biosPrintf("malloc %x,%x\n", v0, a0);
         pc0 = ra;
@@ -1178,7 +1178,7 @@ class BiosImpl : public PCSX::Bios {
         *s_heap_addr = SWAP_LE32(size | 1);
 
         PCSX::g_system->biosPrintf("InitHeap %x,%x : %lx %x\n", a0, a1,
-                                      (uintptr_t)s_heap_addr - (uintptr_t)PCSX::g_emulator.m_psxMem->g_psxM, size);
+                                      (uintptr_t)s_heap_addr - (uintptr_t)PCSX::g_emulator->m_psxMem->g_psxM, size);
 
         pc0 = ra;
     }
@@ -1277,14 +1277,14 @@ class BiosImpl : public PCSX::Bios {
     }
 
     void psxBios_format() {  // 0x41
-        if (strcmp(Ra0, "bu00:") == 0 && PCSX::g_emulator.settings.get<PCSX::Emulator::SettingMcd1>().c_str()[0] != '\0') {
-            PCSX::g_emulator.m_sio->CreateMcd(PCSX::g_emulator.settings.get<PCSX::Emulator::SettingMcd1>().c_str());
-            PCSX::g_emulator.m_sio->LoadMcd(1, PCSX::g_emulator.settings.get<PCSX::Emulator::SettingMcd1>().c_str());
+        if (strcmp(Ra0, "bu00:") == 0 && PCSX::g_emulator->settings.get<PCSX::Emulator::SettingMcd1>().c_str()[0] != '\0') {
+            PCSX::g_emulator->m_sio->CreateMcd(PCSX::g_emulator->settings.get<PCSX::Emulator::SettingMcd1>().c_str());
+            PCSX::g_emulator->m_sio->LoadMcd(1, PCSX::g_emulator->settings.get<PCSX::Emulator::SettingMcd1>().c_str());
             v0 = 1;
         } else if (strcmp(Ra0, "bu10:") == 0 &&
-                   PCSX::g_emulator.settings.get<PCSX::Emulator::SettingMcd2>().c_str()[0] != '\0') {
-            PCSX::g_emulator.m_sio->CreateMcd(PCSX::g_emulator.settings.get<PCSX::Emulator::SettingMcd2>().c_str());
-            PCSX::g_emulator.m_sio->LoadMcd(2, PCSX::g_emulator.settings.get<PCSX::Emulator::SettingMcd2>().c_str());
+                   PCSX::g_emulator->settings.get<PCSX::Emulator::SettingMcd2>().c_str()[0] != '\0') {
+            PCSX::g_emulator->m_sio->CreateMcd(PCSX::g_emulator->settings.get<PCSX::Emulator::SettingMcd2>().c_str());
+            PCSX::g_emulator->m_sio->LoadMcd(2, PCSX::g_emulator->settings.get<PCSX::Emulator::SettingMcd2>().c_str());
             v0 = 1;
         } else {
             v0 = 0;
@@ -1347,7 +1347,7 @@ class BiosImpl : public PCSX::Bios {
     void psxBios_FlushCache() {  // 44
         PSXBIOS_LOG("psxBios_%s\n", A0names[0x44]);
 
-        PCSX::g_emulator.m_psxCpu->m_psxRegs.ICache_valid = false;
+        PCSX::g_emulator->m_psxCpu->m_psxRegs.ICache_valid = false;
 
         pc0 = ra;
     }
@@ -1358,13 +1358,13 @@ class BiosImpl : public PCSX::Bios {
 
         PSXBIOS_LOG("psxBios_%s\n", A0names[0x46]);
 
-        PCSX::g_emulator.m_gpu->writeData(0xa0000000);
-        PCSX::g_emulator.m_gpu->writeData((a1 << 16) | (a0 & 0xffff));
-        PCSX::g_emulator.m_gpu->writeData((a3 << 16) | (a2 & 0xffff));
+        PCSX::g_emulator->m_gpu->writeData(0xa0000000);
+        PCSX::g_emulator->m_gpu->writeData((a1 << 16) | (a0 & 0xffff));
+        PCSX::g_emulator->m_gpu->writeData((a3 << 16) | (a2 & 0xffff));
         size = (a2 * a3 + 1) / 2;
         ptr = (int32_t *)PSXM(Rsp[4]);  // that is correct?
         do {
-            PCSX::g_emulator.m_gpu->writeData(SWAP_LE32(*ptr));
+            PCSX::g_emulator->m_gpu->writeData(SWAP_LE32(*ptr));
             ptr++;
         } while (--size);
 
@@ -1374,27 +1374,27 @@ class BiosImpl : public PCSX::Bios {
     void psxBios_mem2vram() {  // 0x47
         int size;
 
-        PCSX::g_emulator.m_gpu->writeData(0xa0000000);
-        PCSX::g_emulator.m_gpu->writeData((a1 << 16) | (a0 & 0xffff));
-        PCSX::g_emulator.m_gpu->writeData((a3 << 16) | (a2 & 0xffff));
+        PCSX::g_emulator->m_gpu->writeData(0xa0000000);
+        PCSX::g_emulator->m_gpu->writeData((a1 << 16) | (a0 & 0xffff));
+        PCSX::g_emulator->m_gpu->writeData((a3 << 16) | (a2 & 0xffff));
         size = (a2 * a3 + 1) / 2;
-        PCSX::g_emulator.m_gpu->writeStatus(0x04000002);
-        PCSX::g_emulator.m_hw->psxHwWrite32(0x1f8010f4, 0);
-        PCSX::g_emulator.m_hw->psxHwWrite32(0x1f8010f0, PCSX::g_emulator.m_hw->psxHwRead32(0x1f8010f0) | 0x800);
-        PCSX::g_emulator.m_hw->psxHwWrite32(0x1f8010a0, Rsp[4]);  // might have a buggy...
-        PCSX::g_emulator.m_hw->psxHwWrite32(0x1f8010a4, ((size / 16) << 16) | 16);
-        PCSX::g_emulator.m_hw->psxHwWrite32(0x1f8010a8, 0x01000201);
+        PCSX::g_emulator->m_gpu->writeStatus(0x04000002);
+        PCSX::g_emulator->m_hw->psxHwWrite32(0x1f8010f4, 0);
+        PCSX::g_emulator->m_hw->psxHwWrite32(0x1f8010f0, PCSX::g_emulator->m_hw->psxHwRead32(0x1f8010f0) | 0x800);
+        PCSX::g_emulator->m_hw->psxHwWrite32(0x1f8010a0, Rsp[4]);  // might have a buggy...
+        PCSX::g_emulator->m_hw->psxHwWrite32(0x1f8010a4, ((size / 16) << 16) | 16);
+        PCSX::g_emulator->m_hw->psxHwWrite32(0x1f8010a8, 0x01000201);
 
         pc0 = ra;
     }
 
     void psxBios_SendGPU() {  // 0x48
-        PCSX::g_emulator.m_gpu->writeStatus(a0);
+        PCSX::g_emulator->m_gpu->writeStatus(a0);
         pc0 = ra;
     }
 
     void psxBios_GPU_cw() {  // 0x49
-        PCSX::g_emulator.m_gpu->writeData(a0);
+        PCSX::g_emulator->m_gpu->writeData(a0);
         pc0 = ra;
     }
 
@@ -1402,7 +1402,7 @@ class BiosImpl : public PCSX::Bios {
         int32_t *ptr = (int32_t *)Ra0;
         int size = a1;
         while (size--) {
-            PCSX::g_emulator.m_gpu->writeData(SWAP_LE32(*ptr));
+            PCSX::g_emulator->m_gpu->writeData(SWAP_LE32(*ptr));
             ptr++;
         }
 
@@ -1410,26 +1410,26 @@ class BiosImpl : public PCSX::Bios {
     }
 
     void psxBios_GPU_SendPackets() {  // 4b:
-        PCSX::g_emulator.m_gpu->writeStatus(0x04000002);
-        PCSX::g_emulator.m_hw->psxHwWrite32(0x1f8010f4, 0);
-        PCSX::g_emulator.m_hw->psxHwWrite32(0x1f8010f0, PCSX::g_emulator.m_hw->psxHwRead32(0x1f8010f0) | 0x800);
-        PCSX::g_emulator.m_hw->psxHwWrite32(0x1f8010a0, a0);
-        PCSX::g_emulator.m_hw->psxHwWrite32(0x1f8010a4, 0);
-        PCSX::g_emulator.m_hw->psxHwWrite32(0x1f8010a8, 0x010000401);
+        PCSX::g_emulator->m_gpu->writeStatus(0x04000002);
+        PCSX::g_emulator->m_hw->psxHwWrite32(0x1f8010f4, 0);
+        PCSX::g_emulator->m_hw->psxHwWrite32(0x1f8010f0, PCSX::g_emulator->m_hw->psxHwRead32(0x1f8010f0) | 0x800);
+        PCSX::g_emulator->m_hw->psxHwWrite32(0x1f8010a0, a0);
+        PCSX::g_emulator->m_hw->psxHwWrite32(0x1f8010a4, 0);
+        PCSX::g_emulator->m_hw->psxHwWrite32(0x1f8010a8, 0x010000401);
         pc0 = ra;
     }
 
     void psxBios_sys_a0_4c() {  // 0x4c GPU relate
-        PCSX::g_emulator.m_hw->psxHwWrite32(0x1f8010a8, 0x00000401);
-        PCSX::g_emulator.m_gpu->writeData(0x0400000);
-        PCSX::g_emulator.m_gpu->writeData(0x0200000);
-        PCSX::g_emulator.m_gpu->writeData(0x0100000);
+        PCSX::g_emulator->m_hw->psxHwWrite32(0x1f8010a8, 0x00000401);
+        PCSX::g_emulator->m_gpu->writeData(0x0400000);
+        PCSX::g_emulator->m_gpu->writeData(0x0200000);
+        PCSX::g_emulator->m_gpu->writeData(0x0100000);
 
         pc0 = ra;
     }
 
     void psxBios_GPU_GetGPUStatus() {  // 0x4d
-        v0 = PCSX::g_emulator.m_gpu->readStatus();
+        v0 = PCSX::g_emulator->m_gpu->readStatus();
         pc0 = ra;
     }
 
@@ -1512,13 +1512,13 @@ class BiosImpl : public PCSX::Bios {
             case 0x01:
             case 0x02:
             case 0x03:
-                ret = PCSX::g_emulator.settings.get<PCSX::Emulator::SettingMcd1>().c_str()[0] ? 0x2 : 0x8;
+                ret = PCSX::g_emulator->settings.get<PCSX::Emulator::SettingMcd1>().c_str()[0] ? 0x2 : 0x8;
                 break;
             case 0x10:
             case 0x11:
             case 0x12:
             case 0x13:
-                ret = PCSX::g_emulator.settings.get<PCSX::Emulator::SettingMcd2>().c_str()[0] ? 0x2 : 0x8;
+                ret = PCSX::g_emulator->settings.get<PCSX::Emulator::SettingMcd2>().c_str()[0] ? 0x2 : 0x8;
                 break;
             default:
                 PSXBIOS_LOG("psxBios_%s: UNKNOWN PORT 0x%x\n", A0names[0xab], s_card_active_chan);
@@ -1527,7 +1527,7 @@ class BiosImpl : public PCSX::Bios {
         }
 
         // COTS password option
-        if (PCSX::g_emulator.config().NoMemcard) ret = 0x8;
+        if (PCSX::g_emulator->config().NoMemcard) ret = 0x8;
 
         //  DeliverEvent(0x11, 0x2); // 0xf0000011, 0x0004
         DeliverEvent(0x81, ret);  // 0xf4000001, 0x0004
@@ -1557,7 +1557,7 @@ class BiosImpl : public PCSX::Bios {
         if (a0 != 3) {
             uint32_t mode = 0;
 
-            PCSX::g_emulator.m_psxCounters->psxRcntWtarget(a0, a1);
+            PCSX::g_emulator->m_psxCounters->psxRcntWtarget(a0, a1);
             if (a2 & 0x1000) mode |= 0x050;  // Interrupt Mode
             if (a2 & 0x0100) mode |= 0x008;  // Count to 0xffff
             if (a2 & 0x0010) mode |= 0x001;  // Timer stop mode
@@ -1568,7 +1568,7 @@ class BiosImpl : public PCSX::Bios {
                 if (a2 & 0x0001) mode |= 0x100;
             }  // System Clock mode
 
-            PCSX::g_emulator.m_psxCounters->psxRcntWmode(a0, mode);
+            PCSX::g_emulator->m_psxCounters->psxRcntWmode(a0, mode);
         }
         pc0 = ra;
     }
@@ -1578,7 +1578,7 @@ class BiosImpl : public PCSX::Bios {
 
         a0 &= 0x3;
         if (a0 != 3)
-            v0 = PCSX::g_emulator.m_psxCounters->psxRcntRcount(a0);
+            v0 = PCSX::g_emulator->m_psxCounters->psxRcntRcount(a0);
         else
             v0 = 0;
         pc0 = ra;
@@ -1612,9 +1612,9 @@ class BiosImpl : public PCSX::Bios {
 
         a0 &= 0x3;
         if (a0 != 3) {
-            PCSX::g_emulator.m_psxCounters->psxRcntWmode(a0, 0);
-            PCSX::g_emulator.m_psxCounters->psxRcntWtarget(a0, 0);
-            PCSX::g_emulator.m_psxCounters->psxRcntWcount(a0, 0);
+            PCSX::g_emulator->m_psxCounters->psxRcntWmode(a0, 0);
+            PCSX::g_emulator->m_psxCounters->psxRcntWtarget(a0, 0);
+            PCSX::g_emulator->m_psxCounters->psxRcntWcount(a0, 0);
         }
         pc0 = ra;
     }
@@ -1809,10 +1809,10 @@ class BiosImpl : public PCSX::Bios {
             if (s_Thread[s_CurThread].status == 2) {
                 s_Thread[s_CurThread].status = 1;
                 s_Thread[s_CurThread].func = ra;
-                memcpy(s_Thread[s_CurThread].reg, PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.r, 32 * 4);
+                memcpy(s_Thread[s_CurThread].reg, PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.r, 32 * 4);
             }
 
-            memcpy(PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.r, s_Thread[th].reg, 32 * 4);
+            memcpy(PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.r, s_Thread[th].reg, 32 * 4);
             pc0 = s_Thread[th].func;
             s_Thread[th].status = 2;
             s_CurThread = th;
@@ -1834,9 +1834,9 @@ class BiosImpl : public PCSX::Bios {
     void psxBios_StartPAD() {  // 13
         PSXBIOS_LOG("psxBios_%s\n", B0names[0x13]);
 
-        PCSX::g_emulator.m_hw->psxHwWrite16(0x1f801074,
-                                            (unsigned short)(PCSX::g_emulator.m_hw->psxHwRead16(0x1f801074) | 0x1));
-        PCSX::g_emulator.m_psxCpu->m_psxRegs.CP0.n.Status |= 0x401;
+        PCSX::g_emulator->m_hw->psxHwWrite16(0x1f801074,
+                                            (unsigned short)(PCSX::g_emulator->m_hw->psxHwRead16(0x1f801074) | 0x1));
+        PCSX::g_emulator->m_psxCpu->m_psxRegs.CP0.n.Status |= 0x401;
         pc0 = ra;
     }
 
@@ -1851,11 +1851,11 @@ class BiosImpl : public PCSX::Bios {
     void psxBios_PAD_init() {  // 15
         PSXBIOS_LOG("psxBios_%s\n", B0names[0x15]);
 
-        PCSX::g_emulator.m_hw->psxHwWrite16(0x1f801074,
-                                            (uint16_t)(PCSX::g_emulator.m_hw->psxHwRead16(0x1f801074) | 0x1));
+        PCSX::g_emulator->m_hw->psxHwWrite16(0x1f801074,
+                                            (uint16_t)(PCSX::g_emulator->m_hw->psxHwRead16(0x1f801074) | 0x1));
         s_pad_buf = (int *)Ra1;
         *s_pad_buf = -1;
-        PCSX::g_emulator.m_psxCpu->m_psxRegs.CP0.n.Status |= 0x401;
+        PCSX::g_emulator->m_psxCpu->m_psxRegs.CP0.n.Status |= 0x401;
         pc0 = ra;
     }
 
@@ -1869,12 +1869,12 @@ class BiosImpl : public PCSX::Bios {
     void psxBios_ReturnFromException() {  // 17
         LoadRegs();
 
-        pc0 = PCSX::g_emulator.m_psxCpu->m_psxRegs.CP0.n.EPC;
-        if (PCSX::g_emulator.m_psxCpu->m_psxRegs.CP0.n.Cause & 0x80000000) pc0 += 4;
+        pc0 = PCSX::g_emulator->m_psxCpu->m_psxRegs.CP0.n.EPC;
+        if (PCSX::g_emulator->m_psxCpu->m_psxRegs.CP0.n.Cause & 0x80000000) pc0 += 4;
 
-        PCSX::g_emulator.m_psxCpu->m_psxRegs.CP0.n.Status =
-            (PCSX::g_emulator.m_psxCpu->m_psxRegs.CP0.n.Status & 0xfffffff0) |
-            ((PCSX::g_emulator.m_psxCpu->m_psxRegs.CP0.n.Status & 0x3c) >> 2);
+        PCSX::g_emulator->m_psxCpu->m_psxRegs.CP0.n.Status =
+            (PCSX::g_emulator->m_psxCpu->m_psxRegs.CP0.n.Status & 0xfffffff0) |
+            ((PCSX::g_emulator->m_psxCpu->m_psxRegs.CP0.n.Status & 0x3c) >> 2);
     }
 
     void psxBios_ResetEntryInt() {  // 18
@@ -1962,7 +1962,7 @@ class BiosImpl : public PCSX::Bios {
                 PCSX::g_system->biosPrintf("openC %s %d\n", ptr, nblk);
                 v0 = 1 + mcd;
                 /* just go ahead and resave them all */
-                PCSX::g_emulator.m_sio->SaveMcd(cfg, reinterpret_cast<char *>(ptr), 128, 128 * 15);
+                PCSX::g_emulator->m_sio->SaveMcd(cfg, reinterpret_cast<char *>(ptr), 128, 128 * 15);
                 break;
             }
             /* shouldn't this return ENOSPC if i == 16? */
@@ -1979,13 +1979,13 @@ class BiosImpl : public PCSX::Bios {
         v0 = -1;
 
         if (!strncmp(Ra0, "bu00", 4)) {
-            buopen(1, PCSX::g_emulator.m_sio->g_mcd1Data,
-                   PCSX::g_emulator.settings.get<PCSX::Emulator::SettingMcd1>().c_str());
+            buopen(1, PCSX::g_emulator->m_sio->g_mcd1Data,
+                   PCSX::g_emulator->settings.get<PCSX::Emulator::SettingMcd1>().c_str());
         }
 
         if (!strncmp(Ra0, "bu10", 4)) {
-            buopen(2, PCSX::g_emulator.m_sio->g_mcd2Data,
-                   PCSX::g_emulator.settings.get<PCSX::Emulator::SettingMcd2>().c_str());
+            buopen(2, PCSX::g_emulator->m_sio->g_mcd2Data,
+                   PCSX::g_emulator->settings.get<PCSX::Emulator::SettingMcd2>().c_str());
         }
 
         pc0 = ra;
@@ -2018,9 +2018,9 @@ class BiosImpl : public PCSX::Bios {
     template <int mcd>
     char *getmcdData() {
         if (mcd == 1) {
-            return PCSX::g_emulator.m_sio->g_mcd1Data;
+            return PCSX::g_emulator->m_sio->g_mcd1Data;
         } else if (mcd == 2) {
-            return PCSX::g_emulator.m_sio->g_mcd2Data;
+            return PCSX::g_emulator->m_sio->g_mcd2Data;
         }
         return NULL;
     }
@@ -2028,9 +2028,9 @@ class BiosImpl : public PCSX::Bios {
     template <int mcd>
     const char *getmcdName() {
         if (mcd == 1) {
-            return PCSX::g_emulator.settings.get<PCSX::Emulator::SettingMcd1>().c_str();
+            return PCSX::g_emulator->settings.get<PCSX::Emulator::SettingMcd1>().c_str();
         } else if (mcd == 2) {
-            return PCSX::g_emulator.settings.get<PCSX::Emulator::SettingMcd2>().c_str();
+            return PCSX::g_emulator->settings.get<PCSX::Emulator::SettingMcd2>().c_str();
         }
         return NULL;
     }
@@ -2078,7 +2078,7 @@ class BiosImpl : public PCSX::Bios {
         char *ptr = getmcdData<mcd>() + offset;
         memcpy(ptr, Ra1, a2);
         s_FDesc[1 + mcd].offset += a2;
-        PCSX::g_emulator.m_sio->SaveMcd(getmcdName<mcd>(), getmcdData<mcd>(), offset, a2);
+        PCSX::g_emulator->m_sio->SaveMcd(getmcdName<mcd>(), getmcdData<mcd>(), offset, a2);
         if (s_FDesc[1 + mcd].mode & 0x8000)
             v0 = 0;
         else
@@ -2255,7 +2255,7 @@ class BiosImpl : public PCSX::Bios {
             memset(ptr + 0xa + namelen, 0, 0x75 - namelen);
             for (j = 0; j < 127; j++) chksum ^= ptr[j];
             ptr[127] = chksum;
-            PCSX::g_emulator.m_sio->SaveMcd(getmcdName<mcd>(), getmcdData<mcd>(), 128 * i + 0xa, 0x76);
+            PCSX::g_emulator->m_sio->SaveMcd(getmcdName<mcd>(), getmcdData<mcd>(), 128 * i + 0xa, 0x76);
             v0 = 1;
             break;
         }
@@ -2288,7 +2288,7 @@ class BiosImpl : public PCSX::Bios {
             if ((*ptr & 0xF0) != 0x50) continue;
             if (strcmp(Ra0 + 5, ptr + 0xa)) continue;
             *ptr = (*ptr & 0xf) | 0xA0;
-            PCSX::g_emulator.m_sio->SaveMcd(getmcdName<mcd>(), getmcdData<mcd>(), 128 * i, 1);
+            PCSX::g_emulator->m_sio->SaveMcd(getmcdName<mcd>(), getmcdData<mcd>(), 128 * i, 1);
             PCSX::g_system->biosPrintf("delete %s\n", ptr + 0xa);
             v0 = 1;
             break;
@@ -2348,16 +2348,16 @@ class BiosImpl : public PCSX::Bios {
         s_card_active_chan = a0;
 
         if (port == 0) {
-            memcpy(PCSX::g_emulator.m_sio->g_mcd1Data + (sect * PCSX::SIO::MCD_SECT_SIZE), Ra2,
+            memcpy(PCSX::g_emulator->m_sio->g_mcd1Data + (sect * PCSX::SIO::MCD_SECT_SIZE), Ra2,
                    PCSX::SIO::MCD_SECT_SIZE);
-            PCSX::g_emulator.m_sio->SaveMcd(PCSX::g_emulator.settings.get<PCSX::Emulator::SettingMcd1>().c_str(),
-                                            PCSX::g_emulator.m_sio->g_mcd1Data,
+            PCSX::g_emulator->m_sio->SaveMcd(PCSX::g_emulator->settings.get<PCSX::Emulator::SettingMcd1>().c_str(),
+                                            PCSX::g_emulator->m_sio->g_mcd1Data,
                                             sect * PCSX::SIO::MCD_SECT_SIZE, PCSX::SIO::MCD_SECT_SIZE);
         } else {
-            memcpy(PCSX::g_emulator.m_sio->g_mcd2Data + (sect * PCSX::SIO::MCD_SECT_SIZE), Ra2,
+            memcpy(PCSX::g_emulator->m_sio->g_mcd2Data + (sect * PCSX::SIO::MCD_SECT_SIZE), Ra2,
                    PCSX::SIO::MCD_SECT_SIZE);
-            PCSX::g_emulator.m_sio->SaveMcd(PCSX::g_emulator.settings.get<PCSX::Emulator::SettingMcd2>().c_str(),
-                                            PCSX::g_emulator.m_sio->g_mcd2Data,
+            PCSX::g_emulator->m_sio->SaveMcd(PCSX::g_emulator->settings.get<PCSX::Emulator::SettingMcd2>().c_str(),
+                                            PCSX::g_emulator->m_sio->g_mcd2Data,
                                             sect * PCSX::SIO::MCD_SECT_SIZE, PCSX::SIO::MCD_SECT_SIZE);
         }
 
@@ -2377,10 +2377,10 @@ class BiosImpl : public PCSX::Bios {
         s_card_active_chan = a0;
 
         if (port == 0) {
-            memcpy(Ra2, PCSX::g_emulator.m_sio->g_mcd1Data + (sect * PCSX::SIO::MCD_SECT_SIZE),
+            memcpy(Ra2, PCSX::g_emulator->m_sio->g_mcd1Data + (sect * PCSX::SIO::MCD_SECT_SIZE),
                    PCSX::SIO::MCD_SECT_SIZE);
         } else {
-            memcpy(Ra2, PCSX::g_emulator.m_sio->g_mcd2Data + (sect * PCSX::SIO::MCD_SECT_SIZE),
+            memcpy(Ra2, PCSX::g_emulator->m_sio->g_mcd2Data + (sect * PCSX::SIO::MCD_SECT_SIZE),
                    PCSX::SIO::MCD_SECT_SIZE);
         }
 
@@ -2512,7 +2512,7 @@ class BiosImpl : public PCSX::Bios {
         v0 = *ptr;
         *ptr = a1;
 
-        //  PCSX::g_emulator.m_psxCpu->m_psxRegs.CP0.n.Status|= 0x404;
+        //  PCSX::g_emulator->m_psxCpu->m_psxRegs.CP0.n.Status|= 0x404;
         pc0 = ra;
     }
 
@@ -2557,7 +2557,7 @@ class BiosImpl : public PCSX::Bios {
         m_biosB0[0x3d] = &BiosImpl::psxBios_putchar;
         m_biosB0[0x3f] = &BiosImpl::psxBios_puts;
 
-        if (!PCSX::g_emulator.settings.get<PCSX::Emulator::SettingHLE>()) return;
+        if (!PCSX::g_emulator->settings.get<PCSX::Emulator::SettingHLE>()) return;
 
         for (i = 0; i < 256; i++) {
             if (m_biosA0[i] == NULL) m_biosA0[i] = &BiosImpl::psxBios_dummy;
@@ -2871,7 +2871,7 @@ class BiosImpl : public PCSX::Bios {
         /**/
         base = 0x1000;
         size = sizeof(EvCB) * 32;
-        s_Event = reinterpret_cast<EvCB *>(&PCSX::g_emulator.m_psxMem->g_psxR[base]);
+        s_Event = reinterpret_cast<EvCB *>(&PCSX::g_emulator->m_psxMem->g_psxR[base]);
         base += size * 6;
         memset(s_Event, 0, size * 6);
         s_HwEV = s_Event;
@@ -2881,10 +2881,10 @@ class BiosImpl : public PCSX::Bios {
         s_SwEV = s_Event + 32 * 4;
         s_ThEV = s_Event + 32 * 5;
 
-        ptr = (uint32_t *)&PCSX::g_emulator.m_psxMem->g_psxM[0x0874];  // b0 table
+        ptr = (uint32_t *)&PCSX::g_emulator->m_psxMem->g_psxM[0x0874];  // b0 table
         ptr[0] = SWAP_LEu32(0x4c54 - 0x884);
 
-        ptr = (uint32_t *)&PCSX::g_emulator.m_psxMem->g_psxM[0x0674];  // c0 table
+        ptr = (uint32_t *)&PCSX::g_emulator->m_psxMem->g_psxM[0x0674];  // c0 table
         ptr[6] = SWAP_LEu32(0xc80);
 
         memset(s_SysIntRP, 0, sizeof(s_SysIntRP));
@@ -2906,7 +2906,7 @@ class BiosImpl : public PCSX::Bios {
         psxMu32ref(0x0150) = SWAP_LEu32(0x160);
         psxMu32ref(0x0154) = SWAP_LEu32(0x320);
         psxMu32ref(0x0160) = SWAP_LEu32(0x248);
-        strcpy((char *)&PCSX::g_emulator.m_psxMem->g_psxM[0x248], "bu");
+        strcpy((char *)&PCSX::g_emulator->m_psxMem->g_psxM[0x248], "bu");
         /*  psxMu32ref(0x0ca8) = SWAP_LEu32(0x1f410004);
                 psxMu32ref(0x0cf0) = SWAP_LEu32(0x3c020000);
                 psxMu32ref(0x0cf4) = SWAP_LEu32(0x2442641c);
@@ -2933,9 +2933,9 @@ class BiosImpl : public PCSX::Bios {
 
         // fonts
         len = 0x80000 - 0x66000;
-        uncompress((Bytef *)(PCSX::g_emulator.m_psxMem->g_psxR + 0x66000), &len, font_8140, sizeof(font_8140));
+        uncompress((Bytef *)(PCSX::g_emulator->m_psxMem->g_psxR + 0x66000), &len, font_8140, sizeof(font_8140));
         len = 0x80000 - 0x69d68;
-        uncompress((Bytef *)(PCSX::g_emulator.m_psxMem->g_psxR + 0x69d68), &len, font_889f, sizeof(font_889f));
+        uncompress((Bytef *)(PCSX::g_emulator->m_psxMem->g_psxR + 0x69d68), &len, font_889f, sizeof(font_889f));
 
         // memory size 2 MB
         psxHu32ref(0x1060) = SWAP_LEu32(0x00000b88);
@@ -2945,21 +2945,21 @@ class BiosImpl : public PCSX::Bios {
 
     void psxBiosShutdown() final {}
 
-#define psxBios_PADpoll(pad)                                              \
-    {                                                                     \
-        PCSX::g_emulator.m_pad##pad->startPoll();                       \
-        s_pad_buf##pad[0] = 0;                                            \
-        s_pad_buf##pad[1] = PCSX::g_emulator.m_pad##pad->poll(0x42);    \
-        if (!(s_pad_buf##pad[1] & 0x0f)) {                                \
-            bufcount = 32;                                                \
-        } else {                                                          \
-            bufcount = (s_pad_buf##pad[1] & 0x0f) * 2;                    \
-        }                                                                 \
-        PCSX::g_emulator.m_pad##pad->poll(0);                           \
-        i = 2;                                                            \
-        while (bufcount--) {                                              \
-            s_pad_buf##pad[i++] = PCSX::g_emulator.m_pad##pad->poll(0); \
-        }                                                                 \
+#define psxBios_PADpoll(pad)                                             \
+    {                                                                    \
+        PCSX::g_emulator->m_pad##pad->startPoll();                       \
+        s_pad_buf##pad[0] = 0;                                           \
+        s_pad_buf##pad[1] = PCSX::g_emulator->m_pad##pad->poll(0x42);    \
+        if (!(s_pad_buf##pad[1] & 0x0f)) {                               \
+            bufcount = 32;                                               \
+        } else {                                                         \
+            bufcount = (s_pad_buf##pad[1] & 0x0f) * 2;                   \
+        }                                                                \
+        PCSX::g_emulator->m_pad##pad->poll(0);                           \
+        i = 2;                                                           \
+        while (bufcount--) {                                             \
+            s_pad_buf##pad[i++] = PCSX::g_emulator->m_pad##pad->poll(0); \
+        }                                                                \
     }
 
     void biosInterrupt() {
@@ -2969,56 +2969,56 @@ class BiosImpl : public PCSX::Bios {
         if (s_pad_buf != NULL) {
             uint32_t *buf = (uint32_t *)s_pad_buf;
 
-            if (!PCSX::g_emulator.config().UseNet) {
-                PCSX::g_emulator.m_pad1->startPoll();
-                if (PCSX::g_emulator.m_pad1->poll(0x42) == 0x23) {
-                    PCSX::g_emulator.m_pad1->poll(0);
-                    *buf = PCSX::g_emulator.m_pad1->poll(0) << 8;
-                    *buf |= PCSX::g_emulator.m_pad1->poll(0);
-                    PCSX::g_emulator.m_pad1->poll(0);
-                    *buf &= ~((PCSX::g_emulator.m_pad1->poll(0) > 0x20) ? 1 << 6 : 0);
-                    *buf &= ~((PCSX::g_emulator.m_pad1->poll(0) > 0x20) ? 1 << 7 : 0);
+            if (!PCSX::g_emulator->config().UseNet) {
+                PCSX::g_emulator->m_pad1->startPoll();
+                if (PCSX::g_emulator->m_pad1->poll(0x42) == 0x23) {
+                    PCSX::g_emulator->m_pad1->poll(0);
+                    *buf = PCSX::g_emulator->m_pad1->poll(0) << 8;
+                    *buf |= PCSX::g_emulator->m_pad1->poll(0);
+                    PCSX::g_emulator->m_pad1->poll(0);
+                    *buf &= ~((PCSX::g_emulator->m_pad1->poll(0) > 0x20) ? 1 << 6 : 0);
+                    *buf &= ~((PCSX::g_emulator->m_pad1->poll(0) > 0x20) ? 1 << 7 : 0);
                 } else {
-                    PCSX::g_emulator.m_pad1->poll(0);
-                    *buf = PCSX::g_emulator.m_pad1->poll(0) << 8;
-                    *buf |= PCSX::g_emulator.m_pad1->poll(0);
+                    PCSX::g_emulator->m_pad1->poll(0);
+                    *buf = PCSX::g_emulator->m_pad1->poll(0) << 8;
+                    *buf |= PCSX::g_emulator->m_pad1->poll(0);
                 }
 
-                PCSX::g_emulator.m_pad2->startPoll();
-                if (PCSX::g_emulator.m_pad2->poll(0x42) == 0x23) {
-                    PCSX::g_emulator.m_pad2->poll(0);
-                    *buf |= PCSX::g_emulator.m_pad2->poll(0) << 24;
-                    *buf |= PCSX::g_emulator.m_pad2->poll(0) << 16;
-                    PCSX::g_emulator.m_pad2->poll(0);
-                    *buf &= ~((PCSX::g_emulator.m_pad2->poll(0) > 0x20) ? 1 << 22 : 0);
-                    *buf &= ~((PCSX::g_emulator.m_pad2->poll(0) > 0x20) ? 1 << 23 : 0);
+                PCSX::g_emulator->m_pad2->startPoll();
+                if (PCSX::g_emulator->m_pad2->poll(0x42) == 0x23) {
+                    PCSX::g_emulator->m_pad2->poll(0);
+                    *buf |= PCSX::g_emulator->m_pad2->poll(0) << 24;
+                    *buf |= PCSX::g_emulator->m_pad2->poll(0) << 16;
+                    PCSX::g_emulator->m_pad2->poll(0);
+                    *buf &= ~((PCSX::g_emulator->m_pad2->poll(0) > 0x20) ? 1 << 22 : 0);
+                    *buf &= ~((PCSX::g_emulator->m_pad2->poll(0) > 0x20) ? 1 << 23 : 0);
                 } else {
-                    PCSX::g_emulator.m_pad2->poll(0);
-                    *buf |= PCSX::g_emulator.m_pad2->poll(0) << 24;
-                    *buf |= PCSX::g_emulator.m_pad2->poll(0) << 16;
+                    PCSX::g_emulator->m_pad2->poll(0);
+                    *buf |= PCSX::g_emulator->m_pad2->poll(0) << 24;
+                    *buf |= PCSX::g_emulator->m_pad2->poll(0) << 16;
                 }
             } else {
                 uint16_t data;
 
-                PCSX::g_emulator.m_pad1->startPoll();
-                PCSX::g_emulator.m_pad1->poll(0x42);
-                PCSX::g_emulator.m_pad1->poll(0);
-                data = PCSX::g_emulator.m_pad1->poll(0) << 8;
-                data |= PCSX::g_emulator.m_pad1->poll(0);
+                PCSX::g_emulator->m_pad1->startPoll();
+                PCSX::g_emulator->m_pad1->poll(0x42);
+                PCSX::g_emulator->m_pad1->poll(0);
+                data = PCSX::g_emulator->m_pad1->poll(0) << 8;
+                data |= PCSX::g_emulator->m_pad1->poll(0);
 
-                if (NET_sendPadData(&data, 2) == -1) PCSX::g_emulator.m_sio->netError();
+                if (NET_sendPadData(&data, 2) == -1) PCSX::g_emulator->m_sio->netError();
 
-                if (NET_recvPadData(&((uint16_t *)buf)[0], 1) == -1) PCSX::g_emulator.m_sio->netError();
-                if (NET_recvPadData(&((uint16_t *)buf)[1], 2) == -1) PCSX::g_emulator.m_sio->netError();
+                if (NET_recvPadData(&((uint16_t *)buf)[0], 1) == -1) PCSX::g_emulator->m_sio->netError();
+                if (NET_recvPadData(&((uint16_t *)buf)[1], 2) == -1) PCSX::g_emulator->m_sio->netError();
             }
         }
-        if (PCSX::g_emulator.config().UseNet && s_pad_buf1 != NULL && s_pad_buf2 != NULL) {
+        if (PCSX::g_emulator->config().UseNet && s_pad_buf1 != NULL && s_pad_buf2 != NULL) {
             psxBios_PADpoll(1);
 
-            if (NET_sendPadData(s_pad_buf1, i) == -1) PCSX::g_emulator.m_sio->netError();
+            if (NET_sendPadData(s_pad_buf1, i) == -1) PCSX::g_emulator->m_sio->netError();
 
-            if (NET_recvPadData(s_pad_buf1, 1) == -1) PCSX::g_emulator.m_sio->netError();
-            if (NET_recvPadData(s_pad_buf2, 2) == -1) PCSX::g_emulator.m_sio->netError();
+            if (NET_recvPadData(s_pad_buf1, 1) == -1) PCSX::g_emulator->m_sio->netError();
+            if (NET_recvPadData(s_pad_buf2, 2) == -1) PCSX::g_emulator->m_sio->netError();
         } else {
             if (s_pad_buf1) {
                 psxBios_PADpoll(1);
@@ -3044,7 +3044,7 @@ class BiosImpl : public PCSX::Bios {
                     if (s_RcEV[i][1].status == EvStACTIVE) {
                         softCall(s_RcEV[i][1].fhandler);
                     }
-                    PCSX::g_emulator.m_hw->psxHwWrite32(0x1f801070, ~(1 << (i + 4)));
+                    PCSX::g_emulator->m_hw->psxHwWrite32(0x1f801070, ~(1 << (i + 4)));
                 }
             }
         }
@@ -3053,7 +3053,7 @@ class BiosImpl : public PCSX::Bios {
     void psxBiosException() final {
         int i;
 
-        switch (PCSX::g_emulator.m_psxCpu->m_psxRegs.CP0.n.Cause & 0x3c) {
+        switch (PCSX::g_emulator->m_psxCpu->m_psxRegs.CP0.n.Cause & 0x3c) {
             case 0x00:  // Interrupt
                 PSXCPU_LOG("interrupt\n");
                 SaveRegs();
@@ -3074,40 +3074,40 @@ class BiosImpl : public PCSX::Bios {
                 if (s_jmp_int != NULL) {
                     int i;
 
-                    PCSX::g_emulator.m_hw->psxHwWrite32(0x1f801070, 0xffffffff);
+                    PCSX::g_emulator->m_hw->psxHwWrite32(0x1f801070, 0xffffffff);
 
                     ra = s_jmp_int[0];
                     sp = s_jmp_int[1];
                     fp = s_jmp_int[2];
                     for (i = 0; i < 8; i++)  // s0-s7
-                        PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.r[16 + i] = s_jmp_int[3 + i];
+                        PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.r[16 + i] = s_jmp_int[3 + i];
                     gp = s_jmp_int[11];
 
                     v0 = 1;
                     pc0 = ra;
                     return;
                 }
-                PCSX::g_emulator.m_hw->psxHwWrite16(0x1f801070, 0);
+                PCSX::g_emulator->m_hw->psxHwWrite16(0x1f801070, 0);
                 break;
 
             case 0x20:  // Syscall
                 PSXCPU_LOG("syscall exp %x\n", a0);
                 switch (a0) {
                     case 1:  // EnterCritical - disable irq's
-                        PCSX::g_emulator.m_psxCpu->m_psxRegs.CP0.n.Status &= ~0x404;
+                        PCSX::g_emulator->m_psxCpu->m_psxRegs.CP0.n.Status &= ~0x404;
                         v0 = 1;  // HDHOSHY experimental patch: Spongebob, Coldblood, fearEffect, Medievil2, Martian
                                  // Gothic
                         break;
 
                     case 2:  // ExitCritical - enable irq's
-                        PCSX::g_emulator.m_psxCpu->m_psxRegs.CP0.n.Status |= 0x404;
+                        PCSX::g_emulator->m_psxCpu->m_psxRegs.CP0.n.Status |= 0x404;
                         break;
                 }
-                pc0 = PCSX::g_emulator.m_psxCpu->m_psxRegs.CP0.n.EPC + 4;
+                pc0 = PCSX::g_emulator->m_psxCpu->m_psxRegs.CP0.n.EPC + 4;
 
-                PCSX::g_emulator.m_psxCpu->m_psxRegs.CP0.n.Status =
-                    (PCSX::g_emulator.m_psxCpu->m_psxRegs.CP0.n.Status & 0xfffffff0) |
-                    ((PCSX::g_emulator.m_psxCpu->m_psxRegs.CP0.n.Status & 0x3c) >> 2);
+                PCSX::g_emulator->m_psxCpu->m_psxRegs.CP0.n.Status =
+                    (PCSX::g_emulator->m_psxCpu->m_psxRegs.CP0.n.Status & 0xfffffff0) |
+                    ((PCSX::g_emulator->m_psxCpu->m_psxRegs.CP0.n.Status & 0x3c) >> 2);
                 return;
 
             default:
@@ -3115,38 +3115,38 @@ class BiosImpl : public PCSX::Bios {
                 break;
         }
 
-        pc0 = PCSX::g_emulator.m_psxCpu->m_psxRegs.CP0.n.EPC;
-        if (PCSX::g_emulator.m_psxCpu->m_psxRegs.CP0.n.Cause & 0x80000000) pc0 += 4;
+        pc0 = PCSX::g_emulator->m_psxCpu->m_psxRegs.CP0.n.EPC;
+        if (PCSX::g_emulator->m_psxCpu->m_psxRegs.CP0.n.Cause & 0x80000000) pc0 += 4;
 
-        PCSX::g_emulator.m_psxCpu->m_psxRegs.CP0.n.Status =
-            (PCSX::g_emulator.m_psxCpu->m_psxRegs.CP0.n.Status & 0xfffffff0) |
-            ((PCSX::g_emulator.m_psxCpu->m_psxRegs.CP0.n.Status & 0x3c) >> 2);
+        PCSX::g_emulator->m_psxCpu->m_psxRegs.CP0.n.Status =
+            (PCSX::g_emulator->m_psxCpu->m_psxRegs.CP0.n.Status & 0xfffffff0) |
+            ((PCSX::g_emulator->m_psxCpu->m_psxRegs.CP0.n.Status & 0x3c) >> 2);
     }
 
-#define bfreeze(ptr, size)                                                          \
-    {                                                                               \
-        if (Mode == 1) memcpy(&PCSX::g_emulator.m_psxMem->g_psxR[base], ptr, size); \
-        if (Mode == 0) memcpy(ptr, &PCSX::g_emulator.m_psxMem->g_psxR[base], size); \
-        base += size;                                                               \
+#define bfreeze(ptr, size)                                                           \
+    {                                                                                \
+        if (Mode == 1) memcpy(&PCSX::g_emulator->m_psxMem->g_psxR[base], ptr, size); \
+        if (Mode == 0) memcpy(ptr, &PCSX::g_emulator->m_psxMem->g_psxR[base], size); \
+        base += size;                                                                \
     }
 
 #define bfreezes(ptr) bfreeze(ptr, sizeof(ptr))
 #define bfreezel(ptr) bfreeze(ptr, sizeof(*ptr))
 
-#define bfreezepsxMptr(ptr, type)                                                                 \
-    {                                                                                             \
-        if (Mode == 1) {                                                                          \
-            if (ptr)                                                                              \
-                psxRu32ref(base) = SWAP_LEu32((int8_t *)(ptr)-PCSX::g_emulator.m_psxMem->g_psxM); \
-            else                                                                                  \
-                psxRu32ref(base) = 0;                                                             \
-        } else {                                                                                  \
-            if (psxRu32(base) != 0)                                                               \
-                ptr = (type *)(PCSX::g_emulator.m_psxMem->g_psxM + psxRu32(base));                \
-            else                                                                                  \
-                (ptr) = NULL;                                                                     \
-        }                                                                                         \
-        base += sizeof(uint32_t);                                                                 \
+#define bfreezepsxMptr(ptr, type)                                                                  \
+    {                                                                                              \
+        if (Mode == 1) {                                                                           \
+            if (ptr)                                                                               \
+                psxRu32ref(base) = SWAP_LEu32((int8_t *)(ptr)-PCSX::g_emulator->m_psxMem->g_psxM); \
+            else                                                                                   \
+                psxRu32ref(base) = 0;                                                              \
+        } else {                                                                                   \
+            if (psxRu32(base) != 0)                                                                \
+                ptr = (type *)(PCSX::g_emulator->m_psxMem->g_psxM + psxRu32(base));                \
+            else                                                                                   \
+                (ptr) = NULL;                                                                      \
+        }                                                                                          \
+        base += sizeof(uint32_t);                                                                  \
     }
 
     void psxBiosFreeze(int Mode) final {
@@ -45,7 +45,7 @@ void psxDma4(uint32_t madr, uint32_t bcr, uint32_t chcr) {  // SPU
                 PSXDMA_LOG("*** DMA4 SPU - mem2spu *** NULL Pointer!!!\n");
                 break;
             }
-            PCSX::g_emulator.m_spu->writeDMAMem(ptr, (bcr >> 16) * (bcr & 0xffff) * 2);
+            PCSX::g_emulator->m_spu->writeDMAMem(ptr, (bcr >> 16) * (bcr & 0xffff) * 2);
 
             // Jungle Book - max 0.333x DMA length
             // Harry Potter and the Philosopher's Stone - max 0.5x DMA length
@@ -62,8 +62,8 @@ void psxDma4(uint32_t madr, uint32_t bcr, uint32_t chcr) {  // SPU
                 break;
             }
             size = (bcr >> 16) * (bcr & 0xffff) * 2;
-            PCSX::g_emulator.m_spu->readDMAMem(ptr, size);
-            PCSX::g_emulator.m_psxCpu->Clear(madr, size);
+            PCSX::g_emulator->m_spu->readDMAMem(ptr, size);
+            PCSX::g_emulator->m_psxCpu->Clear(madr, size);
 
 #if 1
             SPUDMA_INT((bcr >> 16) * (bcr & 0xffff) / 2);
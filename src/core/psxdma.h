@@ -25,52 +25,52 @@
 #include "core/psxmem.h"
 #include "core/r3000a.h"
 
-#define GPUDMA_INT(eCycle)                                                                 \
-    {                                                                                      \
-        PCSX::g_emulator.m_psxCpu->m_psxRegs.interrupt |= (1 << PCSX::PSXINT_GPUDMA);      \
-        PCSX::g_emulator.m_psxCpu->m_psxRegs.intCycle[PCSX::PSXINT_GPUDMA].cycle = eCycle; \
-        PCSX::g_emulator.m_psxCpu->m_psxRegs.intCycle[PCSX::PSXINT_GPUDMA].sCycle =        \
-            PCSX::g_emulator.m_psxCpu->m_psxRegs.cycle;                                    \
+#define GPUDMA_INT(eCycle)                                                                  \
+    {                                                                                       \
+        PCSX::g_emulator->m_psxCpu->m_psxRegs.interrupt |= (1 << PCSX::PSXINT_GPUDMA);      \
+        PCSX::g_emulator->m_psxCpu->m_psxRegs.intCycle[PCSX::PSXINT_GPUDMA].cycle = eCycle; \
+        PCSX::g_emulator->m_psxCpu->m_psxRegs.intCycle[PCSX::PSXINT_GPUDMA].sCycle =        \
+            PCSX::g_emulator->m_psxCpu->m_psxRegs.cycle;                                    \
     }
 
-#define SPUDMA_INT(eCycle)                                                                 \
-    {                                                                                      \
-        PCSX::g_emulator.m_psxCpu->m_psxRegs.interrupt |= (1 << PCSX::PSXINT_SPUDMA);      \
-        PCSX::g_emulator.m_psxCpu->m_psxRegs.intCycle[PCSX::PSXINT_SPUDMA].cycle = eCycle; \
-        PCSX::g_emulator.m_psxCpu->m_psxRegs.intCycle[PCSX::PSXINT_SPUDMA].sCycle =        \
-            PCSX::g_emulator.m_psxCpu->m_psxRegs.cycle;                                    \
+#define SPUDMA_INT(eCycle)                                                                  \
+    {                                                                                       \
+        PCSX::g_emulator->m_psxCpu->m_psxRegs.interrupt |= (1 << PCSX::PSXINT_SPUDMA);      \
+        PCSX::g_emulator->m_psxCpu->m_psxRegs.intCycle[PCSX::PSXINT_SPUDMA].cycle = eCycle; \
+        PCSX::g_emulator->m_psxCpu->m_psxRegs.intCycle[PCSX::PSXINT_SPUDMA].sCycle =        \
+            PCSX::g_emulator->m_psxCpu->m_psxRegs.cycle;                                    \
     }
 
-#define MDECOUTDMA_INT(eCycle)                                                                 \
-    {                                                                                          \
-        PCSX::g_emulator.m_psxCpu->m_psxRegs.interrupt |= (1 << PCSX::PSXINT_MDECOUTDMA);      \
-        PCSX::g_emulator.m_psxCpu->m_psxRegs.intCycle[PCSX::PSXINT_MDECOUTDMA].cycle = eCycle; \
-        PCSX::g_emulator.m_psxCpu->m_psxRegs.intCycle[PCSX::PSXINT_MDECOUTDMA].sCycle =        \
-            PCSX::g_emulator.m_psxCpu->m_psxRegs.cycle;                                        \
+#define MDECOUTDMA_INT(eCycle)                                                                  \
+    {                                                                                           \
+        PCSX::g_emulator->m_psxCpu->m_psxRegs.interrupt |= (1 << PCSX::PSXINT_MDECOUTDMA);      \
+        PCSX::g_emulator->m_psxCpu->m_psxRegs.intCycle[PCSX::PSXINT_MDECOUTDMA].cycle = eCycle; \
+        PCSX::g_emulator->m_psxCpu->m_psxRegs.intCycle[PCSX::PSXINT_MDECOUTDMA].sCycle =        \
+            PCSX::g_emulator->m_psxCpu->m_psxRegs.cycle;                                        \
     }
 
-#define MDECINDMA_INT(eCycle)                                                                 \
-    {                                                                                         \
-        PCSX::g_emulator.m_psxCpu->m_psxRegs.interrupt |= (1 << PCSX::PSXINT_MDECINDMA);      \
-        PCSX::g_emulator.m_psxCpu->m_psxRegs.intCycle[PCSX::PSXINT_MDECINDMA].cycle = eCycle; \
-        PCSX::g_emulator.m_psxCpu->m_psxRegs.intCycle[PCSX::PSXINT_MDECINDMA].sCycle =        \
-            PCSX::g_emulator.m_psxCpu->m_psxRegs.cycle;                                       \
+#define MDECINDMA_INT(eCycle)                                                                  \
+    {                                                                                          \
+        PCSX::g_emulator->m_psxCpu->m_psxRegs.interrupt |= (1 << PCSX::PSXINT_MDECINDMA);      \
+        PCSX::g_emulator->m_psxCpu->m_psxRegs.intCycle[PCSX::PSXINT_MDECINDMA].cycle = eCycle; \
+        PCSX::g_emulator->m_psxCpu->m_psxRegs.intCycle[PCSX::PSXINT_MDECINDMA].sCycle =        \
+            PCSX::g_emulator->m_psxCpu->m_psxRegs.cycle;                                       \
     }
 
-#define GPUOTCDMA_INT(eCycle)                                                                 \
-    {                                                                                         \
-        PCSX::g_emulator.m_psxCpu->m_psxRegs.interrupt |= (1 << PCSX::PSXINT_GPUOTCDMA);      \
-        PCSX::g_emulator.m_psxCpu->m_psxRegs.intCycle[PCSX::PSXINT_GPUOTCDMA].cycle = eCycle; \
-        PCSX::g_emulator.m_psxCpu->m_psxRegs.intCycle[PCSX::PSXINT_GPUOTCDMA].sCycle =        \
-            PCSX::g_emulator.m_psxCpu->m_psxRegs.cycle;                                       \
+#define GPUOTCDMA_INT(eCycle)                                                                  \
+    {                                                                                          \
+        PCSX::g_emulator->m_psxCpu->m_psxRegs.interrupt |= (1 << PCSX::PSXINT_GPUOTCDMA);      \
+        PCSX::g_emulator->m_psxCpu->m_psxRegs.intCycle[PCSX::PSXINT_GPUOTCDMA].cycle = eCycle; \
+        PCSX::g_emulator->m_psxCpu->m_psxRegs.intCycle[PCSX::PSXINT_GPUOTCDMA].sCycle =        \
+            PCSX::g_emulator->m_psxCpu->m_psxRegs.cycle;                                       \
     }
 
-#define CDRDMA_INT(eCycle)                                                                 \
-    {                                                                                      \
-        PCSX::g_emulator.m_psxCpu->m_psxRegs.interrupt |= (1 << PCSX::PSXINT_CDRDMA);      \
-        PCSX::g_emulator.m_psxCpu->m_psxRegs.intCycle[PCSX::PSXINT_CDRDMA].cycle = eCycle; \
-        PCSX::g_emulator.m_psxCpu->m_psxRegs.intCycle[PCSX::PSXINT_CDRDMA].sCycle =        \
-            PCSX::g_emulator.m_psxCpu->m_psxRegs.cycle;                                    \
+#define CDRDMA_INT(eCycle)                                                                  \
+    {                                                                                       \
+        PCSX::g_emulator->m_psxCpu->m_psxRegs.interrupt |= (1 << PCSX::PSXINT_CDRDMA);      \
+        PCSX::g_emulator->m_psxCpu->m_psxRegs.intCycle[PCSX::PSXINT_CDRDMA].cycle = eCycle; \
+        PCSX::g_emulator->m_psxCpu->m_psxRegs.intCycle[PCSX::PSXINT_CDRDMA].sCycle =        \
+            PCSX::g_emulator->m_psxCpu->m_psxRegs.cycle;                                    \
     }
 
 /*
@@ -26,6 +26,7 @@
 #include "core/mdec.h"
 #include "core/pad.h"
 #include "core/ppf.h"
+#include "core/profiler.h"
 #include "core/psxbios.h"
 #include "core/r3000a.h"
 
@@ -96,7 +97,7 @@ void PCSX::Emulator::EmuUpdate() {
 
     if (m_vblank_count_hideafter) {
         if (!(--m_vblank_count_hideafter)) {
-            PCSX::g_emulator.m_gpu->showScreenPic(NULL);
+            PCSX::g_emulator->m_gpu->showScreenPic(NULL);
         }
     }
 
@@ -107,4 +108,4 @@ void PCSX::Emulator::EmuUpdate() {
 
 void PCSX::Emulator::EmuSetPGXPMode(uint32_t pgxpMode) { m_psxCpu->psxSetPGXPMode(pgxpMode); }
 
-PCSX::Emulator& PCSX::g_emulator = PCSX::Emulator::getEmulator();
+thread_local PCSX::Emulator* PCSX::g_emulator = nullptr;
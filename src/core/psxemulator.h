@@ -90,6 +90,7 @@ class HW;
 class MDEC;
 class Memory;
 class PAD;
+class Profiler;
 class R3000Acpu;
 class SIO;
 class System;
@@ -98,14 +99,16 @@ namespace SPU {
 class impl;
 }
 
+// A whole machine. Any number of them can live in the same process, as long as each one stays on the
+// thread that runs it: everything in the core reaches the machine it works for through g_emulator,
+// which that thread points at its own instance before calling into it.
 class Emulator {
-  private:
+  public:
     Emulator();
     ~Emulator();
     Emulator(const Emulator&) = delete;
     Emulator& operator=(const Emulator&) = delete;
 
-  public:
     enum VideoType { PSX_TYPE_NTSC = 0, PSX_TYPE_PAL };                     // PSX Types
     enum CPUType { CPU_DYNAREC = 0, CPU_INTERPRETER };                      // CPU Types
     enum CDDAType { CDDA_DISABLED = 0, CDDA_ENABLED_LE, CDDA_ENABLED_BE };    // CDDA Types
@@ -118,6 +121,7 @@ class Emulator {
     typedef Setting<bool, irqus::typestring<'S', 'i', 'o', 'I', 'r', 'q'>> SettingSioIrq;
     typedef Setting<bool, irqus::typestring<'S', 'p', 'u', 'I', 'r', 'q'>> SettingSpuIrq;
     typedef Setting<bool, irqus::typestring<'B', 'n', 'W', 'M', 'd', 'e', 'c'>> SettingBnWMdec;
+    typedef Setting<bool, irqus::typestring<'M', 'd', 'e', 'c', 'T', 'h', 'r', 'e', 'a', 'd'>> SettingMdecThread;
     typedef Setting<bool, irqus::typestring<'A', 'u', 't', 'o', 'V', 'i', 'd', 'e', 'o'>, true> SettingAutoVideo;
     typedef Setting<VideoType, irqus::typestring<'V', 'i', 'd', 'e', 'o'>, PSX_TYPE_NTSC> SettingVideo;
     typedef Setting<CDDAType, irqus::typestring<'C', 'D', 'D', 'A'>, CDDA_ENABLED_LE> SettingCDDA;
@@ -126,9 +130,11 @@ class Emulator {
     typedef Setting<bool, irqus::typestring<'D', 'e', 'b', 'u', 'g'>> SettingDebug;
     typedef Setting<bool, irqus::typestring<'V', 'e', 'r', 'b', 'o', 's', 'e'>> SettingVerbose;
     typedef Setting<bool, irqus::typestring<'R', 'C', 'n', 't', 'F', 'i', 'x'>> SettingRCntFix;
+    // MB of decompressed blocks kept around for compressed images
+    typedef Setting<int, irqus::typestring<'C', 'D', 'C', 'a', 'c', 'h', 'e'>, 8> SettingCDCache;
     Settings<SettingMcd1, SettingMcd2, SettingBios, SettingPpfDir, SettingPsxExe, SettingXa, SettingSioIrq,
              SettingSpuIrq, SettingBnWMdec, SettingAutoVideo, SettingVideo, SettingCDDA, SettingHLE, SettingSlowBoot,
-             SettingDebug, SettingVerbose, SettingRCntFix>
+             SettingDebug, SettingVerbose, SettingRCntFix, SettingCDCache, SettingMdecThread>
         settings;
     class PcsxConfig {
       public:
@@ -143,8 +149,8 @@ class Emulator {
         CPUType Cpu = CPU_DYNAREC;        // CPU_DYNAREC or CPU_INTERPRETER
         uint32_t RewindCount = 0;
         uint32_t RewindInterval = 0;
-        uint32_t AltSpeed1 = 0;  // Percent relative to natural speed.
-        uint32_t AltSpeed2 = 0;
+        uint32_t AltSpeed1 = 200;  // Percent relative to natural speed; 0 disables it.
+        uint32_t AltSpeed2 = 50;
         uint8_t HackFix = 0;
         uint8_t MemHack = 0;
         bool OverClock = false;  // enable overclocking
@@ -167,6 +173,16 @@ class Emulator {
     uint32_t m_psxClockSpeed = 33868800 /* 33.8688 MHz */;
     enum { BIAS = 2 };
 
+    // Alternate speed currently selected: 0 for the natural speed, 1 or 2 for AltSpeed1 or AltSpeed2.
+    // The frame limiter and the audio time stretcher both follow speed().
+    unsigned m_altSpeed = 0;
+    uint32_t speed() {
+        uint32_t percent = 0;
+        if (m_altSpeed == 1) percent = m_config.AltSpeed1;
+        if (m_altSpeed == 2) percent = m_config.AltSpeed2;
+        return percent ? percent : 100;
+    }
+
     int EmuInit();
     void EmuReset();
     void EmuShutdown();
@@ -190,11 +206,8 @@ class Emulator {
     std::unique_ptr<SPU::impl> m_spu;
     std::unique_ptr<PAD> m_pad1;
     std::unique_ptr<PAD> m_pad2;
-
-    static Emulator& getEmulator() {
-        static Emulator emulator;
-        return emulator;
-    }
+    // only set while benchmarking
+    std::unique_ptr<Profiler> m_profiler;
 
     char m_cdromId[10] = "";
     char m_cdromLabel[33] = "";
@@ -203,7 +216,7 @@ class Emulator {
     PcsxConfig m_config;
 };
 
-extern Emulator& g_emulator;
+extern thread_local Emulator* g_emulator;
 
 }  // namespace PCSX
 
@@ -24,33 +24,33 @@
 #include "core/psxhle.h"
 
 static void hleDummy() {
-    PCSX::g_emulator.m_psxCpu->m_psxRegs.pc = PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.n.ra;
+    PCSX::g_emulator->m_psxCpu->m_psxRegs.pc = PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.n.ra;
 
-    PCSX::g_emulator.m_psxCpu->psxBranchTest();
+    PCSX::g_emulator->m_psxCpu->psxBranchTest();
 }
 
 static void hleA0() {
-    uint32_t call = PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.n.t1 & 0xff;
+    uint32_t call = PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.n.t1 & 0xff;
 
-    PCSX::g_emulator.m_psxBios->callA0(call);
+    PCSX::g_emulator->m_psxBios->callA0(call);
 
-    PCSX::g_emulator.m_psxCpu->psxBranchTest();
+    PCSX::g_emulator->m_psxCpu->psxBranchTest();
 }
 
 static void hleB0() {
-    uint32_t call = PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.n.t1 & 0xff;
+    uint32_t call = PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.n.t1 & 0xff;
 
-    PCSX::g_emulator.m_psxBios->callB0(call);
+    PCSX::g_emulator->m_psxBios->callB0(call);
 
-    PCSX::g_emulator.m_psxCpu->psxBranchTest();
+    PCSX::g_emulator->m_psxCpu->psxBranchTest();
 }
 
 static void hleC0() {
-    uint32_t call = PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.n.t1 & 0xff;
+    uint32_t call = PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.n.t1 & 0xff;
 
-    PCSX::g_emulator.m_psxBios->callC0(call);
+    PCSX::g_emulator->m_psxBios->callC0(call);
 
-    PCSX::g_emulator.m_psxCpu->psxBranchTest();
+    PCSX::g_emulator->m_psxCpu->psxBranchTest();
 }
 
 static void hleBootstrap() {  // 0xbfc00000
@@ -58,18 +58,18 @@ static void hleBootstrap() {  // 0xbfc00000
     if (!CheckCdrom()) {
         PCSX::g_system->biosPrintf("hleBootstrap: No CDRom\n");
         PCSX::g_system->stop();
-        PCSX::g_emulator.EmuReset();
+        PCSX::g_emulator->EmuReset();
         return;
     }
     if (!LoadCdrom()) {
         PCSX::g_system->biosPrintf("hleBootstrap: failed to load cdrom's binary\n");
         PCSX::g_system->stop();
-        PCSX::g_emulator.EmuReset();
+        PCSX::g_emulator->EmuReset();
         return;
     }
-    PCSX::g_system->biosPrintf("CdromLabel: \"%s\": PC = %8.8x (SP = %8.8x)\n", PCSX::g_emulator.m_cdromLabel,
-                                  (unsigned int)PCSX::g_emulator.m_psxCpu->m_psxRegs.pc,
-                                  (unsigned int)PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.n.sp);
+    PCSX::g_system->biosPrintf("CdromLabel: \"%s\": PC = %8.8x (SP = %8.8x)\n", PCSX::g_emulator->m_cdromLabel,
+                                  (unsigned int)PCSX::g_emulator->m_psxCpu->m_psxRegs.pc,
+                                  (unsigned int)PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.n.sp);
 }
 
 typedef struct {
@@ -87,18 +87,18 @@ typedef struct {
 } EXEC;
 
 static void hleExecRet() {
-    EXEC *header = (EXEC *)PSXM(PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.n.s0);
+    EXEC *header = (EXEC *)PSXM(PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.n.s0);
 
-    PCSX::g_system->biosPrintf("ExecRet %x: %x\n", PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.n.s0, header->ret);
+    PCSX::g_system->biosPrintf("ExecRet %x: %x\n", PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.n.s0, header->ret);
 
-    PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.n.ra = header->ret;
-    PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.n.sp = header->_sp;
-    PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.n.s8 = header->_fp;
-    PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.n.gp = header->_gp;
-    PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.n.s0 = header->base;
+    PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.n.ra = header->ret;
+    PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.n.sp = header->_sp;
+    PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.n.s8 = header->_fp;
+    PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.n.gp = header->_gp;
+    PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.n.s0 = header->base;
 
-    PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.n.v0 = 1;
-    PCSX::g_emulator.m_psxCpu->m_psxRegs.pc = PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.n.ra;
+    PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.n.v0 = 1;
+    PCSX::g_emulator->m_psxCpu->m_psxRegs.pc = PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.n.ra;
 }
 
 const HLE_t psxHLEt[8] = {hleDummy, hleA0, hleB0, hleC0, hleBootstrap, hleExecRet, hleDummy, hleDummy};
@@ -32,14 +32,14 @@
 static inline void setIrq(uint32_t irq) { psxHu32ref(0x1070) |= SWAP_LEu32(irq); }
 
 void PCSX::HW::psxHwReset() {
-    if (PCSX::g_emulator.settings.get<PCSX::Emulator::SettingSioIrq>()) psxHu32ref(0x1070) |= SWAP_LE32(0x80);
-    if (PCSX::g_emulator.settings.get<PCSX::Emulator::SettingSpuIrq>()) psxHu32ref(0x1070) |= SWAP_LE32(0x200);
+    if (PCSX::g_emulator->settings.get<PCSX::Emulator::SettingSioIrq>()) psxHu32ref(0x1070) |= SWAP_LE32(0x80);
+    if (PCSX::g_emulator->settings.get<PCSX::Emulator::SettingSpuIrq>()) psxHu32ref(0x1070) |= SWAP_LE32(0x200);
 
-    memset(PCSX::g_emulator.m_psxMem->g_psxH, 0, 0x10000);
+    memset(PCSX::g_emulator->m_psxMem->g_psxH, 0, 0x10000);
 
-    PCSX::g_emulator.m_mdec->mdecInit();  // initialize mdec decoder
-    PCSX::g_emulator.m_cdrom->reset();
-    PCSX::g_emulator.m_psxCounters->psxRcntInit();
+    PCSX::g_emulator->m_mdec->mdecInit();  // initialize mdec decoder
+    PCSX::g_emulator->m_cdrom->reset();
+    PCSX::g_emulator->m_psxCounters->psxRcntInit();
 }
 
 uint8_t PCSX::HW::psxHwRead8(uint32_t add) {
@@ -47,7 +47,7 @@ uint8_t PCSX::HW::psxHwRead8(uint32_t add) {
 
     switch (add) {
         case 0x1f801040:
-            hard = PCSX::g_emulator.m_sio->sioRead8();
+            hard = PCSX::g_emulator->m_sio->sioRead8();
             break;
 #ifdef ENABLE_SIO1API
         case 0x1f801050:
@@ -55,16 +55,16 @@ uint8_t PCSX::HW::psxHwRead8(uint32_t add) {
             break;
 #endif
         case 0x1f801800:
-            hard = PCSX::g_emulator.m_cdrom->read0();
+            hard = PCSX::g_emulator->m_cdrom->read0();
             break;
         case 0x1f801801:
-            hard = PCSX::g_emulator.m_cdrom->read1();
+            hard = PCSX::g_emulator->m_cdrom->read1();
             break;
         case 0x1f801802:
-            hard = PCSX::g_emulator.m_cdrom->read2();
+            hard = PCSX::g_emulator->m_cdrom->read2();
             break;
         case 0x1f801803:
-            hard = PCSX::g_emulator.m_cdrom->read3();
+            hard = PCSX::g_emulator->m_cdrom->read3();
             break;
         default:
             hard = psxHu8(add);
@@ -87,24 +87,24 @@ uint16_t PCSX::HW::psxHwRead16(uint32_t add) {
             PSXHW_LOG("IMASK 16bit read %x\n", psxHu16(0x1074));
             return psxHu16(0x1074);
         case 0x1f801040:
-            hard = PCSX::g_emulator.m_sio->sioRead8();
-            hard |= PCSX::g_emulator.m_sio->sioRead8() << 8;
+            hard = PCSX::g_emulator->m_sio->sioRead8();
+            hard |= PCSX::g_emulator->m_sio->sioRead8() << 8;
             PAD_LOG("sio read16 %x; ret = %x\n", add & 0xf, hard);
             return hard;
         case 0x1f801044:
-            hard = PCSX::g_emulator.m_sio->sioReadStat16();
+            hard = PCSX::g_emulator->m_sio->sioReadStat16();
             PAD_LOG("sio read16 %x; ret = %x\n", add & 0xf, hard);
             return hard;
         case 0x1f801048:
-            hard = PCSX::g_emulator.m_sio->sioReadMode16();
+            hard = PCSX::g_emulator->m_sio->sioReadMode16();
             PAD_LOG("sio read16 %x; ret = %x\n", add & 0xf, hard);
             return hard;
         case 0x1f80104a:
-            hard = PCSX::g_emulator.m_sio->sioReadCtrl16();
+            hard = PCSX::g_emulator->m_sio->sioReadCtrl16();
             PAD_LOG("sio read16 %x; ret = %x\n", add & 0xf, hard);
             return hard;
         case 0x1f80104e:
-            hard = PCSX::g_emulator.m_sio->sioReadBaud16();
+            hard = PCSX::g_emulator->m_sio->sioReadBaud16();
             PAD_LOG("sio read16 %x; ret = %x\n", add & 0xf, hard);
             return hard;
 #ifdef ENABLE_SIO1API
@@ -130,39 +130,39 @@ uint16_t PCSX::HW::psxHwRead16(uint32_t add) {
             return hard;
 #endif
         case 0x1f801100:
-            hard = PCSX::g_emulator.m_psxCounters->psxRcntRcount(0);
+            hard = PCSX::g_emulator->m_psxCounters->psxRcntRcount(0);
             PSXHW_LOG("T0 count read16: %x\n", hard);
             return hard;
         case 0x1f801104:
-            hard = PCSX::g_emulator.m_psxCounters->psxRcntRmode(0);
+            hard = PCSX::g_emulator->m_psxCounters->psxRcntRmode(0);
             PSXHW_LOG("T0 mode read16: %x\n", hard);
             return hard;
         case 0x1f801108:
-            hard = PCSX::g_emulator.m_psxCounters->psxRcntRtarget(0);
+            hard = PCSX::g_emulator->m_psxCounters->psxRcntRtarget(0);
             PSXHW_LOG("T0 target read16: %x\n", hard);
             return hard;
         case 0x1f801110:
-            hard = PCSX::g_emulator.m_psxCounters->psxRcntRcount(1);
+            hard = PCSX::g_emulator->m_psxCounters->psxRcntRcount(1);
             PSXHW_LOG("T1 count read16: %x\n", hard);
             return hard;
         case 0x1f801114:
-            hard = PCSX::g_emulator.m_psxCounters->psxRcntRmode(1);
+            hard = PCSX::g_emulator->m_psxCounters->psxRcntRmode(1);
             PSXHW_LOG("T1 mode read16: %x\n", hard);
             return hard;
         case 0x1f801118:
-            hard = PCSX::g_emulator.m_psxCounters->psxRcntRtarget(1);
+            hard = PCSX::g_emulator->m_psxCounters->psxRcntRtarget(1);
             PSXHW_LOG("T1 target read16: %x\n", hard);
             return hard;
         case 0x1f801120:
-            hard = PCSX::g_emulator.m_psxCounters->psxRcntRcount(2);
+            hard = PCSX::g_emulator->m_psxCounters->psxRcntRcount(2);
             PSXHW_LOG("T2 count read16: %x\n", hard);
             return hard;
         case 0x1f801124:
-            hard = PCSX::g_emulator.m_psxCounters->psxRcntRmode(2);
+            hard = PCSX::g_emulator->m_psxCounters->psxRcntRmode(2);
             PSXHW_LOG("T2 mode read16: %x\n", hard);
             return hard;
         case 0x1f801128:
-            hard = PCSX::g_emulator.m_psxCounters->psxRcntRtarget(2);
+            hard = PCSX::g_emulator->m_psxCounters->psxRcntRtarget(2);
             PSXHW_LOG("T2 target read16: %x\n", hard);
             return hard;
 
@@ -171,7 +171,7 @@ uint16_t PCSX::HW::psxHwRead16(uint32_t add) {
 
         default:
             if (add >= 0x1f801c00 && add < 0x1f801e00) {
-                hard = PCSX::g_emulator.m_spu->readRegister(add);
+                hard = PCSX::g_emulator->m_spu->readRegister(add);
             } else {
                 hard = psxHu16(add);
                 PSXHW_LOG("*Unkwnown 16bit read at address %x\n", add);
@@ -188,10 +188,10 @@ uint32_t PCSX::HW::psxHwRead32(uint32_t add) {
 
     switch (add) {
         case 0x1f801040:
-            hard = PCSX::g_emulator.m_sio->sioRead8();
-            hard |= PCSX::g_emulator.m_sio->sioRead8() << 8;
-            hard |= PCSX::g_emulator.m_sio->sioRead8() << 16;
-            hard |= PCSX::g_emulator.m_sio->sioRead8() << 24;
+            hard = PCSX::g_emulator->m_sio->sioRead8();
+            hard |= PCSX::g_emulator->m_sio->sioRead8() << 8;
+            hard |= PCSX::g_emulator->m_sio->sioRead8() << 16;
+            hard |= PCSX::g_emulator->m_sio->sioRead8() << 24;
             PAD_LOG("sio read32 ;ret = %x\n", hard);
             return hard;
 #ifdef ENABLE_SIO1API
@@ -210,19 +210,19 @@ uint32_t PCSX::HW::psxHwRead32(uint32_t add) {
             PSXHW_LOG("IMASK 32bit read %x\n", psxHu32(0x1074));
             return psxHu32(0x1074);
         case 0x1f801810:
-            hard = PCSX::g_emulator.m_gpu->readData();
+            hard = PCSX::g_emulator->m_gpu->readData();
             PSXHW_LOG("GPU DATA 32bit read %x\n", hard);
             return hard;
         case 0x1f801814:
-            hard = PCSX::g_emulator.m_gpu->gpuReadStatus();
+            hard = PCSX::g_emulator->m_gpu->gpuReadStatus();
             PSXHW_LOG("GPU STATUS 32bit read %x\n", hard);
             return hard;
 
         case 0x1f801820:
-            hard = PCSX::g_emulator.m_mdec->mdecRead0();
+            hard = PCSX::g_emulator->m_mdec->mdecRead0();
             break;
         case 0x1f801824:
-            hard = PCSX::g_emulator.m_mdec->mdecRead1();
+            hard = PCSX::g_emulator->m_mdec->mdecRead1();
             break;
         case 0x1f8010a0:
             PSXHW_LOG("DMA2 MADR 32bit read %x\n", psxHu32(0x10a0));
@@ -250,39 +250,39 @@ uint32_t PCSX::HW::psxHwRead32(uint32_t add) {
             return SWAP_LEu32(HW_DMA_ICR);  // DMA interrupt register (enable/ack)
         // time for rootcounters :)
         case 0x1f801100:
-            hard = PCSX::g_emulator.m_psxCounters->psxRcntRcount(0);
+            hard = PCSX::g_emulator->m_psxCounters->psxRcntRcount(0);
             PSXHW_LOG("T0 count read32: %x\n", hard);
             return hard;
         case 0x1f801104:
-            hard = PCSX::g_emulator.m_psxCounters->psxRcntRmode(0);
+            hard = PCSX::g_emulator->m_psxCounters->psxRcntRmode(0);
             PSXHW_LOG("T0 mode read32: %x\n", hard);
             return hard;
         case 0x1f801108:
-            hard = PCSX::g_emulator.m_psxCounters->psxRcntRtarget(0);
+            hard = PCSX::g_emulator->m_psxCounters->psxRcntRtarget(0);
             PSXHW_LOG("T0 target read32: %x\n", hard);
             return hard;
         case 0x1f801110:
-            hard = PCSX::g_emulator.m_psxCounters->psxRcntRcount(1);
+            hard = PCSX::g_emulator->m_psxCounters->psxRcntRcount(1);
             PSXHW_LOG("T1 count read32: %x\n", hard);
             return hard;
         case 0x1f801114:
-            hard = PCSX::g_emulator.m_psxCounters->psxRcntRmode(1);
+            hard = PCSX::g_emulator->m_psxCounters->psxRcntRmode(1);
             PSXHW_LOG("T1 mode read32: %x\n", hard);
             return hard;
         case 0x1f801118:
-            hard = PCSX::g_emulator.m_psxCounters->psxRcntRtarget(1);
+            hard = PCSX::g_emulator->m_psxCounters->psxRcntRtarget(1);
             PSXHW_LOG("T1 target read32: %x\n", hard);
             return hard;
         case 0x1f801120:
-            hard = PCSX::g_emulator.m_psxCounters->psxRcntRcount(2);
+            hard = PCSX::g_emulator->m_psxCounters->psxRcntRcount(2);
             PSXHW_LOG("T2 count read32: %x\n", hard);
             return hard;
         case 0x1f801124:
-            hard = PCSX::g_emulator.m_psxCounters->psxRcntRmode(2);
+            hard = PCSX::g_emulator->m_psxCounters->psxRcntRmode(2);
             PSXHW_LOG("T2 mode read32: %x\n", hard);
             return hard;
         case 0x1f801128:
-            hard = PCSX::g_emulator.m_psxCounters->psxRcntRtarget(2);
+            hard = PCSX::g_emulator->m_psxCounters->psxRcntRtarget(2);
             PSXHW_LOG("T2 target read32: %x\n", hard);
             return hard;
         case 0x1f801014:
@@ -302,7 +302,7 @@ uint32_t PCSX::HW::psxHwRead32(uint32_t add) {
 void PCSX::HW::psxHwWrite8(uint32_t add, uint8_t value) {
     switch (add) {
         case 0x1f801040:
-            PCSX::g_emulator.m_sio->sioWrite8(value);
+            PCSX::g_emulator->m_sio->sioWrite8(value);
             break;
 #ifdef ENABLE_SIO1API
         case 0x1f801050:
@@ -310,16 +310,20 @@ void PCSX::HW::psxHwWrite8(uint32_t add, uint8_t value) {
             break;
 #endif
         case 0x1f801800:
-            PCSX::g_emulator.m_cdrom->write0(value);
+            PCSX::g_emulator->m_cdrom->write0(value);
             break;
         case 0x1f801801:
-            PCSX::g_emulator.m_cdrom->write1(value);
+            PCSX::g_emulator->m_cdrom->write1(value);
             break;
         case 0x1f801802:
-            PCSX::g_emulator.m_cdrom->write2(value);
+            PCSX::g_emulator->m_cdrom->write2(value);
             break;
         case 0x1f801803:
-            PCSX::g_emulator.m_cdrom->write3(value);
+            PCSX::g_emulator->m_cdrom->write3(value);
+            break;
+        case 0x1f802082:
+            // exit register of the expansion 2 area, for test programs to end the run
+            PCSX::g_system->testQuit((int8_t)value);
             break;
 
         default:
@@ -334,24 +338,24 @@ void PCSX::HW::psxHwWrite8(uint32_t add, uint8_t value) {
 void PCSX::HW::psxHwWrite16(uint32_t add, uint16_t value) {
     switch (add) {
         case 0x1f801040:
-            PCSX::g_emulator.m_sio->sioWrite8((unsigned char)value);
-            PCSX::g_emulator.m_sio->sioWrite8((unsigned char)(value >> 8));
+            PCSX::g_emulator->m_sio->sioWrite8((unsigned char)value);
+            PCSX::g_emulator->m_sio->sioWrite8((unsigned char)(value >> 8));
             PAD_LOG("sio write16 %x, %x\n", add & 0xf, value);
             return;
         case 0x1f801044:
-            PCSX::g_emulator.m_sio->sioWriteStat16(value);
+            PCSX::g_emulator->m_sio->sioWriteStat16(value);
             PAD_LOG("sio write16 %x, %x\n", add & 0xf, value);
             return;
         case 0x1f801048:
-            PCSX::g_emulator.m_sio->sioWriteMode16(value);
+            PCSX::g_emulator->m_sio->sioWriteMode16(value);
             PAD_LOG("sio write16 %x, %x\n", add & 0xf, value);
             return;
         case 0x1f80104a:  // control register
-            PCSX::g_emulator.m_sio->sioWriteCtrl16(value);
+            PCSX::g_emulator->m_sio->sioWriteCtrl16(value);
             PAD_LOG("sio write16 %x, %x\n", add & 0xf, value);
             return;
         case 0x1f80104e:  // baudrate register
-            PCSX::g_emulator.m_sio->sioWriteBaud16(value);
+            PCSX::g_emulator->m_sio->sioWriteBaud16(value);
             PAD_LOG("sio write16 %x, %x\n", add & 0xf, value);
             return;
 #ifdef ENABLE_SIO1API
@@ -378,8 +382,10 @@ void PCSX::HW::psxHwWrite16(uint32_t add, uint16_t value) {
 #endif
         case 0x1f801070:
             PSXHW_LOG("IREG 16bit write %x\n", value);
-            if (PCSX::g_emulator.settings.get<PCSX::Emulator::SettingSioIrq>()) psxHu16ref(0x1070) |= SWAP_LEu16(0x80);
-            if (PCSX::g_emulator.settings.get<PCSX::Emulator::SettingSpuIrq>()) psxHu16ref(0x1070) |= SWAP_LEu16(0x200);
+            if (PCSX::g_emulator->settings.get<PCSX::Emulator::SettingSioIrq>()) psxHu16ref(0x1070) |= SWAP_LEu16(0x80);
+            if (PCSX::g_emulator->settings.get<PCSX::Emulator::SettingSpuIrq>()) {
+                psxHu16ref(0x1070) |= SWAP_LEu16(0x200);
+            }
             psxHu16ref(0x1070) &= SWAP_LEu16(value);
             return;
 
@@ -390,46 +396,50 @@ void PCSX::HW::psxHwWrite16(uint32_t add, uint16_t value) {
 
         case 0x1f801100:
             PSXHW_LOG("COUNTER 0 COUNT 16bit write %x\n", value);
-            PCSX::g_emulator.m_psxCounters->psxRcntWcount(0, value);
+            PCSX::g_emulator->m_psxCounters->psxRcntWcount(0, value);
             return;
         case 0x1f801104:
             PSXHW_LOG("COUNTER 0 MODE 16bit write %x\n", value);
-            PCSX::g_emulator.m_psxCounters->psxRcntWmode(0, value);
+            PCSX::g_emulator->m_psxCounters->psxRcntWmode(0, value);
             return;
         case 0x1f801108:
             PSXHW_LOG("COUNTER 0 TARGET 16bit write %x\n", value);
-            PCSX::g_emulator.m_psxCounters->psxRcntWtarget(0, value);
+            PCSX::g_emulator->m_psxCounters->psxRcntWtarget(0, value);
             return;
 
         case 0x1f801110:
             PSXHW_LOG("COUNTER 1 COUNT 16bit write %x\n", value);
-            PCSX::g_emulator.m_psxCounters->psxRcntWcount(1, value);
+            PCSX::g_emulator->m_psxCounters->psxRcntWcount(1, value);
             return;
         case 0x1f801114:
             PSXHW_LOG("COUNTER 1 MODE 16bit write %x\n", value);
-            PCSX::g_emulator.m_psxCounters->psxRcntWmode(1, value);
+            PCSX::g_emulator->m_psxCounters->psxRcntWmode(1, value);
             return;
         case 0x1f801118:
             PSXHW_LOG("COUNTER 1 TARGET 16bit write %x\n", value);
-            PCSX::g_emulator.m_psxCounters->psxRcntWtarget(1, value);
+            PCSX::g_emulator->m_psxCounters->psxRcntWtarget(1, value);
             return;
 
         case 0x1f801120:
             PSXHW_LOG("COUNTER 2 COUNT 16bit write %x\n", value);
-            PCSX::g_emulator.m_psxCounters->psxRcntWcount(2, value);
+            PCSX::g_emulator->m_psxCounters->psxRcntWcount(2, value);
             return;
         case 0x1f801124:
             PSXHW_LOG("COUNTER 2 MODE 16bit write %x\n", value);
-            PCSX::g_emulator.m_psxCounters->psxRcntWmode(2, value);
+            PCSX::g_emulator->m_psxCounters->psxRcntWmode(2, value);
             return;
         case 0x1f801128:
             PSXHW_LOG("COUNTER 2 TARGET 16bit write %x\n", value);
-            PCSX::g_emulator.m_psxCounters->psxRcntWtarget(2, value);
+            PCSX::g_emulator->m_psxCounters->psxRcntWtarget(2, value);
             return;
 
+        case 0x1f802082:
+            // exit register of the expansion 2 area, for test programs to end the run
+            PCSX::g_system->testQuit((int16_t)value);
+            return;
         default:
             if (add >= 0x1f801c00 && add < 0x1f801e00) {
-                PCSX::g_emulator.m_spu->writeRegister(add, value);
+                PCSX::g_emulator->m_spu->writeRegister(add, value);
                 return;
             }
 
@@ -442,19 +452,19 @@ void PCSX::HW::psxHwWrite16(uint32_t add, uint16_t value) {
 }
 
 inline void PCSX::HW::psxDma0(uint32_t madr, uint32_t bcr, uint32_t chcr) {
-    PCSX::g_emulator.m_mdec->psxDma0(madr, bcr, chcr);
+    PCSX::g_emulator->m_mdec->psxDma0(madr, bcr, chcr);
 }
 
 inline void PCSX::HW::psxDma1(uint32_t madr, uint32_t bcr, uint32_t chcr) {
-    PCSX::g_emulator.m_mdec->psxDma1(madr, bcr, chcr);
+    PCSX::g_emulator->m_mdec->psxDma1(madr, bcr, chcr);
 }
 
 inline void PCSX::HW::psxDma2(uint32_t madr, uint32_t bcr, uint32_t chcr) {
-    PCSX::g_emulator.m_gpu->dma(madr, bcr, chcr);
+    PCSX::g_emulator->m_gpu->dma(madr, bcr, chcr);
 }
 
 inline void PCSX::HW::psxDma3(uint32_t madr, uint32_t bcr, uint32_t chcr) {
-    PCSX::g_emulator.m_cdrom->dma(madr, bcr, chcr);
+    PCSX::g_emulator->m_cdrom->dma(madr, bcr, chcr);
 }
 
 #define DmaExec(n)                                                                                              \
@@ -469,10 +479,10 @@ inline void PCSX::HW::psxDma3(uint32_t madr, uint32_t bcr, uint32_t chcr) {
 void PCSX::HW::psxHwWrite32(uint32_t add, uint32_t value) {
     switch (add) {
         case 0x1f801040:
-            PCSX::g_emulator.m_sio->sioWrite8((unsigned char)value);
-            PCSX::g_emulator.m_sio->sioWrite8((unsigned char)((value & 0xff) >> 8));
-            PCSX::g_emulator.m_sio->sioWrite8((unsigned char)((value & 0xff) >> 16));
-            PCSX::g_emulator.m_sio->sioWrite8((unsigned char)((value & 0xff) >> 24));
+            PCSX::g_emulator->m_sio->sioWrite8((unsigned char)value);
+            PCSX::g_emulator->m_sio->sioWrite8((unsigned char)((value & 0xff) >> 8));
+            PCSX::g_emulator->m_sio->sioWrite8((unsigned char)((value & 0xff) >> 16));
+            PCSX::g_emulator->m_sio->sioWrite8((unsigned char)((value & 0xff) >> 24));
             PAD_LOG("sio write32 %x\n", value);
             return;
 #ifdef ENABLE_SIO1API
@@ -487,8 +497,10 @@ void PCSX::HW::psxHwWrite32(uint32_t add, uint32_t value) {
             return;  // Ram size
         case 0x1f801070:
             PSXHW_LOG("IREG 32bit write %x\n", value);
-            if (PCSX::g_emulator.settings.get<PCSX::Emulator::SettingSioIrq>()) psxHu32ref(0x1070) |= SWAP_LEu32(0x80);
-            if (PCSX::g_emulator.settings.get<PCSX::Emulator::SettingSpuIrq>()) psxHu32ref(0x1070) |= SWAP_LEu32(0x200);
+            if (PCSX::g_emulator->settings.get<PCSX::Emulator::SettingSioIrq>()) psxHu32ref(0x1070) |= SWAP_LEu32(0x80);
+            if (PCSX::g_emulator->settings.get<PCSX::Emulator::SettingSpuIrq>()) {
+                psxHu32ref(0x1070) |= SWAP_LEu32(0x200);
+            }
             psxHu32ref(0x1070) &= SWAP_LEu32(value);
             return;
         case 0x1f801074:
@@ -540,7 +552,7 @@ void PCSX::HW::psxHwWrite32(uint32_t add, uint32_t value) {
                 return;
             }
             DmaExec(2);  // DMA2 chcr (GPU DMA)
-            if (PCSX::g_emulator.config().HackFix && HW_DMA2_CHCR == 0x1000401) s_dmaGpuListHackEn = true;
+            if (PCSX::g_emulator->config().HackFix && HW_DMA2_CHCR == 0x1000401) s_dmaGpuListHackEn = true;
             return;
         case 0x1f8010b0:
             PSXHW_LOG("DMA3 MADR 32bit write %x\n", value);
@@ -606,67 +618,71 @@ void PCSX::HW::psxHwWrite32(uint32_t add, uint32_t value) {
             // MML/Tronbonne is known to use this.
             // TODO FIFO is not implemented properly so commands are not exact
             // and thus we rely on hack that counter/cdrom irqs are enabled at same time
-            if (PCSX::g_emulator.config().HackFix && SWAP_LEu32(value) == 0x1f00000 && (psxHu32ref(0x1070) & 0x44)) {
+            if (PCSX::g_emulator->config().HackFix && SWAP_LEu32(value) == 0x1f00000 && (psxHu32ref(0x1070) & 0x44)) {
                 setIrq(0x01);
             }
-            PCSX::g_emulator.m_gpu->writeData(value);
+            PCSX::g_emulator->m_gpu->writeData(value);
             return;
         case 0x1f801814:
             PSXHW_LOG("GPU STATUS 32bit write %x\n", value);
             if (value & 0x8000000) s_dmaGpuListHackEn = false;
-            PCSX::g_emulator.m_gpu->writeStatus(value);
+            PCSX::g_emulator->m_gpu->writeStatus(value);
             return;
 
         case 0x1f801820:
-            PCSX::g_emulator.m_mdec->mdecWrite0(value);
+            PCSX::g_emulator->m_mdec->mdecWrite0(value);
             break;
         case 0x1f801824:
-            PCSX::g_emulator.m_mdec->mdecWrite1(value);
+            PCSX::g_emulator->m_mdec->mdecWrite1(value);
             break;
         case 0x1f801100:
             PSXHW_LOG("COUNTER 0 COUNT 32bit write %x\n", value);
-            PCSX::g_emulator.m_psxCounters->psxRcntWcount(0, value & 0xffff);
+            PCSX::g_emulator->m_psxCounters->psxRcntWcount(0, value & 0xffff);
             return;
         case 0x1f801104:
             PSXHW_LOG("COUNTER 0 MODE 32bit write %x\n", value);
-            PCSX::g_emulator.m_psxCounters->psxRcntWmode(0, value);
+            PCSX::g_emulator->m_psxCounters->psxRcntWmode(0, value);
             return;
         case 0x1f801108:
             PSXHW_LOG("COUNTER 0 TARGET 32bit write %x\n", value);
-            PCSX::g_emulator.m_psxCounters->psxRcntWtarget(0, value & 0xffff);
+            PCSX::g_emulator->m_psxCounters->psxRcntWtarget(0, value & 0xffff);
             return;  //  HW_DMA_ICR&= SWAP_LE32((~value)&0xff000000);
         case 0x1f801110:
             PSXHW_LOG("COUNTER 1 COUNT 32bit write %x\n", value);
-            PCSX::g_emulator.m_psxCounters->psxRcntWcount(1, value & 0xffff);
+            PCSX::g_emulator->m_psxCounters->psxRcntWcount(1, value & 0xffff);
             return;
         case 0x1f801114:
             PSXHW_LOG("COUNTER 1 MODE 32bit write %x\n", value);
-            PCSX::g_emulator.m_psxCounters->psxRcntWmode(1, value);
+            PCSX::g_emulator->m_psxCounters->psxRcntWmode(1, value);
             return;
         case 0x1f801118:
             PSXHW_LOG("COUNTER 1 TARGET 32bit write %x\n", value);
-            PCSX::g_emulator.m_psxCounters->psxRcntWtarget(1, value & 0xffff);
+            PCSX::g_emulator->m_psxCounters->psxRcntWtarget(1, value & 0xffff);
             return;
         case 0x1f801120:
             PSXHW_LOG("COUNTER 2 COUNT 32bit write %x\n", value);
-            PCSX::g_emulator.m_psxCounters->psxRcntWcount(2, value & 0xffff);
+            PCSX::g_emulator->m_psxCounters->psxRcntWcount(2, value & 0xffff);
             return;
         case 0x1f801124:
             PSXHW_LOG("COUNTER 2 MODE 32bit write %x\n", value);
-            PCSX::g_emulator.m_psxCounters->psxRcntWmode(2, value);
+            PCSX::g_emulator->m_psxCounters->psxRcntWmode(2, value);
             return;
         case 0x1f801128:
             PSXHW_LOG("COUNTER 2 TARGET 32bit write %x\n", value);
-            PCSX::g_emulator.m_psxCounters->psxRcntWtarget(2, value & 0xffff);
+            PCSX::g_emulator->m_psxCounters->psxRcntWtarget(2, value & 0xffff);
+            return;
+        case 0x1f802082:
+            // exit register of the expansion 2 area, for test programs to end the run
+            PCSX::g_system->testQuit((int32_t)value);
             return;
         default:
             // Dukes of Hazard 2 - car engine noise
             if (add >= 0x1f801c00 && add < 0x1f801e00) {
-                PCSX::g_emulator.m_spu->writeRegister(add, value & 0xffff);
+                PCSX::g_emulator->m_spu->writeRegister(add, value & 0xffff);
                 add += 2;
                 value >>= 16;
 
-                if (add >= 0x1f801c00 && add < 0x1f801e00) PCSX::g_emulator.m_spu->writeRegister(add, value & 0xffff);
+                if (add >= 0x1f801c00 && add < 0x1f801e00) PCSX::g_emulator->m_spu->writeRegister(add, value & 0xffff);
                 return;
             }
 
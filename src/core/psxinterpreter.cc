@@ -33,7 +33,7 @@
 
 /* GTE wrappers */
 #define GTE_WR(n) \
-    void PCSX::InterpretedCPU::gte##n() { PCSX::g_emulator.m_gte->n(); }
+    void PCSX::InterpretedCPU::gte##n() { PCSX::g_emulator->m_gte->n(); }
 GTE_WR(LWC2);
 GTE_WR(SWC2);
 GTE_WR(RTPS);
@@ -64,58 +64,59 @@ GTE_WR(CTC2);
 
 // These macros are used to assemble the repassembler functions
 
-#define debugI()                                                                                                       \
-    if (PCSX::g_emulator.settings.get<PCSX::Emulator::SettingVerbose>()) {                                             \
-        std::string ins = Disasm::asString(g_emulator.m_psxCpu->m_psxRegs.code, 0, g_emulator.m_psxCpu->m_psxRegs.pc); \
-        PSXCPU_LOG("%s\n", ins.c_str());                                                                               \
+#define debugI()                                                            \
+    if (PCSX::g_emulator->settings.get<PCSX::Emulator::SettingVerbose>()) { \
+        auto &regs = g_emulator->m_psxCpu->m_psxRegs;                       \
+        std::string ins = Disasm::asString(regs.code, 0, regs.pc);          \
+        PSXCPU_LOG("%s\n", ins.c_str());                                    \
     }
 
 void PCSX::InterpretedCPU::delayRead(int reg, uint32_t bpc) {
     uint32_t rold, rnew;
 
-    //  PCSX::g_system->printf("delayRead at %x!\n", PCSX::g_emulator.m_psxCpu->m_psxRegs.pc);
+    //  PCSX::g_system->printf("delayRead at %x!\n", PCSX::g_emulator->m_psxCpu->m_psxRegs.pc);
 
-    rold = PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.r[reg];
-    cIntFunc_t func = s_pPsxBSC[PCSX::g_emulator.m_psxCpu->m_psxRegs.code >> 26];
+    rold = PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.r[reg];
+    cIntFunc_t func = s_pPsxBSC[PCSX::g_emulator->m_psxCpu->m_psxRegs.code >> 26];
     (*this.*func)();  // branch delay load
-    rnew = PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.r[reg];
+    rnew = PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.r[reg];
 
-    PCSX::g_emulator.m_psxCpu->m_psxRegs.pc = bpc;
+    PCSX::g_emulator->m_psxCpu->m_psxRegs.pc = bpc;
 
     s_branch = 0;
 
-    PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.r[reg] = rold;
+    PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.r[reg] = rold;
     execI();  // first branch opcode
-    PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.r[reg] = rnew;
+    PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.r[reg] = rnew;
 
-    PCSX::g_emulator.m_psxCpu->psxBranchTest();
+    PCSX::g_emulator->m_psxCpu->psxBranchTest();
 }
 
 void PCSX::InterpretedCPU::delayWrite(int reg, uint32_t bpc) {
-    /*  PCSX::g_system->printf("delayWrite at %x!\n", PCSX::g_emulator.m_psxCpu->m_psxRegs.pc);
+    /*  PCSX::g_system->printf("delayWrite at %x!\n", PCSX::g_emulator->m_psxCpu->m_psxRegs.pc);
 
-            PCSX::g_system->printf("%s\n", disR3000AF(PCSX::g_emulator.m_psxCpu->m_psxRegs.code,
-       PCSX::g_emulator.m_psxCpu->m_psxRegs.pc-4)); PCSX::g_system->printf("%s\n", disR3000AF(PSXMu32(bpc), bpc));*/
+            PCSX::g_system->printf("%s\n", disR3000AF(PCSX::g_emulator->m_psxCpu->m_psxRegs.code,
+       PCSX::g_emulator->m_psxCpu->m_psxRegs.pc-4)); PCSX::g_system->printf("%s\n", disR3000AF(PSXMu32(bpc), bpc));*/
 
     // no changes from normal behavior
-    cIntFunc_t func = s_pPsxBSC[PCSX::g_emulator.m_psxCpu->m_psxRegs.code >> 26];
+    cIntFunc_t func = s_pPsxBSC[PCSX::g_emulator->m_psxCpu->m_psxRegs.code >> 26];
     (*this.*func)();
 
     s_branch = 0;
-    PCSX::g_emulator.m_psxCpu->m_psxRegs.pc = bpc;
+    PCSX::g_emulator->m_psxCpu->m_psxRegs.pc = bpc;
 
-    PCSX::g_emulator.m_psxCpu->psxBranchTest();
+    PCSX::g_emulator->m_psxCpu->psxBranchTest();
 }
 
 void PCSX::InterpretedCPU::delayReadWrite(int reg, uint32_t bpc) {
-    //  PCSX::g_system->printf("delayReadWrite at %x!\n", PCSX::g_emulator.m_psxCpu->m_psxRegs.pc);
+    //  PCSX::g_system->printf("delayReadWrite at %x!\n", PCSX::g_emulator->m_psxCpu->m_psxRegs.pc);
 
     // the branch delay load is skipped
 
     s_branch = 0;
-    PCSX::g_emulator.m_psxCpu->m_psxRegs.pc = bpc;
+    PCSX::g_emulator->m_psxCpu->m_psxRegs.pc = bpc;
 
-    PCSX::g_emulator.m_psxCpu->psxBranchTest();
+    PCSX::g_emulator->m_psxCpu->psxBranchTest();
 }
 
 // this defines shall be used with the tmp
@@ -335,7 +336,7 @@ void PCSX::InterpretedCPU::psxDelayTest(int reg, uint32_t bpc) {
     uint32_t tmp;
 
     // Don't execute yet - just peek
-    code = PCSX::g_emulator.m_psxCpu->Read_ICache(bpc, true);
+    code = PCSX::g_emulator->m_psxCpu->Read_ICache(bpc, true);
 
     tmp = ((code == NULL) ? 0 : SWAP_LE32(*code));
     s_branch = 1;
@@ -364,8 +365,8 @@ uint32_t PCSX::InterpretedCPU::psxBranchNoDelay() {
     uint32_t *code;
     uint32_t temp;
 
-    code = PCSX::g_emulator.m_psxCpu->Read_ICache(PCSX::g_emulator.m_psxCpu->m_psxRegs.pc, true);
-    PCSX::g_emulator.m_psxCpu->m_psxRegs.code = ((code == NULL) ? 0 : SWAP_LE32(*code));
+    code = PCSX::g_emulator->m_psxCpu->Read_ICache(PCSX::g_emulator->m_psxCpu->m_psxRegs.pc, true);
+    PCSX::g_emulator->m_psxCpu->m_psxRegs.code = ((code == NULL) ? 0 : SWAP_LE32(*code));
     switch (_Op_) {
         case 0x00:  // SPECIAL
             switch (_Funct_) {
@@ -427,9 +428,9 @@ int PCSX::InterpretedCPU::psxDelayBranchExec(uint32_t tar) {
     execI();
 
     s_branch = 0;
-    PCSX::g_emulator.m_psxCpu->m_psxRegs.pc = tar;
-    PCSX::g_emulator.m_psxCpu->m_psxRegs.cycle += PCSX::Emulator::BIAS;
-    PCSX::g_emulator.m_psxCpu->psxBranchTest();
+    PCSX::g_emulator->m_psxCpu->m_psxRegs.pc = tar;
+    PCSX::g_emulator->m_psxCpu->m_psxRegs.cycle += PCSX::Emulator::BIAS;
+    PCSX::g_emulator->m_psxCpu->psxBranchTest();
     return 1;
 }
 
@@ -447,33 +448,33 @@ int PCSX::InterpretedCPU::psxDelayBranchTest(uint32_t tar1) {
      * - jump to tar2 (target of branch in delay slot; this branch
      *   has no normal delay slot, instruction at tar1 was fetched instead)
      */
-    PCSX::g_emulator.m_psxCpu->m_psxRegs.pc = tar1;
+    PCSX::g_emulator->m_psxCpu->m_psxRegs.pc = tar1;
     tmp1 = psxBranchNoDelay();
     if (tmp1 == (uint32_t)-1) {
         return psxDelayBranchExec(tar2);
     }
     debugI();
-    PCSX::g_emulator.m_psxCpu->m_psxRegs.cycle += PCSX::Emulator::BIAS;
+    PCSX::g_emulator->m_psxCpu->m_psxRegs.cycle += PCSX::Emulator::BIAS;
 
     /*
      * Got a branch at tar1:
      * - execute 1 instruction at tar2
      * - jump to target of that branch (tmp1)
      */
-    PCSX::g_emulator.m_psxCpu->m_psxRegs.pc = tar2;
+    PCSX::g_emulator->m_psxCpu->m_psxRegs.pc = tar2;
     tmp2 = psxBranchNoDelay();
     if (tmp2 == (uint32_t)-1) {
         return psxDelayBranchExec(tmp1);
     }
     debugI();
-    PCSX::g_emulator.m_psxCpu->m_psxRegs.cycle += PCSX::Emulator::BIAS;
+    PCSX::g_emulator->m_psxCpu->m_psxRegs.cycle += PCSX::Emulator::BIAS;
 
     /*
      * Got a branch at tar2:
      * - execute 1 instruction at tmp1
      * - jump to target of that branch (tmp2)
      */
-    PCSX::g_emulator.m_psxCpu->m_psxRegs.pc = tmp1;
+    PCSX::g_emulator->m_psxCpu->m_psxRegs.pc = tmp1;
     return psxDelayBranchExec(tmp2);
 }
 
@@ -488,17 +489,17 @@ inline void PCSX::InterpretedCPU::doBranch(uint32_t tar) {
     if (psxDelayBranchTest(tar)) return;
 
     // branch delay slot
-    code = PCSX::g_emulator.m_psxCpu->Read_ICache(PCSX::g_emulator.m_psxCpu->m_psxRegs.pc, true);
+    code = PCSX::g_emulator->m_psxCpu->Read_ICache(PCSX::g_emulator->m_psxCpu->m_psxRegs.pc, true);
 
-    PCSX::g_emulator.m_psxCpu->m_psxRegs.code = ((code == NULL) ? 0 : SWAP_LE32(*code));
+    PCSX::g_emulator->m_psxCpu->m_psxRegs.code = ((code == NULL) ? 0 : SWAP_LE32(*code));
 
     debugI();
 
-    PCSX::g_emulator.m_psxCpu->m_psxRegs.pc += 4;
-    PCSX::g_emulator.m_psxCpu->m_psxRegs.cycle += PCSX::Emulator::BIAS;
+    PCSX::g_emulator->m_psxCpu->m_psxRegs.pc += 4;
+    PCSX::g_emulator->m_psxCpu->m_psxRegs.cycle += PCSX::Emulator::BIAS;
 
     // check for load delay
-    tmp = PCSX::g_emulator.m_psxCpu->m_psxRegs.code >> 26;
+    tmp = PCSX::g_emulator->m_psxCpu->m_psxRegs.code >> 26;
     switch (tmp) {
         case 0x10:  // COP0
             switch (_Rs_) {
@@ -531,13 +532,13 @@ inline void PCSX::InterpretedCPU::doBranch(uint32_t tar) {
             break;
     }
 
-    cIntFunc_t func = s_pPsxBSC[PCSX::g_emulator.m_psxCpu->m_psxRegs.code >> 26];
+    cIntFunc_t func = s_pPsxBSC[PCSX::g_emulator->m_psxCpu->m_psxRegs.code >> 26];
     (*this.*func)();
 
     s_branch = 0;
-    PCSX::g_emulator.m_psxCpu->m_psxRegs.pc = s_branchPC;
+    PCSX::g_emulator->m_psxCpu->m_psxRegs.pc = s_branchPC;
 
-    PCSX::g_emulator.m_psxCpu->psxBranchTest();
+    PCSX::g_emulator->m_psxCpu->psxBranchTest();
 }
 
 /*********************************************************
@@ -652,15 +653,15 @@ void PCSX::InterpretedCPU::psxDIVU() {
 void PCSX::InterpretedCPU::psxMULT() {
     uint64_t res = (int64_t)((int64_t)_i32(_rRs_) * (int64_t)_i32(_rRt_));
 
-    PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.n.lo = (uint32_t)(res & 0xffffffff);
-    PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.n.hi = (uint32_t)((res >> 32) & 0xffffffff);
+    PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.n.lo = (uint32_t)(res & 0xffffffff);
+    PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.n.hi = (uint32_t)((res >> 32) & 0xffffffff);
 }
 
 void PCSX::InterpretedCPU::psxMULTU() {
     uint64_t res = (uint64_t)((uint64_t)_u32(_rRs_) * (uint64_t)_u32(_rRt_));
 
-    PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.n.lo = (uint32_t)(res & 0xffffffff);
-    PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.n.hi = (uint32_t)((res >> 32) & 0xffffffff);
+    PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.n.lo = (uint32_t)(res & 0xffffffff);
+    PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.n.hi = (uint32_t)((res >> 32) & 0xffffffff);
 }
 
 /*********************************************************
@@ -754,15 +755,15 @@ void PCSX::InterpretedCPU::psxBREAK() {
 }
 
 void PCSX::InterpretedCPU::psxSYSCALL() {
-    PCSX::g_emulator.m_psxCpu->m_psxRegs.pc -= 4;
-    PCSX::g_emulator.m_psxCpu->psxException(0x20, s_branch);
+    PCSX::g_emulator->m_psxCpu->m_psxRegs.pc -= 4;
+    PCSX::g_emulator->m_psxCpu->psxException(0x20, s_branch);
 }
 
 void PCSX::InterpretedCPU::psxRFE() {
     //  PCSX::g_system->printf("psxRFE\n");
-    PCSX::g_emulator.m_psxCpu->m_psxRegs.CP0.n.Status =
-        (PCSX::g_emulator.m_psxCpu->m_psxRegs.CP0.n.Status & 0xfffffff0) |
-        ((PCSX::g_emulator.m_psxCpu->m_psxRegs.CP0.n.Status & 0x3c) >> 2);
+    PCSX::g_emulator->m_psxCpu->m_psxRegs.CP0.n.Status =
+        (PCSX::g_emulator->m_psxCpu->m_psxRegs.CP0.n.Status & 0xfffffff0) |
+        ((PCSX::g_emulator->m_psxCpu->m_psxRegs.CP0.n.Status & 0x3c) >> 2);
 }
 
 /*********************************************************
@@ -791,7 +792,7 @@ void PCSX::InterpretedCPU::psxJAL() {
  *********************************************************/
 void PCSX::InterpretedCPU::psxJR() {
     doBranch(_u32(_rRs_));
-    PCSX::g_emulator.m_psxCpu->psxJumpTest();
+    PCSX::g_emulator->m_psxCpu->psxJumpTest();
 }
 
 void PCSX::InterpretedCPU::psxJALR() {
@@ -813,16 +814,16 @@ void PCSX::InterpretedCPU::psxLB() {
     // load delay = 1 latency
     if (s_branch == 0) {
         // simulate: beq r0,r0,lw+4 / lw / (delay slot)
-        PCSX::g_emulator.m_psxCpu->m_psxRegs.pc -= 4;
-        doBranch(PCSX::g_emulator.m_psxCpu->m_psxRegs.pc + 4);
+        PCSX::g_emulator->m_psxCpu->m_psxRegs.pc -= 4;
+        doBranch(PCSX::g_emulator->m_psxCpu->m_psxRegs.pc + 4);
 
         return;
     }
 
     if (_Rt_) {
-        _i32(_rRt_) = (signed char)PCSX::g_emulator.m_psxMem->psxMemRead8(_oB_);
+        _i32(_rRt_) = (signed char)PCSX::g_emulator->m_psxMem->psxMemRead8(_oB_);
     } else {
-        PCSX::g_emulator.m_psxMem->psxMemRead8(_oB_);
+        PCSX::g_emulator->m_psxMem->psxMemRead8(_oB_);
     }
 }
 
@@ -830,16 +831,16 @@ void PCSX::InterpretedCPU::psxLBU() {
     // load delay = 1 latency
     if (s_branch == 0) {
         // simulate: beq r0,r0,lw+4 / lw / (delay slot)
-        PCSX::g_emulator.m_psxCpu->m_psxRegs.pc -= 4;
-        doBranch(PCSX::g_emulator.m_psxCpu->m_psxRegs.pc + 4);
+        PCSX::g_emulator->m_psxCpu->m_psxRegs.pc -= 4;
+        doBranch(PCSX::g_emulator->m_psxCpu->m_psxRegs.pc + 4);
 
         return;
     }
 
     if (_Rt_) {
-        _u32(_rRt_) = PCSX::g_emulator.m_psxMem->psxMemRead8(_oB_);
+        _u32(_rRt_) = PCSX::g_emulator->m_psxMem->psxMemRead8(_oB_);
     } else {
-        PCSX::g_emulator.m_psxMem->psxMemRead8(_oB_);
+        PCSX::g_emulator->m_psxMem->psxMemRead8(_oB_);
     }
 }
 
@@ -847,16 +848,16 @@ void PCSX::InterpretedCPU::psxLH() {
     // load delay = 1 latency
     if (s_branch == 0) {
         // simulate: beq r0,r0,lw+4 / lw / (delay slot)
-        PCSX::g_emulator.m_psxCpu->m_psxRegs.pc -= 4;
-        doBranch(PCSX::g_emulator.m_psxCpu->m_psxRegs.pc + 4);
+        PCSX::g_emulator->m_psxCpu->m_psxRegs.pc -= 4;
+        doBranch(PCSX::g_emulator->m_psxCpu->m_psxRegs.pc + 4);
 
         return;
     }
 
     if (_Rt_) {
-        _i32(_rRt_) = (short)PCSX::g_emulator.m_psxMem->psxMemRead16(_oB_);
+        _i32(_rRt_) = (short)PCSX::g_emulator->m_psxMem->psxMemRead16(_oB_);
     } else {
-        PCSX::g_emulator.m_psxMem->psxMemRead16(_oB_);
+        PCSX::g_emulator->m_psxMem->psxMemRead16(_oB_);
     }
 }
 
@@ -864,16 +865,16 @@ void PCSX::InterpretedCPU::psxLHU() {
     // load delay = 1 latency
     if (s_branch == 0) {
         // simulate: beq r0,r0,lw+4 / lw / (delay slot)
-        PCSX::g_emulator.m_psxCpu->m_psxRegs.pc -= 4;
-        doBranch(PCSX::g_emulator.m_psxCpu->m_psxRegs.pc + 4);
+        PCSX::g_emulator->m_psxCpu->m_psxRegs.pc -= 4;
+        doBranch(PCSX::g_emulator->m_psxCpu->m_psxRegs.pc + 4);
 
         return;
     }
 
     if (_Rt_) {
-        _u32(_rRt_) = PCSX::g_emulator.m_psxMem->psxMemRead16(_oB_);
+        _u32(_rRt_) = PCSX::g_emulator->m_psxMem->psxMemRead16(_oB_);
     } else {
-        PCSX::g_emulator.m_psxMem->psxMemRead16(_oB_);
+        PCSX::g_emulator->m_psxMem->psxMemRead16(_oB_);
     }
 }
 
@@ -881,29 +882,29 @@ void PCSX::InterpretedCPU::psxLW() {
     // load delay = 1 latency
     if (s_branch == 0) {
         // simulate: beq r0,r0,lw+4 / lw / (delay slot)
-        PCSX::g_emulator.m_psxCpu->m_psxRegs.pc -= 4;
-        doBranch(PCSX::g_emulator.m_psxCpu->m_psxRegs.pc + 4);
+        PCSX::g_emulator->m_psxCpu->m_psxRegs.pc -= 4;
+        doBranch(PCSX::g_emulator->m_psxCpu->m_psxRegs.pc + 4);
 
         return;
     }
 
     if (_Rt_) {
-        _u32(_rRt_) = PCSX::g_emulator.m_psxMem->psxMemRead32(_oB_);
+        _u32(_rRt_) = PCSX::g_emulator->m_psxMem->psxMemRead32(_oB_);
     } else {
-        PCSX::g_emulator.m_psxMem->psxMemRead32(_oB_);
+        PCSX::g_emulator->m_psxMem->psxMemRead32(_oB_);
     }
 }
 
 void PCSX::InterpretedCPU::psxLWL() {
     uint32_t addr = _oB_;
     uint32_t shift = addr & 3;
-    uint32_t mem = PCSX::g_emulator.m_psxMem->psxMemRead32(addr & ~3);
+    uint32_t mem = PCSX::g_emulator->m_psxMem->psxMemRead32(addr & ~3);
 
     // load delay = 1 latency
     if (s_branch == 0) {
         // simulate: beq r0,r0,lw+4 / lw / (delay slot)
-        PCSX::g_emulator.m_psxCpu->m_psxRegs.pc -= 4;
-        doBranch(PCSX::g_emulator.m_psxCpu->m_psxRegs.pc + 4);
+        PCSX::g_emulator->m_psxCpu->m_psxRegs.pc -= 4;
+        doBranch(PCSX::g_emulator->m_psxCpu->m_psxRegs.pc + 4);
 
         return;
     }
@@ -924,13 +925,13 @@ void PCSX::InterpretedCPU::psxLWL() {
 void PCSX::InterpretedCPU::psxLWR() {
     uint32_t addr = _oB_;
     uint32_t shift = addr & 3;
-    uint32_t mem = PCSX::g_emulator.m_psxMem->psxMemRead32(addr & ~3);
+    uint32_t mem = PCSX::g_emulator->m_psxMem->psxMemRead32(addr & ~3);
 
     // load delay = 1 latency
     if (s_branch == 0) {
         // simulate: beq r0,r0,lw+4 / lw / (delay slot)
-        PCSX::g_emulator.m_psxCpu->m_psxRegs.pc -= 4;
-        doBranch(PCSX::g_emulator.m_psxCpu->m_psxRegs.pc + 4);
+        PCSX::g_emulator->m_psxCpu->m_psxRegs.pc -= 4;
+        doBranch(PCSX::g_emulator->m_psxCpu->m_psxRegs.pc + 4);
 
         return;
     }
@@ -948,16 +949,16 @@ void PCSX::InterpretedCPU::psxLWR() {
     */
 }
 
-void PCSX::InterpretedCPU::psxSB() { PCSX::g_emulator.m_psxMem->psxMemWrite8(_oB_, _u8(_rRt_)); }
-void PCSX::InterpretedCPU::psxSH() { PCSX::g_emulator.m_psxMem->psxMemWrite16(_oB_, _u16(_rRt_)); }
-void PCSX::InterpretedCPU::psxSW() { PCSX::g_emulator.m_psxMem->psxMemWrite32(_oB_, _u32(_rRt_)); }
+void PCSX::InterpretedCPU::psxSB() { PCSX::g_emulator->m_psxMem->psxMemWrite8(_oB_, _u8(_rRt_)); }
+void PCSX::InterpretedCPU::psxSH() { PCSX::g_emulator->m_psxMem->psxMemWrite16(_oB_, _u16(_rRt_)); }
+void PCSX::InterpretedCPU::psxSW() { PCSX::g_emulator->m_psxMem->psxMemWrite32(_oB_, _u32(_rRt_)); }
 
 void PCSX::InterpretedCPU::psxSWL() {
     uint32_t addr = _oB_;
     uint32_t shift = addr & 3;
-    uint32_t mem = PCSX::g_emulator.m_psxMem->psxMemRead32(addr & ~3);
+    uint32_t mem = PCSX::g_emulator->m_psxMem->psxMemRead32(addr & ~3);
 
-    PCSX::g_emulator.m_psxMem->psxMemWrite32(addr & ~3,
+    PCSX::g_emulator->m_psxMem->psxMemWrite32(addr & ~3,
                                              (_u32(_rRt_) >> g_SWL_SHIFT[shift]) | (mem & g_SWL_MASK[shift]));
     /*
     Mem = 1234.  Reg = abcd
@@ -972,9 +973,9 @@ void PCSX::InterpretedCPU::psxSWL() {
 void PCSX::InterpretedCPU::psxSWR() {
     uint32_t addr = _oB_;
     uint32_t shift = addr & 3;
-    uint32_t mem = PCSX::g_emulator.m_psxMem->psxMemRead32(addr & ~3);
+    uint32_t mem = PCSX::g_emulator->m_psxMem->psxMemRead32(addr & ~3);
 
-    PCSX::g_emulator.m_psxMem->psxMemWrite32(addr & ~3,
+    PCSX::g_emulator->m_psxMem->psxMemWrite32(addr & ~3,
                                              (_u32(_rRt_) << g_SWR_SHIFT[shift]) | (mem & g_SWR_MASK[shift]));
 
     /*
@@ -995,8 +996,8 @@ void PCSX::InterpretedCPU::psxMFC0() {
     // load delay = 1 latency
     if (s_branch == 0) {
         // simulate: beq r0,r0,lw+4 / lw / (delay slot)
-        PCSX::g_emulator.m_psxCpu->m_psxRegs.pc -= 4;
-        doBranch(PCSX::g_emulator.m_psxCpu->m_psxRegs.pc + 4);
+        PCSX::g_emulator->m_psxCpu->m_psxRegs.pc -= 4;
+        doBranch(PCSX::g_emulator->m_psxCpu->m_psxRegs.pc + 4);
 
         return;
     }
@@ -1010,8 +1011,8 @@ void PCSX::InterpretedCPU::psxCFC0() {
     // load delay = 1 latency
     if (s_branch == 0) {
         // simulate: beq r0,r0,lw+4 / lw / (delay slot)
-        PCSX::g_emulator.m_psxCpu->m_psxRegs.pc -= 4;
-        doBranch(PCSX::g_emulator.m_psxCpu->m_psxRegs.pc + 4);
+        PCSX::g_emulator->m_psxCpu->m_psxRegs.pc -= 4;
+        doBranch(PCSX::g_emulator->m_psxCpu->m_psxRegs.pc + 4);
 
         return;
     }
@@ -1033,17 +1034,17 @@ inline void PCSX::InterpretedCPU::MTC0(int reg, uint32_t val) {
     //  PCSX::g_system->printf("MTC0 %d: %x\n", reg, val);
     switch (reg) {
         case 12:  // Status
-            PCSX::g_emulator.m_psxCpu->m_psxRegs.CP0.r[12] = val;
+            PCSX::g_emulator->m_psxCpu->m_psxRegs.CP0.r[12] = val;
             psxTestSWInts();
             break;
 
         case 13:  // Cause
-            PCSX::g_emulator.m_psxCpu->m_psxRegs.CP0.n.Cause = val & ~(0xfc00);
+            PCSX::g_emulator->m_psxCpu->m_psxRegs.CP0.n.Cause = val & ~(0xfc00);
             psxTestSWInts();
             break;
 
         default:
-            PCSX::g_emulator.m_psxCpu->m_psxRegs.CP0.r[reg] = val;
+            PCSX::g_emulator->m_psxCpu->m_psxRegs.CP0.r[reg] = val;
             break;
     }
 }
@@ -1055,26 +1056,26 @@ void PCSX::InterpretedCPU::psxMFC2() {
     // load delay = 1 latency
     if (s_branch == 0) {
         // simulate: beq r0,r0,lw+4 / lw / (delay slot)
-        PCSX::g_emulator.m_psxCpu->m_psxRegs.pc -= 4;
-        doBranch(PCSX::g_emulator.m_psxCpu->m_psxRegs.pc + 4);
+        PCSX::g_emulator->m_psxCpu->m_psxRegs.pc -= 4;
+        doBranch(PCSX::g_emulator->m_psxCpu->m_psxRegs.pc + 4);
 
         return;
     }
 
-    PCSX::g_emulator.m_gte->MFC2();
+    PCSX::g_emulator->m_gte->MFC2();
 }
 
 void PCSX::InterpretedCPU::psxCFC2() {
     // load delay = 1 latency
     if (s_branch == 0) {
         // simulate: beq r0,r0,lw+4 / lw / (delay slot)
-        PCSX::g_emulator.m_psxCpu->m_psxRegs.pc -= 4;
-        doBranch(PCSX::g_emulator.m_psxCpu->m_psxRegs.pc + 4);
+        PCSX::g_emulator->m_psxCpu->m_psxRegs.pc -= 4;
+        doBranch(PCSX::g_emulator->m_psxCpu->m_psxRegs.pc + 4);
 
         return;
     }
 
-    PCSX::g_emulator.m_gte->CFC2();
+    PCSX::g_emulator->m_gte->CFC2();
 }
 
 /*********************************************************
@@ -1082,7 +1083,7 @@ void PCSX::InterpretedCPU::psxCFC2() {
  * Format:  ?                                             *
  *********************************************************/
 void PCSX::InterpretedCPU::psxNULL() {
-    PSXCPU_LOG("psx: Unimplemented op %x\n", PCSX::g_emulator.m_psxCpu->m_psxRegs.code);
+    PSXCPU_LOG("psx: Unimplemented op %x\n", PCSX::g_emulator->m_psxCpu->m_psxRegs.code);
 }
 
 void PCSX::InterpretedCPU::psxSPECIAL() { (*this.*(s_pPsxSPC[_Funct_]))(); }
@@ -1092,7 +1093,7 @@ void PCSX::InterpretedCPU::psxREGIMM() { (*this.*(s_pPsxREG[_Rt_]))(); }
 void PCSX::InterpretedCPU::psxCOP0() { (*this.*(s_pPsxCP0[_Rs_]))(); }
 
 void PCSX::InterpretedCPU::psxCOP2() {
-    if ((PCSX::g_emulator.m_psxCpu->m_psxRegs.CP0.n.Status & 0x40000000) == 0) return;
+    if ((PCSX::g_emulator->m_psxCpu->m_psxRegs.CP0.n.Status & 0x40000000) == 0) return;
 
     (*this.*(s_pPsxCP2[_Funct_]))();
 }
@@ -1100,7 +1101,7 @@ void PCSX::InterpretedCPU::psxCOP2() {
 void PCSX::InterpretedCPU::psxBASIC() { (*this.*(s_pPsxCP2BSC[_Rs_]))(); }
 
 void PCSX::InterpretedCPU::psxHLE() {
-    uint32_t hleCode = PCSX::g_emulator.m_psxCpu->m_psxRegs.code & 0x03ffffff;
+    uint32_t hleCode = PCSX::g_emulator->m_psxCpu->m_psxRegs.code & 0x03ffffff;
     if (hleCode >= (sizeof(psxHLEt) / sizeof(psxHLEt[0]))) {
         psxNULL();
     } else {
@@ -1218,10 +1219,10 @@ void PCSX::InterpretedCPU::pgxpPsxNULL() {}
 #define PGXP_DBG_OP_E(op)
 #endif
 
-#define PGXP_INT_FUNC(pu, op)                                                                    \
-    void PCSX::InterpretedCPU::pgxpPsx##op() {                                                   \
-        PGXP_PSX_FUNC_OP(pu, op, )(PGXP_DBG_OP_E(op) PCSX::g_emulator.m_psxCpu->m_psxRegs.code); \
-        psx##op();                                                                               \
+#define PGXP_INT_FUNC(pu, op)                                                                     \
+    void PCSX::InterpretedCPU::pgxpPsx##op() {                                                    \
+        PGXP_PSX_FUNC_OP(pu, op, )(PGXP_DBG_OP_E(op) PCSX::g_emulator->m_psxCpu->m_psxRegs.code); \
+        psx##op();                                                                                \
     }
 
 #define PGXP_INT_FUNC_0_1(pu, op, test, nReg, reg1)                        \
@@ -1230,7 +1231,7 @@ void PCSX::InterpretedCPU::pgxpPsxNULL() {}
             psx##op();                                                     \
             return;                                                        \
         }                                                                  \
-        uint32_t tempInstr = PCSX::g_emulator.m_psxCpu->m_psxRegs.code;    \
+        uint32_t tempInstr = PCSX::g_emulator->m_psxCpu->m_psxRegs.code;   \
         psx##op();                                                         \
         PGXP_PSX_FUNC_OP(pu, op, nReg)(PGXP_DBG_OP_E(op) tempInstr, reg1); \
     }
@@ -1251,7 +1252,7 @@ void PCSX::InterpretedCPU::pgxpPsxNULL() {}
             psx##op();                                                            \
             return;                                                               \
         }                                                                         \
-        uint32_t tempInstr = PCSX::g_emulator.m_psxCpu->m_psxRegs.code;           \
+        uint32_t tempInstr = PCSX::g_emulator->m_psxCpu->m_psxRegs.code;          \
         uint32_t temp2 = reg2;                                                    \
         psx##op();                                                                \
         PGXP_PSX_FUNC_OP(pu, op, nReg)(PGXP_DBG_OP_E(op) tempInstr, reg1, temp2); \
@@ -1263,7 +1264,7 @@ void PCSX::InterpretedCPU::pgxpPsxNULL() {}
             psx##op();                                                           \
             return;                                                              \
         }                                                                        \
-        uint32_t tempInstr = PCSX::g_emulator.m_psxCpu->m_psxRegs.code;          \
+        uint32_t tempInstr = PCSX::g_emulator->m_psxCpu->m_psxRegs.code;         \
         psx##op();                                                               \
         PGXP_PSX_FUNC_OP(pu, op, nReg)(PGXP_DBG_OP_E(op) tempInstr, reg1, reg2); \
     }
@@ -1274,7 +1275,7 @@ void PCSX::InterpretedCPU::pgxpPsxNULL() {}
             psx##op();                                                             \
             return;                                                                \
         }                                                                          \
-        uint32_t tempInstr = PCSX::g_emulator.m_psxCpu->m_psxRegs.code;            \
+        uint32_t tempInstr = PCSX::g_emulator->m_psxCpu->m_psxRegs.code;           \
         uint32_t temp1 = reg1;                                                     \
         uint32_t temp2 = reg2;                                                     \
         psx##op();                                                                 \
@@ -1287,7 +1288,7 @@ void PCSX::InterpretedCPU::pgxpPsxNULL() {}
             psx##op();                                                                   \
             return;                                                                      \
         }                                                                                \
-        uint32_t tempInstr = PCSX::g_emulator.m_psxCpu->m_psxRegs.code;                  \
+        uint32_t tempInstr = PCSX::g_emulator->m_psxCpu->m_psxRegs.code;                 \
         uint32_t temp2 = reg2;                                                           \
         uint32_t temp3 = reg3;                                                           \
         psx##op();                                                                       \
@@ -1300,7 +1301,7 @@ void PCSX::InterpretedCPU::pgxpPsxNULL() {}
             psx##op();                                                                         \
             return;                                                                            \
         }                                                                                      \
-        uint32_t tempInstr = PCSX::g_emulator.m_psxCpu->m_psxRegs.code;                        \
+        uint32_t tempInstr = PCSX::g_emulator->m_psxCpu->m_psxRegs.code;                       \
         uint32_t temp3 = reg3;                                                                 \
         uint32_t temp4 = reg4;                                                                 \
         psx##op();                                                                             \
@@ -1308,123 +1309,123 @@ void PCSX::InterpretedCPU::pgxpPsxNULL() {}
     }
 
 // Rt = Rs op imm
-PGXP_INT_FUNC_1_1(CPU, ADDI, !_Rt_, 2, PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.r[_Rt_],
-                  PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.r[_Rs_])
-PGXP_INT_FUNC_1_1(CPU, ADDIU, !_Rt_, 2, PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.r[_Rt_],
-                  PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.r[_Rs_])
-PGXP_INT_FUNC_1_1(CPU, ANDI, !_Rt_, 2, PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.r[_Rt_],
-                  PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.r[_Rs_])
-PGXP_INT_FUNC_1_1(CPU, ORI, !_Rt_, 2, PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.r[_Rt_],
-                  PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.r[_Rs_])
-PGXP_INT_FUNC_1_1(CPU, XORI, !_Rt_, 2, PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.r[_Rt_],
-                  PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.r[_Rs_])
-PGXP_INT_FUNC_1_1(CPU, SLTI, !_Rt_, 2, PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.r[_Rt_],
-                  PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.r[_Rs_])
-PGXP_INT_FUNC_1_1(CPU, SLTIU, !_Rt_, 2, PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.r[_Rt_],
-                  PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.r[_Rs_])
+PGXP_INT_FUNC_1_1(CPU, ADDI, !_Rt_, 2, PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.r[_Rt_],
+                  PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.r[_Rs_])
+PGXP_INT_FUNC_1_1(CPU, ADDIU, !_Rt_, 2, PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.r[_Rt_],
+                  PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.r[_Rs_])
+PGXP_INT_FUNC_1_1(CPU, ANDI, !_Rt_, 2, PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.r[_Rt_],
+                  PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.r[_Rs_])
+PGXP_INT_FUNC_1_1(CPU, ORI, !_Rt_, 2, PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.r[_Rt_],
+                  PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.r[_Rs_])
+PGXP_INT_FUNC_1_1(CPU, XORI, !_Rt_, 2, PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.r[_Rt_],
+                  PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.r[_Rs_])
+PGXP_INT_FUNC_1_1(CPU, SLTI, !_Rt_, 2, PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.r[_Rt_],
+                  PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.r[_Rs_])
+PGXP_INT_FUNC_1_1(CPU, SLTIU, !_Rt_, 2, PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.r[_Rt_],
+                  PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.r[_Rs_])
 
 // Rt = imm
-PGXP_INT_FUNC_0_1(CPU, LUI, !_Rt_, 1, PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.r[_Rt_])
+PGXP_INT_FUNC_0_1(CPU, LUI, !_Rt_, 1, PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.r[_Rt_])
 
 // Rd = Rs op Rt
-PGXP_INT_FUNC_2_1(CPU, ADD, !_Rd_, 3, PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.r[_Rd_],
-                  PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.r[_Rs_], PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.r[_Rt_])
-PGXP_INT_FUNC_2_1(CPU, ADDU, !_Rd_, 3, PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.r[_Rd_],
-                  PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.r[_Rs_], PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.r[_Rt_])
-PGXP_INT_FUNC_2_1(CPU, SUB, !_Rd_, 3, PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.r[_Rd_],
-                  PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.r[_Rs_], PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.r[_Rt_])
-PGXP_INT_FUNC_2_1(CPU, SUBU, !_Rd_, 3, PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.r[_Rd_],
-                  PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.r[_Rs_], PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.r[_Rt_])
-PGXP_INT_FUNC_2_1(CPU, AND, !_Rd_, 3, PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.r[_Rd_],
-                  PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.r[_Rs_], PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.r[_Rt_])
-PGXP_INT_FUNC_2_1(CPU, OR, !_Rd_, 3, PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.r[_Rd_],
-                  PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.r[_Rs_], PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.r[_Rt_])
-PGXP_INT_FUNC_2_1(CPU, XOR, !_Rd_, 3, PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.r[_Rd_],
-                  PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.r[_Rs_], PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.r[_Rt_])
-PGXP_INT_FUNC_2_1(CPU, NOR, !_Rd_, 3, PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.r[_Rd_],
-                  PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.r[_Rs_], PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.r[_Rt_])
-PGXP_INT_FUNC_2_1(CPU, SLT, !_Rd_, 3, PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.r[_Rd_],
-                  PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.r[_Rs_], PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.r[_Rt_])
-PGXP_INT_FUNC_2_1(CPU, SLTU, !_Rd_, 3, PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.r[_Rd_],
-                  PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.r[_Rs_], PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.r[_Rt_])
+PGXP_INT_FUNC_2_1(CPU, ADD, !_Rd_, 3, PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.r[_Rd_],
+                  PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.r[_Rs_], PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.r[_Rt_])
+PGXP_INT_FUNC_2_1(CPU, ADDU, !_Rd_, 3, PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.r[_Rd_],
+                  PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.r[_Rs_], PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.r[_Rt_])
+PGXP_INT_FUNC_2_1(CPU, SUB, !_Rd_, 3, PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.r[_Rd_],
+                  PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.r[_Rs_], PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.r[_Rt_])
+PGXP_INT_FUNC_2_1(CPU, SUBU, !_Rd_, 3, PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.r[_Rd_],
+                  PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.r[_Rs_], PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.r[_Rt_])
+PGXP_INT_FUNC_2_1(CPU, AND, !_Rd_, 3, PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.r[_Rd_],
+                  PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.r[_Rs_], PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.r[_Rt_])
+PGXP_INT_FUNC_2_1(CPU, OR, !_Rd_, 3, PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.r[_Rd_],
+                  PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.r[_Rs_], PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.r[_Rt_])
+PGXP_INT_FUNC_2_1(CPU, XOR, !_Rd_, 3, PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.r[_Rd_],
+                  PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.r[_Rs_], PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.r[_Rt_])
+PGXP_INT_FUNC_2_1(CPU, NOR, !_Rd_, 3, PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.r[_Rd_],
+                  PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.r[_Rs_], PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.r[_Rt_])
+PGXP_INT_FUNC_2_1(CPU, SLT, !_Rd_, 3, PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.r[_Rd_],
+                  PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.r[_Rs_], PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.r[_Rt_])
+PGXP_INT_FUNC_2_1(CPU, SLTU, !_Rd_, 3, PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.r[_Rd_],
+                  PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.r[_Rs_], PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.r[_Rt_])
 
 // Hi/Lo = Rs op Rt
-PGXP_INT_FUNC_2_2(CPU, MULT, 0, 4, PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.n.hi,
-                  PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.n.lo, PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.r[_Rs_],
-                  PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.r[_Rt_])
-PGXP_INT_FUNC_2_2(CPU, MULTU, 0, 4, PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.n.hi,
-                  PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.n.lo, PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.r[_Rs_],
-                  PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.r[_Rt_])
-PGXP_INT_FUNC_2_2(CPU, DIV, 0, 4, PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.n.hi,
-                  PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.n.lo, PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.r[_Rs_],
-                  PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.r[_Rt_])
-PGXP_INT_FUNC_2_2(CPU, DIVU, 0, 4, PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.n.hi,
-                  PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.n.lo, PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.r[_Rs_],
-                  PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.r[_Rt_])
+PGXP_INT_FUNC_2_2(CPU, MULT, 0, 4, PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.n.hi,
+                  PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.n.lo, PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.r[_Rs_],
+                  PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.r[_Rt_])
+PGXP_INT_FUNC_2_2(CPU, MULTU, 0, 4, PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.n.hi,
+                  PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.n.lo, PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.r[_Rs_],
+                  PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.r[_Rt_])
+PGXP_INT_FUNC_2_2(CPU, DIV, 0, 4, PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.n.hi,
+                  PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.n.lo, PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.r[_Rs_],
+                  PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.r[_Rt_])
+PGXP_INT_FUNC_2_2(CPU, DIVU, 0, 4, PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.n.hi,
+                  PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.n.lo, PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.r[_Rs_],
+                  PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.r[_Rt_])
 
 // Mem[addr] = Rt
-PGXP_INT_FUNC_1_1(CPU, SB, 0, 2, PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.r[_Rt_], _oB_)
-PGXP_INT_FUNC_1_1(CPU, SH, 0, 2, PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.r[_Rt_], _oB_)
-PGXP_INT_FUNC_1_1(CPU, SW, 0, 2, PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.r[_Rt_], _oB_)
-PGXP_INT_FUNC_1_1(CPU, SWL, 0, 2, PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.r[_Rt_], _oB_)
-PGXP_INT_FUNC_1_1(CPU, SWR, 0, 2, PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.r[_Rt_], _oB_)
+PGXP_INT_FUNC_1_1(CPU, SB, 0, 2, PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.r[_Rt_], _oB_)
+PGXP_INT_FUNC_1_1(CPU, SH, 0, 2, PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.r[_Rt_], _oB_)
+PGXP_INT_FUNC_1_1(CPU, SW, 0, 2, PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.r[_Rt_], _oB_)
+PGXP_INT_FUNC_1_1(CPU, SWL, 0, 2, PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.r[_Rt_], _oB_)
+PGXP_INT_FUNC_1_1(CPU, SWR, 0, 2, PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.r[_Rt_], _oB_)
 
 // Rt = Mem[addr]
-PGXP_INT_FUNC_1_1(CPU, LWL, 0, 2, PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.r[_Rt_], _oB_)
-PGXP_INT_FUNC_1_1(CPU, LW, 0, 2, PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.r[_Rt_], _oB_)
-PGXP_INT_FUNC_1_1(CPU, LWR, 0, 2, PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.r[_Rt_], _oB_)
-PGXP_INT_FUNC_1_1(CPU, LH, 0, 2, PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.r[_Rt_], _oB_)
-PGXP_INT_FUNC_1_1(CPU, LHU, 0, 2, PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.r[_Rt_], _oB_)
-PGXP_INT_FUNC_1_1(CPU, LB, 0, 2, PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.r[_Rt_], _oB_)
-PGXP_INT_FUNC_1_1(CPU, LBU, 0, 2, PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.r[_Rt_], _oB_)
+PGXP_INT_FUNC_1_1(CPU, LWL, 0, 2, PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.r[_Rt_], _oB_)
+PGXP_INT_FUNC_1_1(CPU, LW, 0, 2, PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.r[_Rt_], _oB_)
+PGXP_INT_FUNC_1_1(CPU, LWR, 0, 2, PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.r[_Rt_], _oB_)
+PGXP_INT_FUNC_1_1(CPU, LH, 0, 2, PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.r[_Rt_], _oB_)
+PGXP_INT_FUNC_1_1(CPU, LHU, 0, 2, PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.r[_Rt_], _oB_)
+PGXP_INT_FUNC_1_1(CPU, LB, 0, 2, PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.r[_Rt_], _oB_)
+PGXP_INT_FUNC_1_1(CPU, LBU, 0, 2, PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.r[_Rt_], _oB_)
 
 // Rd = Rt op Sa
-PGXP_INT_FUNC_1_1(CPU, SLL, !_Rd_, 2, PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.r[_Rd_],
-                  PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.r[_Rt_])
-PGXP_INT_FUNC_1_1(CPU, SRL, !_Rd_, 2, PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.r[_Rd_],
-                  PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.r[_Rt_])
-PGXP_INT_FUNC_1_1(CPU, SRA, !_Rd_, 2, PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.r[_Rd_],
-                  PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.r[_Rt_])
+PGXP_INT_FUNC_1_1(CPU, SLL, !_Rd_, 2, PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.r[_Rd_],
+                  PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.r[_Rt_])
+PGXP_INT_FUNC_1_1(CPU, SRL, !_Rd_, 2, PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.r[_Rd_],
+                  PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.r[_Rt_])
+PGXP_INT_FUNC_1_1(CPU, SRA, !_Rd_, 2, PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.r[_Rd_],
+                  PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.r[_Rt_])
 
 // Rd = Rt op Rs
-PGXP_INT_FUNC_2_1(CPU, SLLV, !_Rd_, 3, PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.r[_Rd_],
-                  PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.r[_Rt_], PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.r[_Rs_])
-PGXP_INT_FUNC_2_1(CPU, SRLV, !_Rd_, 3, PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.r[_Rd_],
-                  PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.r[_Rt_], PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.r[_Rs_])
-PGXP_INT_FUNC_2_1(CPU, SRAV, !_Rd_, 3, PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.r[_Rd_],
-                  PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.r[_Rt_], PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.r[_Rs_])
-
-PGXP_INT_FUNC_1_1(CPU, MFHI, !_Rd_, 2, PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.r[_Rd_],
-                  PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.n.hi)
-PGXP_INT_FUNC_1_1(CPU, MTHI, 0, 2, PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.n.hi,
-                  PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.r[_Rd_])
-PGXP_INT_FUNC_1_1(CPU, MFLO, !_Rd_, 2, PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.r[_Rd_],
-                  PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.n.lo)
-PGXP_INT_FUNC_1_1(CPU, MTLO, 0, 2, PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.n.lo,
-                  PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.r[_Rd_])
+PGXP_INT_FUNC_2_1(CPU, SLLV, !_Rd_, 3, PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.r[_Rd_],
+                  PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.r[_Rt_], PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.r[_Rs_])
+PGXP_INT_FUNC_2_1(CPU, SRLV, !_Rd_, 3, PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.r[_Rd_],
+                  PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.r[_Rt_], PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.r[_Rs_])
+PGXP_INT_FUNC_2_1(CPU, SRAV, !_Rd_, 3, PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.r[_Rd_],
+                  PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.r[_Rt_], PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.r[_Rs_])
+
+PGXP_INT_FUNC_1_1(CPU, MFHI, !_Rd_, 2, PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.r[_Rd_],
+                  PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.n.hi)
+PGXP_INT_FUNC_1_1(CPU, MTHI, 0, 2, PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.n.hi,
+                  PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.r[_Rd_])
+PGXP_INT_FUNC_1_1(CPU, MFLO, !_Rd_, 2, PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.r[_Rd_],
+                  PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.n.lo)
+PGXP_INT_FUNC_1_1(CPU, MTLO, 0, 2, PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.n.lo,
+                  PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.r[_Rd_])
 
 // COP2 (GTE)
-PGXP_INT_FUNC_1_1(GTE, MFC2, !_Rt_, 2, PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.r[_Rt_],
-                  PCSX::g_emulator.m_psxCpu->m_psxRegs.CP2D.r[_Rd_])
-PGXP_INT_FUNC_1_1(GTE, CFC2, !_Rt_, 2, PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.r[_Rt_],
-                  PCSX::g_emulator.m_psxCpu->m_psxRegs.CP2C.r[_Rd_])
-PGXP_INT_FUNC_1_1(GTE, MTC2, 0, 2, PCSX::g_emulator.m_psxCpu->m_psxRegs.CP2D.r[_Rd_],
-                  PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.r[_Rt_])
-PGXP_INT_FUNC_1_1(GTE, CTC2, 0, 2, PCSX::g_emulator.m_psxCpu->m_psxRegs.CP2C.r[_Rd_],
-                  PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.r[_Rt_])
-
-PGXP_INT_FUNC_1_1(GTE, LWC2, 0, 2, PCSX::g_emulator.m_psxCpu->m_psxRegs.CP2D.r[_Rt_], _oB_)
-PGXP_INT_FUNC_1_1(GTE, SWC2, 0, 2, PCSX::g_emulator.m_psxCpu->m_psxRegs.CP2D.r[_Rt_], _oB_)
+PGXP_INT_FUNC_1_1(GTE, MFC2, !_Rt_, 2, PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.r[_Rt_],
+                  PCSX::g_emulator->m_psxCpu->m_psxRegs.CP2D.r[_Rd_])
+PGXP_INT_FUNC_1_1(GTE, CFC2, !_Rt_, 2, PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.r[_Rt_],
+                  PCSX::g_emulator->m_psxCpu->m_psxRegs.CP2C.r[_Rd_])
+PGXP_INT_FUNC_1_1(GTE, MTC2, 0, 2, PCSX::g_emulator->m_psxCpu->m_psxRegs.CP2D.r[_Rd_],
+                  PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.r[_Rt_])
+PGXP_INT_FUNC_1_1(GTE, CTC2, 0, 2, PCSX::g_emulator->m_psxCpu->m_psxRegs.CP2C.r[_Rd_],
+                  PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.r[_Rt_])
+
+PGXP_INT_FUNC_1_1(GTE, LWC2, 0, 2, PCSX::g_emulator->m_psxCpu->m_psxRegs.CP2D.r[_Rt_], _oB_)
+PGXP_INT_FUNC_1_1(GTE, SWC2, 0, 2, PCSX::g_emulator->m_psxCpu->m_psxRegs.CP2D.r[_Rt_], _oB_)
 
 // COP0
-PGXP_INT_FUNC_1_1(CP0, MFC0, !_Rd_, 2, PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.r[_Rt_],
-                  PCSX::g_emulator.m_psxCpu->m_psxRegs.CP0.r[_Rd_])
-PGXP_INT_FUNC_1_1(CP0, CFC0, !_Rd_, 2, PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.r[_Rt_],
-                  PCSX::g_emulator.m_psxCpu->m_psxRegs.CP0.r[_Rd_])
-PGXP_INT_FUNC_1_1(CP0, MTC0, !_Rt_, 2, PCSX::g_emulator.m_psxCpu->m_psxRegs.CP0.r[_Rd_],
-                  PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.r[_Rt_])
-PGXP_INT_FUNC_1_1(CP0, CTC0, !_Rt_, 2, PCSX::g_emulator.m_psxCpu->m_psxRegs.CP0.r[_Rd_],
-                  PCSX::g_emulator.m_psxCpu->m_psxRegs.GPR.r[_Rt_])
+PGXP_INT_FUNC_1_1(CP0, MFC0, !_Rd_, 2, PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.r[_Rt_],
+                  PCSX::g_emulator->m_psxCpu->m_psxRegs.CP0.r[_Rd_])
+PGXP_INT_FUNC_1_1(CP0, CFC0, !_Rd_, 2, PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.r[_Rt_],
+                  PCSX::g_emulator->m_psxCpu->m_psxRegs.CP0.r[_Rd_])
+PGXP_INT_FUNC_1_1(CP0, MTC0, !_Rt_, 2, PCSX::g_emulator->m_psxCpu->m_psxRegs.CP0.r[_Rd_],
+                  PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.r[_Rt_])
+PGXP_INT_FUNC_1_1(CP0, CTC0, !_Rt_, 2, PCSX::g_emulator->m_psxCpu->m_psxRegs.CP0.r[_Rd_],
+                  PCSX::g_emulator->m_psxCpu->m_psxRegs.GPR.r[_Rt_])
 PGXP_INT_FUNC(CP0, RFE)
 
 // end of PGXP
@@ -1577,7 +1578,7 @@ const PCSX::InterpretedCPU::intFunc_t PCSX::InterpretedCPU::s_pgxpPsxBSCMem[64]
 ///////////////////////////////////////////
 
 bool PCSX::InterpretedCPU::Init() { return true; }
-void PCSX::InterpretedCPU::Reset() { PCSX::g_emulator.m_psxCpu->m_psxRegs.ICache_valid = false; }
+void PCSX::InterpretedCPU::Reset() { PCSX::g_emulator->m_psxCpu->m_psxRegs.ICache_valid = false; }
 void PCSX::InterpretedCPU::Execute() {
     while (PCSX::g_system->running()) execI();
 }
@@ -1589,17 +1590,17 @@ void PCSX::InterpretedCPU::Clear(uint32_t Addr, uint32_t Size) {}
 void PCSX::InterpretedCPU::Shutdown() {}
 // interpreter execution
 inline void PCSX::InterpretedCPU::execI() {
-    uint32_t *code = PCSX::g_emulator.m_psxCpu->Read_ICache(PCSX::g_emulator.m_psxCpu->m_psxRegs.pc, false);
-    PCSX::g_emulator.m_psxCpu->m_psxRegs.code = ((code == NULL) ? 0 : SWAP_LE32(*code));
+    uint32_t *code = PCSX::g_emulator->m_psxCpu->Read_ICache(PCSX::g_emulator->m_psxCpu->m_psxRegs.pc, false);
+    PCSX::g_emulator->m_psxCpu->m_psxRegs.code = ((code == NULL) ? 0 : SWAP_LE32(*code));
 
     debugI();
 
-    if (PCSX::g_emulator.settings.get<PCSX::Emulator::SettingDebug>()) PCSX::g_emulator.m_debug->ProcessDebug();
+    if (PCSX::g_emulator->settings.get<PCSX::Emulator::SettingDebug>()) PCSX::g_emulator->m_debug->ProcessDebug();
 
-    PCSX::g_emulator.m_psxCpu->m_psxRegs.pc += 4;
-    PCSX::g_emulator.m_psxCpu->m_psxRegs.cycle += PCSX::Emulator::BIAS;
+    PCSX::g_emulator->m_psxCpu->m_psxRegs.pc += 4;
+    PCSX::g_emulator->m_psxCpu->m_psxRegs.cycle += PCSX::Emulator::BIAS;
 
-    cIntFunc_t func = s_pPsxBSC[PCSX::g_emulator.m_psxCpu->m_psxRegs.code >> 26];
+    cIntFunc_t func = s_pPsxBSC[PCSX::g_emulator->m_psxCpu->m_psxRegs.code >> 26];
     (*this.*func)();
 }
 
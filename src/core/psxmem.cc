@@ -22,10 +22,33 @@
  */
 
 #include "core/psxmem.h"
+
+#include <map>
+#include <mutex>
+
 #include "core/debug.h"
 #include "core/psxhw.h"
 #include "core/r3000a.h"
 
+// BIOS files are read only once per process, however many machines boot from them; each machine
+// still copies the image into its own ROM, which the HLE BIOS and the save states write to.
+static std::shared_ptr<const std::vector<uint8_t>> loadBios(const std::string &path) {
+    static std::mutex lock;
+    static std::map<std::string, std::weak_ptr<const std::vector<uint8_t>>> loaded;
+    std::lock_guard<std::mutex> guard(lock);
+
+    auto bios = loaded[path].lock();
+    if (bios) return bios;
+
+    FILE *f = fopen(path.c_str(), "rb");
+    if (f == NULL) return nullptr;
+    auto data = std::make_shared<std::vector<uint8_t>>(0x80000);
+    data->resize(fread(data->data(), 1, data->size(), f));
+    fclose(f);
+    loaded[path] = data;
+    return data;
+}
+
 int PCSX::Memory::psxMemInit() {
     int i;
 
@@ -69,28 +92,28 @@ int PCSX::Memory::psxMemInit() {
 }
 
 void PCSX::Memory::psxMemReset() {
-    FILE *f = NULL;
     char bios[1024] = {'\0'};
 
     memset(g_psxM, 0, 0x00200000);
     memset(g_psxP, 0, 0x00010000);
 
     // Load BIOS
-    std::filesystem::path biosPath = PCSX::g_emulator.settings.get<PCSX::Emulator::SettingBios>();
+    std::filesystem::path biosPath = PCSX::g_emulator->settings.get<PCSX::Emulator::SettingBios>();
+    m_bios.reset();
     if (biosPath.string() != "HLE") {
-        f = fopen(biosPath.string().c_str(), "rb");
-        if (f == NULL) {
+        m_bios = loadBios(biosPath.string());
+        if (!m_bios) {
             PCSX::g_system->message(_("Could not open BIOS:\"%s\". Enabling HLE Bios!\n"), bios);
             memset(g_psxR, 0, 0x80000);
-            PCSX::g_emulator.settings.get<PCSX::Emulator::SettingHLE>() = true;
+            PCSX::g_emulator->settings.get<PCSX::Emulator::SettingHLE>() = true;
         } else {
-            fread(g_psxR, 1, 0x80000, f);
-            fclose(f);
-            PCSX::g_emulator.settings.get<PCSX::Emulator::SettingHLE>() = false;
+            memset(g_psxR, 0, 0x80000);
+            memcpy(g_psxR, m_bios->data(), m_bios->size());
+            PCSX::g_emulator->settings.get<PCSX::Emulator::SettingHLE>() = false;
             PCSX::g_system->printf(_("Loaded BIOS: %s\n"), bios);
         }
     } else {
-        PCSX::g_emulator.settings.get<PCSX::Emulator::SettingHLE>() = true;
+        PCSX::g_emulator->settings.get<PCSX::Emulator::SettingHLE>() = true;
     }
 }
 
@@ -104,14 +127,12 @@ void PCSX::Memory::psxMemShutdown() {
     free(g_psxMemWLUT);
 }
 
-static int m_writeok = 1;
-
 uint8_t PCSX::Memory::psxMemRead8(uint32_t mem) {
     char *p;
     uint32_t t;
 
-    if (!PCSX::g_emulator.config().MemHack) {
-        PCSX::g_emulator.m_psxCpu->m_psxRegs.cycle += 1;
+    if (!PCSX::g_emulator->config().MemHack) {
+        PCSX::g_emulator->m_psxCpu->m_psxRegs.cycle += 1;
     }
 
     t = mem >> 16;
@@ -119,12 +140,12 @@ uint8_t PCSX::Memory::psxMemRead8(uint32_t mem) {
         if ((mem & 0xffff) < 0x400)
             return psxHu8(mem);
         else
-            return PCSX::g_emulator.m_hw->psxHwRead8(mem);
+            return PCSX::g_emulator->m_hw->psxHwRead8(mem);
     } else {
         p = (char *)(g_psxMemRLUT[t]);
         if (p != NULL) {
-            if (PCSX::g_emulator.settings.get<PCSX::Emulator::SettingDebug>()) {
-                PCSX::g_emulator.m_debug->DebugCheckBP((mem & 0xffffff) | 0x80000000, PCSX::Debug::BR1);
+            if (PCSX::g_emulator->settings.get<PCSX::Emulator::SettingDebug>()) {
+                PCSX::g_emulator->m_debug->DebugCheckBP((mem & 0xffffff) | 0x80000000, PCSX::Debug::BR1);
             }
             return *(uint8_t *)(p + (mem & 0xffff));
         } else {
@@ -138,8 +159,8 @@ uint16_t PCSX::Memory::psxMemRead16(uint32_t mem) {
     char *p;
     uint32_t t;
 
-    if (!PCSX::g_emulator.config().MemHack) {
-        PCSX::g_emulator.m_psxCpu->m_psxRegs.cycle += 1;
+    if (!PCSX::g_emulator->config().MemHack) {
+        PCSX::g_emulator->m_psxCpu->m_psxRegs.cycle += 1;
     }
 
     t = mem >> 16;
@@ -147,12 +168,12 @@ uint16_t PCSX::Memory::psxMemRead16(uint32_t mem) {
         if ((mem & 0xffff) < 0x400)
             return psxHu16(mem);
         else
-            return PCSX::g_emulator.m_hw->psxHwRead16(mem);
+            return PCSX::g_emulator->m_hw->psxHwRead16(mem);
     } else {
         p = (char *)(g_psxMemRLUT[t]);
         if (p != NULL) {
-            if (PCSX::g_emulator.settings.get<PCSX::Emulator::SettingDebug>()) {
-                PCSX::g_emulator.m_debug->DebugCheckBP((mem & 0xffffff) | 0x80000000, PCSX::Debug::BR2);
+            if (PCSX::g_emulator->settings.get<PCSX::Emulator::SettingDebug>()) {
+                PCSX::g_emulator->m_debug->DebugCheckBP((mem & 0xffffff) | 0x80000000, PCSX::Debug::BR2);
             }
             return SWAP_LEu16(*(uint16_t *)(p + (mem & 0xffff)));
         } else {
@@ -166,8 +187,8 @@ uint32_t PCSX::Memory::psxMemRead32(uint32_t mem) {
     char *p;
     uint32_t t;
 
-    if (!PCSX::g_emulator.config().MemHack) {
-        PCSX::g_emulator.m_psxCpu->m_psxRegs.cycle += 1;
+    if (!PCSX::g_emulator->config().MemHack) {
+        PCSX::g_emulator->m_psxCpu->m_psxRegs.cycle += 1;
     }
 
     t = mem >> 16;
@@ -175,12 +196,12 @@ uint32_t PCSX::Memory::psxMemRead32(uint32_t mem) {
         if ((mem & 0xffff) < 0x400)
             return psxHu32(mem);
         else
-            return PCSX::g_emulator.m_hw->psxHwRead32(mem);
+            return PCSX::g_emulator->m_hw->psxHwRead32(mem);
     } else {
         p = (char *)(g_psxMemRLUT[t]);
         if (p != NULL) {
-            if (PCSX::g_emulator.settings.get<PCSX::Emulator::SettingDebug>()) {
-                PCSX::g_emulator.m_debug->DebugCheckBP((mem & 0xffffff) | 0x80000000, PCSX::Debug::BR4);
+            if (PCSX::g_emulator->settings.get<PCSX::Emulator::SettingDebug>()) {
+                PCSX::g_emulator->m_debug->DebugCheckBP((mem & 0xffffff) | 0x80000000, PCSX::Debug::BR4);
             }
             return SWAP_LEu32(*(uint32_t *)(p + (mem & 0xffff)));
         } else {
@@ -196,8 +217,8 @@ void PCSX::Memory::psxMemWrite8(uint32_t mem, uint8_t value) {
     char *p;
     uint32_t t;
 
-    if (!PCSX::g_emulator.config().MemHack) {
-        PCSX::g_emulator.m_psxCpu->m_psxRegs.cycle += 1;
+    if (!PCSX::g_emulator->config().MemHack) {
+        PCSX::g_emulator->m_psxCpu->m_psxRegs.cycle += 1;
     }
 
     t = mem >> 16;
@@ -205,15 +226,15 @@ void PCSX::Memory::psxMemWrite8(uint32_t mem, uint8_t value) {
         if ((mem & 0xffff) < 0x400)
             psxHu8(mem) = value;
         else
-            PCSX::g_emulator.m_hw->psxHwWrite8(mem, value);
+            PCSX::g_emulator->m_hw->psxHwWrite8(mem, value);
     } else {
         p = (char *)(g_psxMemWLUT[t]);
         if (p != NULL) {
-            if (PCSX::g_emulator.settings.get<PCSX::Emulator::SettingDebug>()) {
-                PCSX::g_emulator.m_debug->DebugCheckBP((mem & 0xffffff) | 0x80000000, PCSX::Debug::BW1);
+            if (PCSX::g_emulator->settings.get<PCSX::Emulator::SettingDebug>()) {
+                PCSX::g_emulator->m_debug->DebugCheckBP((mem & 0xffffff) | 0x80000000, PCSX::Debug::BW1);
             }
             *(uint8_t *)(p + (mem & 0xffff)) = value;
-            PCSX::g_emulator.m_psxCpu->Clear((mem & (~3)), 1);
+            PCSX::g_emulator->m_psxCpu->Clear((mem & (~3)), 1);
         } else {
             PSXMEM_LOG("err sb %8.8lx\n", mem);
         }
@@ -224,8 +245,8 @@ void PCSX::Memory::psxMemWrite16(uint32_t mem, uint16_t value) {
     char *p;
     uint32_t t;
 
-    if (!PCSX::g_emulator.config().MemHack) {
-        PCSX::g_emulator.m_psxCpu->m_psxRegs.cycle += 1;
+    if (!PCSX::g_emulator->config().MemHack) {
+        PCSX::g_emulator->m_psxCpu->m_psxRegs.cycle += 1;
     }
 
     t = mem >> 16;
@@ -233,15 +254,15 @@ void PCSX::Memory::psxMemWrite16(uint32_t mem, uint16_t value) {
         if ((mem & 0xffff) < 0x400)
             psxHu16ref(mem) = SWAP_LEu16(value);
         else
-            PCSX::g_emulator.m_hw->psxHwWrite16(mem, value);
+            PCSX::g_emulator->m_hw->psxHwWrite16(mem, value);
     } else {
         p = (char *)(g_psxMemWLUT[t]);
         if (p != NULL) {
-            if (PCSX::g_emulator.settings.get<PCSX::Emulator::SettingDebug>()) {
-                PCSX::g_emulator.m_debug->DebugCheckBP((mem & 0xffffff) | 0x80000000, PCSX::Debug::BW2);
+            if (PCSX::g_emulator->settings.get<PCSX::Emulator::SettingDebug>()) {
+                PCSX::g_emulator->m_debug->DebugCheckBP((mem & 0xffffff) | 0x80000000, PCSX::Debug::BW2);
             }
             *(uint16_t *)(p + (mem & 0xffff)) = SWAP_LEu16(value);
-            PCSX::g_emulator.m_psxCpu->Clear((mem & (~3)), 1);
+            PCSX::g_emulator->m_psxCpu->Clear((mem & (~3)), 1);
         } else {
             PSXMEM_LOG("err sh %8.8lx\n", mem);
         }
@@ -252,8 +273,8 @@ void PCSX::Memory::psxMemWrite32(uint32_t mem, uint32_t value) {
     char *p;
     uint32_t t;
 
-    if (!PCSX::g_emulator.config().MemHack) {
-        PCSX::g_emulator.m_psxCpu->m_psxRegs.cycle += 1;
+    if (!PCSX::g_emulator->config().MemHack) {
+        PCSX::g_emulator->m_psxCpu->m_psxRegs.cycle += 1;
     }
 
     //  if ((mem&0x1fffff) == 0x71E18 || value == 0x48088800) PCSX::g_system->printf("t2fix!!\n");
@@ -262,18 +283,18 @@ void PCSX::Memory::psxMemWrite32(uint32_t mem, uint32_t value) {
         if ((mem & 0xffff) < 0x400)
             psxHu32ref(mem) = SWAP_LEu32(value);
         else
-            PCSX::g_emulator.m_hw->psxHwWrite32(mem, value);
+            PCSX::g_emulator->m_hw->psxHwWrite32(mem, value);
     } else {
         p = (char *)(g_psxMemWLUT[t]);
         if (p != NULL) {
-            if (PCSX::g_emulator.settings.get<PCSX::Emulator::SettingDebug>()) {
-                PCSX::g_emulator.m_debug->DebugCheckBP((mem & 0xffffff) | 0x80000000, PCSX::Debug::BW4);
+            if (PCSX::g_emulator->settings.get<PCSX::Emulator::SettingDebug>()) {
+                PCSX::g_emulator->m_debug->DebugCheckBP((mem & 0xffffff) | 0x80000000, PCSX::Debug::BW4);
             }
             *(uint32_t *)(p + (mem & 0xffff)) = SWAP_LEu32(value);
-            PCSX::g_emulator.m_psxCpu->Clear(mem, 1);
+            PCSX::g_emulator->m_psxCpu->Clear(mem, 1);
         } else {
             if (mem != 0xfffe0130) {
-                if (!m_writeok) PCSX::g_emulator.m_psxCpu->Clear(mem, 1);
+                if (!m_writeok) PCSX::g_emulator->m_psxCpu->Clear(mem, 1);
 
                 if (m_writeok) {
                     PSXMEM_LOG("err sw %8.8lx\n", mem);
@@ -291,7 +312,7 @@ void PCSX::Memory::psxMemWrite32(uint32_t mem, uint32_t value) {
                         memset(g_psxMemWLUT + 0x8000, 0, 0x80 * sizeof(void *));
                         memset(g_psxMemWLUT + 0xa000, 0, 0x80 * sizeof(void *));
 
-                        PCSX::g_emulator.m_psxCpu->m_psxRegs.ICache_valid = false;
+                        PCSX::g_emulator->m_psxCpu->m_psxRegs.ICache_valid = false;
                         break;
                     case 0x00:
                     case 0x1e988:
@@ -32,18 +32,18 @@
 int PCSX::R3000Acpu::psxInit() {
     g_system->printf(_("Running PCSXR Version %s (%s).\n"), PACKAGE_VERSION, __DATE__);
 
-    if (g_emulator.config().Cpu == Emulator::CPU_DYNAREC) {
-        g_emulator.m_psxCpu = Cpus::DynaRec();
+    if (g_emulator->config().Cpu == Emulator::CPU_DYNAREC) {
+        g_emulator->m_psxCpu = Cpus::DynaRec();
     }
 
-    if (!g_emulator.m_psxCpu) {
-        g_emulator.m_psxCpu = Cpus::Interpreted();
+    if (!g_emulator->m_psxCpu) {
+        g_emulator->m_psxCpu = Cpus::Interpreted();
     }
 
     PGXP_Init();
-    PCSX::g_emulator.m_debug->PauseDebugger();
+    PCSX::g_emulator->m_debug->PauseDebugger();
 
-    return g_emulator.m_psxCpu->Init();
+    return g_emulator->m_psxCpu->Init();
 }
 
 void PCSX::R3000Acpu::psxReset() {
@@ -56,16 +56,19 @@ void PCSX::R3000Acpu::psxReset() {
     m_psxRegs.CP0.r[12] = 0x10900000;  // COP0 enabled | BEV = 1 | TS = 1
     m_psxRegs.CP0.r[15] = 0x00000002;  // PRevID = Revision ID, same as R3000A
 
-    PCSX::g_emulator.m_hw->psxHwReset();
-    PCSX::g_emulator.m_psxBios->psxBiosInit();
+    // drops the precision memory pages allocated since
+    PGXP_Init();
+
+    PCSX::g_emulator->m_hw->psxHwReset();
+    PCSX::g_emulator->m_psxBios->psxBiosInit();
 
-    if (!PCSX::g_emulator.settings.get<PCSX::Emulator::SettingHLE>()) psxExecuteBios();
+    if (!PCSX::g_emulator->settings.get<PCSX::Emulator::SettingHLE>()) psxExecuteBios();
 
     EMU_LOG("*BIOS END*\n");
 }
 
 void PCSX::R3000Acpu::psxShutdown() {
-    PCSX::g_emulator.m_psxBios->psxBiosShutdown();
+    PCSX::g_emulator->m_psxBios->psxBiosShutdown();
 
     Shutdown();
 }
@@ -91,7 +94,7 @@ void PCSX::R3000Acpu::psxException(uint32_t code, uint32_t bd) {
     // Set the Status
     m_psxRegs.CP0.n.Status = (m_psxRegs.CP0.n.Status & ~0x3f) | ((m_psxRegs.CP0.n.Status & 0xf) << 2);
 
-    if (PCSX::g_emulator.settings.get<PCSX::Emulator::SettingHLE>()) PCSX::g_emulator.m_psxBios->psxBiosException();
+    if (PCSX::g_emulator->settings.get<PCSX::Emulator::SettingHLE>()) PCSX::g_emulator->m_psxBios->psxBiosException();
 }
 
 void PCSX::R3000Acpu::psxBranchTest() {
@@ -118,7 +121,7 @@ void PCSX::R3000Acpu::psxBranchTest() {
         if( init == 0 ) {
             // 10 apu cycles
             // - Final Fantasy Tactics (distorted - dropped sound effects)
-            m_psxRegs.intCycle[PSXINT_SPUASYNC].cycle = g_emulator.m_psxClockSpeed / 44100 * 10;
+            m_psxRegs.intCycle[PSXINT_SPUASYNC].cycle = g_emulator->m_psxClockSpeed / 44100 * 10;
 
             init = 1;
         }
@@ -132,29 +135,29 @@ void PCSX::R3000Acpu::psxBranchTest() {
     }
 #endif
 
-    if ((m_psxRegs.cycle - PCSX::g_emulator.m_psxCounters->m_psxNextsCounter) >=
-        PCSX::g_emulator.m_psxCounters->m_psxNextCounter)
-        PCSX::g_emulator.m_psxCounters->psxRcntUpdate();
+    if ((m_psxRegs.cycle - PCSX::g_emulator->m_psxCounters->m_psxNextsCounter) >=
+        PCSX::g_emulator->m_psxCounters->m_psxNextCounter)
+        PCSX::g_emulator->m_psxCounters->psxRcntUpdate();
 
     if (m_psxRegs.interrupt) {
         if ((m_psxRegs.interrupt & (1 << PSXINT_SIO)) &&
-            !PCSX::g_emulator.settings.get<PCSX::Emulator::SettingSioIrq>()) {  // sio
+            !PCSX::g_emulator->settings.get<PCSX::Emulator::SettingSioIrq>()) {  // sio
             if ((m_psxRegs.cycle - m_psxRegs.intCycle[PSXINT_SIO].sCycle) >= m_psxRegs.intCycle[PSXINT_SIO].cycle) {
                 m_psxRegs.interrupt &= ~(1 << PSXINT_SIO);
-                PCSX::g_emulator.m_sio->sioInterrupt();
+                PCSX::g_emulator->m_sio->sioInterrupt();
             }
         }
         if (m_psxRegs.interrupt & (1 << PSXINT_CDR)) {  // cdr
             if ((m_psxRegs.cycle - m_psxRegs.intCycle[PSXINT_CDR].sCycle) >= m_psxRegs.intCycle[PSXINT_CDR].cycle) {
                 m_psxRegs.interrupt &= ~(1 << PSXINT_CDR);
-                PCSX::g_emulator.m_cdrom->interrupt();
+                PCSX::g_emulator->m_cdrom->interrupt();
             }
         }
         if (m_psxRegs.interrupt & (1 << PSXINT_CDREAD)) {  // cdr read
             if ((m_psxRegs.cycle - m_psxRegs.intCycle[PSXINT_CDREAD].sCycle) >=
                 m_psxRegs.intCycle[PSXINT_CDREAD].cycle) {
                 m_psxRegs.interrupt &= ~(1 << PSXINT_CDREAD);
-                PCSX::g_emulator.m_cdrom->readInterrupt();
+                PCSX::g_emulator->m_cdrom->readInterrupt();
             }
         }
         if (m_psxRegs.interrupt & (1 << PSXINT_GPUDMA)) {  // gpu dma
@@ -168,7 +171,7 @@ void PCSX::R3000Acpu::psxBranchTest() {
             if ((m_psxRegs.cycle - m_psxRegs.intCycle[PSXINT_MDECOUTDMA].sCycle) >=
                 m_psxRegs.intCycle[PSXINT_MDECOUTDMA].cycle) {
                 m_psxRegs.interrupt &= ~(1 << PSXINT_MDECOUTDMA);
-                PCSX::g_emulator.m_mdec->mdec1Interrupt();
+                PCSX::g_emulator->m_mdec->mdec1Interrupt();
             }
         }
         if (m_psxRegs.interrupt & (1 << PSXINT_SPUDMA)) {  // spu dma
@@ -182,7 +185,7 @@ void PCSX::R3000Acpu::psxBranchTest() {
             if ((m_psxRegs.cycle - m_psxRegs.intCycle[PSXINT_MDECINDMA].sCycle) >=
                 m_psxRegs.intCycle[PSXINT_MDECINDMA].cycle) {
                 m_psxRegs.interrupt &= ~(1 << PSXINT_MDECINDMA);
-                PCSX::g_emulator.m_mdec->mdec0Interrupt();
+                PCSX::g_emulator->m_mdec->mdec0Interrupt();
             }
         }
 
@@ -198,7 +201,7 @@ void PCSX::R3000Acpu::psxBranchTest() {
             if ((m_psxRegs.cycle - m_psxRegs.intCycle[PSXINT_CDRDMA].sCycle) >=
                 m_psxRegs.intCycle[PSXINT_CDRDMA].cycle) {
                 m_psxRegs.interrupt &= ~(1 << PSXINT_CDRDMA);
-                PCSX::g_emulator.m_cdrom->dmaInterrupt();
+                PCSX::g_emulator->m_cdrom->dmaInterrupt();
             }
         }
 
@@ -206,7 +209,7 @@ void PCSX::R3000Acpu::psxBranchTest() {
             if ((m_psxRegs.cycle - m_psxRegs.intCycle[PSXINT_CDRPLAY].sCycle) >=
                 m_psxRegs.intCycle[PSXINT_CDRPLAY].cycle) {
                 m_psxRegs.interrupt &= ~(1 << PSXINT_CDRPLAY);
-                PCSX::g_emulator.m_cdrom->playInterrupt();
+                PCSX::g_emulator->m_cdrom->playInterrupt();
             }
         }
 
@@ -214,7 +217,7 @@ void PCSX::R3000Acpu::psxBranchTest() {
             if ((m_psxRegs.cycle - m_psxRegs.intCycle[PSXINT_CDRDBUF].sCycle) >=
                 m_psxRegs.intCycle[PSXINT_CDRDBUF].cycle) {
                 m_psxRegs.interrupt &= ~(1 << PSXINT_CDRDBUF);
-                PCSX::g_emulator.m_cdrom->decodedBufferInterrupt();
+                PCSX::g_emulator->m_cdrom->decodedBufferInterrupt();
             }
         }
 
@@ -222,31 +225,31 @@ void PCSX::R3000Acpu::psxBranchTest() {
             if ((m_psxRegs.cycle - m_psxRegs.intCycle[PSXINT_CDRLID].sCycle) >=
                 m_psxRegs.intCycle[PSXINT_CDRLID].cycle) {
                 m_psxRegs.interrupt &= ~(1 << PSXINT_CDRLID);
-                PCSX::g_emulator.m_cdrom->lidSeekInterrupt();
+                PCSX::g_emulator->m_cdrom->lidSeekInterrupt();
             }
         }
     }
 }
 
 void PCSX::R3000Acpu::psxJumpTest() {
-    if (!PCSX::g_emulator.settings.get<PCSX::Emulator::SettingHLE>() &&
-        PCSX::g_emulator.settings.get<PCSX::Emulator::SettingVerbose>()) {
+    if (!PCSX::g_emulator->settings.get<PCSX::Emulator::SettingHLE>() &&
+        PCSX::g_emulator->settings.get<PCSX::Emulator::SettingVerbose>()) {
         uint32_t call = m_psxRegs.GPR.n.t1 & 0xff;
         switch (m_psxRegs.pc & 0x1fffff) {
             case 0xa0:
-                if (PCSX::g_emulator.m_psxBios->callA0(call)) break;
+                if (PCSX::g_emulator->m_psxBios->callA0(call)) break;
                 if (call == 0x28 || call == 0xe) break;
                 PSXBIOS_LOG("Bios call a0: %s (%x) %x,%x,%x,%x\n", PCSX::Bios::A0names[call], call, m_psxRegs.GPR.n.a0,
                             m_psxRegs.GPR.n.a1, m_psxRegs.GPR.n.a2, m_psxRegs.GPR.n.a3);
                 break;
             case 0xb0:
-                if (PCSX::g_emulator.m_psxBios->callB0(call)) break;
+                if (PCSX::g_emulator->m_psxBios->callB0(call)) break;
                 if (call == 0x17 || call == 0xb) break;
                 PSXBIOS_LOG("Bios call b0: %s (%x) %x,%x,%x,%x\n", PCSX::Bios::B0names[call], call, m_psxRegs.GPR.n.a0,
                             m_psxRegs.GPR.n.a1, m_psxRegs.GPR.n.a2, m_psxRegs.GPR.n.a3);
                 break;
             case 0xc0:
-                if (PCSX::g_emulator.m_psxBios->callC0(call)) break;
+                if (PCSX::g_emulator->m_psxBios->callC0(call)) break;
                 PSXBIOS_LOG("Bios call c0: %s (%x) %x,%x,%x,%x\n", PCSX::Bios::C0names[call], call, m_psxRegs.GPR.n.a0,
                             m_psxRegs.GPR.n.a1, m_psxRegs.GPR.n.a2, m_psxRegs.GPR.n.a3);
                 break;
@@ -260,7 +263,7 @@ void PCSX::R3000Acpu::psxExecuteBios() {
 
 void PCSX::R3000Acpu::psxSetPGXPMode(uint32_t pgxpMode) {
     SetPGXPMode(pgxpMode);
-    // g_emulator.m_psxCpu->Reset();
+    // g_emulator->m_psxCpu->Reset();
 }
 
 std::unique_ptr<PCSX::R3000Acpu> PCSX::Cpus::Interpreted() {
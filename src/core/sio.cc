@@ -30,37 +30,37 @@
 
 #if 0
 // Breaks Twisted Metal 2 intro
-#define SIO_INT(eCycle)                                                                     \
-    {                                                                                       \
-        if (!PCSX::g_emulator.config().SioIrq) {                                            \
-            PCSX::g_emulator.m_psxCpu->m_psxRegs.interrupt |= (1 << PCSX::PSXINT_SIO);      \
-            PCSX::g_emulator.m_psxCpu->m_psxRegs.intCycle[PCSX::PSXINT_SIO].cycle = eCycle; \
-            PCSX::g_emulator.m_psxCpu->m_psxRegs.intCycle[PCSX::PSXINT_SIO].sCycle =        \
-                PCSX::g_emulator.m_psxCpu->m_psxRegs.cycle;                                 \
-        }                                                                                   \
-                                                                                            \
-        s_statReg &= ~RX_RDY;                                                               \
-        s_statReg &= ~TX_RDY;                                                               \
+#define SIO_INT(eCycle)                                                                      \
+    {                                                                                        \
+        if (!PCSX::g_emulator->config().SioIrq) {                                            \
+            PCSX::g_emulator->m_psxCpu->m_psxRegs.interrupt |= (1 << PCSX::PSXINT_SIO);      \
+            PCSX::g_emulator->m_psxCpu->m_psxRegs.intCycle[PCSX::PSXINT_SIO].cycle = eCycle; \
+            PCSX::g_emulator->m_psxCpu->m_psxRegs.intCycle[PCSX::PSXINT_SIO].sCycle =        \
+                PCSX::g_emulator->m_psxCpu->m_psxRegs.cycle;                                 \
+        }                                                                                    \
+                                                                                             \
+        s_statReg &= ~RX_RDY;                                                                \
+        s_statReg &= ~TX_RDY;                                                                \
     }
 #endif
 
-#define SIO_INT(eCycle)                                                                     \
-    {                                                                                       \
-        if (!PCSX::g_emulator.settings.get<PCSX::Emulator::SettingSioIrq>()) {                                            \
-            PCSX::g_emulator.m_psxCpu->m_psxRegs.interrupt |= (1 << PCSX::PSXINT_SIO);      \
-            PCSX::g_emulator.m_psxCpu->m_psxRegs.intCycle[PCSX::PSXINT_SIO].cycle = eCycle; \
-            PCSX::g_emulator.m_psxCpu->m_psxRegs.intCycle[PCSX::PSXINT_SIO].sCycle =        \
-                PCSX::g_emulator.m_psxCpu->m_psxRegs.cycle;                                 \
-        }                                                                                   \
+#define SIO_INT(eCycle)                                                                      \
+    {                                                                                        \
+        if (!PCSX::g_emulator->settings.get<PCSX::Emulator::SettingSioIrq>()) {              \
+            PCSX::g_emulator->m_psxCpu->m_psxRegs.interrupt |= (1 << PCSX::PSXINT_SIO);      \
+            PCSX::g_emulator->m_psxCpu->m_psxRegs.intCycle[PCSX::PSXINT_SIO].cycle = eCycle; \
+            PCSX::g_emulator->m_psxCpu->m_psxRegs.intCycle[PCSX::PSXINT_SIO].sCycle =        \
+                PCSX::g_emulator->m_psxCpu->m_psxRegs.cycle;                                 \
+        }                                                                                    \
     }
 
 // clk cycle byte
-// 4us * 8bits = (PCSX::g_emulator.m_psxClockSpeed / 1000000) * 32; (linuzappz)
+// 4us * 8bits = (PCSX::g_emulator->m_psxClockSpeed / 1000000) * 32; (linuzappz)
 // TODO: add SioModePrescaler
 #define SIO_CYCLES (s_baudReg * 8)
 
 // rely on this for now - someone's actual testing
-//#define SIO_CYCLES (PCSX::g_emulator.m_psxClockSpeed / 57600)
+//#define SIO_CYCLES (PCSX::g_emulator->m_psxClockSpeed / 57600)
 // PCSX 1.9.91
 //#define SIO_CYCLES 200
 // PCSX 1.9.91
@@ -103,13 +103,13 @@ void PCSX::SIO::sioWrite8(uint8_t value) {
             if ((value & 0x40) == 0x40) {
                 s_padst = 2;
                 s_parp = 1;
-                if (!PCSX::g_emulator.config().UseNet) {
+                if (!PCSX::g_emulator->config().UseNet) {
                     switch (s_ctrlReg & 0x2002) {
                         case 0x0002:
-                            s_buf[s_parp] = PCSX::g_emulator.m_pad1->poll(value);
+                            s_buf[s_parp] = PCSX::g_emulator->m_pad1->poll(value);
                             break;
                         case 0x2002:
-                            s_buf[s_parp] = PCSX::g_emulator.m_pad2->poll(value);
+                            s_buf[s_parp] = PCSX::g_emulator->m_pad2->poll(value);
                             break;
                     }
                 } /* else {
@@ -162,13 +162,13 @@ s_buf[5]);
                                             SIO_INT(SIO_CYCLES);
                                             return;
                                     }*/
-            if (!PCSX::g_emulator.config().UseNet) {
+            if (!PCSX::g_emulator->config().UseNet) {
                 switch (s_ctrlReg & 0x2002) {
                     case 0x0002:
-                        s_buf[s_parp] = PCSX::g_emulator.m_pad1->poll(value);
+                        s_buf[s_parp] = PCSX::g_emulator->m_pad1->poll(value);
                         break;
                     case 0x2002:
-                        s_buf[s_parp] = PCSX::g_emulator.m_pad2->poll(value);
+                        s_buf[s_parp] = PCSX::g_emulator->m_pad2->poll(value);
                         break;
                 }
             }
@@ -562,32 +562,32 @@ s_buf[5]);
         case 0x01:                // start pad
             s_statReg |= RX_RDY;  // Transfer is Ready
 
-            if (!PCSX::g_emulator.config().UseNet) {
+            if (!PCSX::g_emulator->config().UseNet) {
                 switch (s_ctrlReg & 0x2002) {
                     case 0x0002:
-                        s_buf[0] = PCSX::g_emulator.m_pad1->startPoll();
+                        s_buf[0] = PCSX::g_emulator->m_pad1->startPoll();
                         break;
                     case 0x2002:
-                        s_buf[0] = PCSX::g_emulator.m_pad2->startPoll();
+                        s_buf[0] = PCSX::g_emulator->m_pad2->startPoll();
                         break;
                 }
             } else {
                 if ((s_ctrlReg & 0x2002) == 0x0002) {
                     int i, j;
 
-                    PCSX::g_emulator.m_pad1->startPoll();
+                    PCSX::g_emulator->m_pad1->startPoll();
                     s_buf[0] = 0;
-                    s_buf[1] = PCSX::g_emulator.m_pad1->poll(0x42);
+                    s_buf[1] = PCSX::g_emulator->m_pad1->poll(0x42);
                     if (!(s_buf[1] & 0x0f)) {
                         s_bufcount = 32;
                     } else {
                         s_bufcount = (s_buf[1] & 0x0f) * 2;
                     }
-                    s_buf[2] = PCSX::g_emulator.m_pad1->poll(0);
+                    s_buf[2] = PCSX::g_emulator->m_pad1->poll(0);
                     i = 3;
                     j = s_bufcount;
                     while (j--) {
-                        s_buf[i++] = PCSX::g_emulator.m_pad1->poll(0);
+                        s_buf[i++] = PCSX::g_emulator->m_pad1->poll(0);
                     }
                     s_bufcount += 3;
 
@@ -610,15 +610,15 @@ s_buf[5]);
             s_statReg |= RX_RDY;
 
             // Chronicles of the Sword - no memcard = password options
-            if (PCSX::g_emulator.config().NoMemcard ||
-                (!PCSX::g_emulator.settings.get<PCSX::Emulator::SettingMcd1>().c_str()[0] &&
-                 !PCSX::g_emulator.settings.get<PCSX::Emulator::SettingMcd2>().c_str()[0])) {
+            if (PCSX::g_emulator->config().NoMemcard ||
+                (!PCSX::g_emulator->settings.get<PCSX::Emulator::SettingMcd1>().c_str()[0] &&
+                 !PCSX::g_emulator->settings.get<PCSX::Emulator::SettingMcd2>().c_str()[0])) {
                 memset(s_buf, 0x00, 4);
             } else {
                 memcpy(s_buf, s_cardh, 4);
-                if (!PCSX::g_emulator.settings.get<PCSX::Emulator::SettingMcd2>().c_str()[0])
+                if (!PCSX::g_emulator->settings.get<PCSX::Emulator::SettingMcd2>().c_str()[0])
                     s_buf[2] = 0;  // is card 1 plugged? (Codename Tenka)
-                if (!PCSX::g_emulator.settings.get<PCSX::Emulator::SettingMcd2>().c_str()[0])
+                if (!PCSX::g_emulator->settings.get<PCSX::Emulator::SettingMcd2>().c_str()[0])
                     s_buf[3] = 0;  // is card 2 plugged?
             }
 
@@ -663,7 +663,7 @@ void PCSX::SIO::sioWriteCtrl16(uint16_t value) {
         s_mcdst = 0;
         s_parp = 0;
         s_statReg = TX_RDY | TX_EMPTY;
-        PCSX::g_emulator.m_psxCpu->m_psxRegs.interrupt &= ~(1 << PCSX::PSXINT_SIO);
+        PCSX::g_emulator->m_psxCpu->m_psxRegs.interrupt &= ~(1 << PCSX::PSXINT_SIO);
     }
 }
 
@@ -683,13 +683,13 @@ uint8_t PCSX::SIO::sioRead8() {
                     switch (s_ctrlReg & 0x2002) {
                         case 0x0002:
                             memcpy(g_mcd1Data + (s_adrL | (s_adrH << 8)) * 128, &s_buf[1], 128);
-                            SaveMcd(PCSX::g_emulator.settings.get<PCSX::Emulator::SettingMcd1>().c_str(), g_mcd1Data,
+                            SaveMcd(PCSX::g_emulator->settings.get<PCSX::Emulator::SettingMcd1>().c_str(), g_mcd1Data,
                                     (s_adrL | (s_adrH << 8)) * 128,
                                     128);
                             break;
                         case 0x2002:
                             memcpy(g_mcd2Data + (s_adrL | (s_adrH << 8)) * 128, &s_buf[1], 128);
-                            SaveMcd(PCSX::g_emulator.settings.get<PCSX::Emulator::SettingMcd2>().c_str(), g_mcd2Data,
+                            SaveMcd(PCSX::g_emulator->settings.get<PCSX::Emulator::SettingMcd2>().c_str(), g_mcd2Data,
                                     (s_adrL | (s_adrH << 8)) * 128,
                                     128);
                             break;
@@ -717,7 +717,7 @@ uint16_t PCSX::SIO::sioReadStat16() {
 
 #if 0
     // wait for IRQ first
-    if( PCSX::g_emulator.m_psxCpu->m_psxRegs.interrupt & (1 << PSXINT_SIO) )
+    if( PCSX::g_emulator->m_psxCpu->m_psxRegs.interrupt & (1 << PSXINT_SIO) )
     {
         hard &= ~TX_RDY;
         hard &= ~RX_RDY;
@@ -738,14 +738,14 @@ void PCSX::SIO::netError() {
     // ClosePlugins();
     PCSX::g_system->message("%s", _("Connection closed!\n"));
 
-    PCSX::g_emulator.m_cdromId[0] = '\0';
-    PCSX::g_emulator.m_cdromLabel[0] = '\0';
+    PCSX::g_emulator->m_cdromId[0] = '\0';
+    PCSX::g_emulator->m_cdromLabel[0] = '\0';
 
     PCSX::g_system->runGui();
 }
 
 void PCSX::SIO::sioInterrupt() {
-    PAD_LOG("Sio Interrupt (CP0.Status = %x)\n", PCSX::g_emulator.m_psxCpu->m_psxRegs.CP0.n.Status);
+    PAD_LOG("Sio Interrupt (CP0.Status = %x)\n", PCSX::g_emulator->m_psxCpu->m_psxRegs.CP0.n.Status);
     //  PCSX::g_system->printf("Sio Interrupt\n");
     s_statReg |= IRQ;
     psxHu32ref(0x1070) |= SWAP_LEu32(0x80);
@@ -21,4 +21,4 @@
 
 #include "core/system.h"
 
-PCSX::System* PCSX::g_system = NULL;
+thread_local PCSX::System* PCSX::g_system = NULL;
@@ -46,6 +46,8 @@ class System {
     virtual void runGui() = 0;
     // Close mem and plugins
     virtual void close() = 0;
+    // The guest wrote its exit code to the exit register (test programs do that once they're done)
+    virtual void testQuit(int code) = 0;
     bool running() { return m_running; }
     bool quitting() { return m_quitting; }
     void start() { m_running = true; }
@@ -60,6 +62,7 @@ class System {
     bool m_quitting = false;
 };
 
-extern System *g_system;
+// the frontend of the machine running on the calling thread, see g_emulator
+extern thread_local System *g_system;
 
 }  // namespace PCSX
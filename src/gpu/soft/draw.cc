@@ -113,12 +113,12 @@
 ////////////////////////////////////////////////////////////////////////////////////
 // misc globals
 ////////////////////////////////////////////////////////////////////////////////////
-int iFastFwd = 0;
-PSXPoint_t ptCursorPoint[8];
-unsigned short usCursorActive = 0;
+thread_local int iFastFwd = 0;
+thread_local PSXPoint_t ptCursorPoint[8];
+thread_local unsigned short usCursorActive = 0;
 
-PCSX::GUI *m_gui;
-bool bVsync_Key = false;
+thread_local PCSX::GUI *m_gui;
+thread_local bool bVsync_Key = false;
 
 ////////////////////////////////////////////////////////////////////////
 
@@ -172,6 +172,7 @@ void BlitScreen32(unsigned char *surf, long x, long y)  // BLIT IN 32bit COLOR M
 
 void DoClearScreenBuffer(void)  // CLEAR DX BUFFER
 {
+    if (!m_gui) return;
     glClearColor(1, 0, 0, 0);
     glClear(GL_COLOR_BUFFER_BIT);
 }
@@ -180,6 +181,7 @@ void DoClearScreenBuffer(void)  // CLEAR DX BUFFER
 
 void DoClearFrontBuffer(void)  // CLEAR PRIMARY BUFFER
 {
+    if (!m_gui) return;
     glClearColor(1, 0, 0, 0);
     glClear(GL_COLOR_BUFFER_BIT);
 }
@@ -340,13 +342,13 @@ struct s_vertexData {
     float textures[2];
 };
 
-static GLuint vao_handle = 0;
-static GLuint shaderprogram16 = 0;
-static GLuint shaderprogram24 = 0;
-static GLuint vertexp = 0;
-static GLuint texcoordp = 0;
-static GLuint vbo = 0;
-static GLuint vramTexture = 0;
+static thread_local GLuint vao_handle = 0;
+static thread_local GLuint shaderprogram16 = 0;
+static thread_local GLuint shaderprogram24 = 0;
+static thread_local GLuint vertexp = 0;
+static thread_local GLuint texcoordp = 0;
+static thread_local GLuint vbo = 0;
+static thread_local GLuint vramTexture = 0;
 
 static void DrawFullscreenQuad(int is24Bit) {
     glBindVertexArray(vao_handle);
@@ -429,6 +431,8 @@ static void DrawFullscreenQuad(int is24Bit) {
 }
 
 void DoBufferSwap() {
+    if (!m_gui) return;  // headless
+
     m_gui->setViewport();
     m_gui->bindVRAMTexture();
     glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, 1024, 512, GL_RGBA, GL_UNSIGNED_SHORT_1_5_5_5_REV, psxVuw);
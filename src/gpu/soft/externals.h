@@ -143,83 +143,85 @@ struct PSXDisplay_t {
 
 /////////////////////////////////////////////////////////////////////////////
 
+// Everything below belongs to the machine running on the calling thread, see PCSX::g_emulator
+
 // draw.c
 
 namespace PCSX {
 class GUI;
 }
 
-extern PCSX::GUI *m_gui;
-extern bool bVsync_Key;
+extern thread_local PCSX::GUI *m_gui;
+extern thread_local bool bVsync_Key;
 
-extern int iFastFwd;
-extern PSXPoint_t ptCursorPoint[];
-extern unsigned short usCursorActive;
+extern thread_local int iFastFwd;
+extern thread_local PSXPoint_t ptCursorPoint[];
+extern thread_local unsigned short usCursorActive;
 
 // prim.c
 
-extern uint32_t dwCfgFixes;
-extern uint32_t dwActFixes;
-extern uint32_t dwEmuFixes;
-extern int iUseFixes;
-extern bool bDoVSyncUpdate;
+extern thread_local uint32_t dwCfgFixes;
+extern thread_local uint32_t dwActFixes;
+extern thread_local uint32_t dwEmuFixes;
+extern thread_local int iUseFixes;
+extern thread_local bool bDoVSyncUpdate;
 
 // gpu.c
-extern VRAMLoad_t VRAMWrite;
-extern VRAMLoad_t VRAMRead;
-extern DATAREGISTERMODES DataWriteMode;
-extern DATAREGISTERMODES DataReadMode;
-extern int iColDepth;
-extern int iWindowMode;
-extern char szDispBuf[];
-extern char szMenuBuf[];
-extern char szDebugText[];
-extern short sDispWidths[];
-extern bool bDebugText;
+extern thread_local VRAMLoad_t VRAMWrite;
+extern thread_local VRAMLoad_t VRAMRead;
+extern thread_local DATAREGISTERMODES DataWriteMode;
+extern thread_local DATAREGISTERMODES DataReadMode;
+extern thread_local int iColDepth;
+extern thread_local int iWindowMode;
+extern thread_local char szDispBuf[];
+extern thread_local char szMenuBuf[];
+extern thread_local char szDebugText[];
+extern thread_local short sDispWidths[];
+extern thread_local bool bDebugText;
 // extern unsigned int   iMaxDMACommandCounter;
 // extern unsigned long  dwDMAChainStop;
-extern PSXDisplay_t PSXDisplay;
-extern PSXDisplay_t PreviousPSXDisplay;
-extern bool bSkipNextFrame;
-extern long lGPUstatusRet;
-extern long drawingLines;
-extern unsigned char *psxVSecure;
-extern unsigned char *psxVub;
-extern signed char *psxVsb;
-extern unsigned short *psxVuw;
-extern signed short *psxVsw;
-extern uint32_t *psxVul;
-extern int32_t *psxVsl;
-extern unsigned short *psxVuw_eom;
-extern bool bChangeWinMode;
-extern long lSelectedSlot;
-extern uint32_t dwLaceCnt;
-extern uint32_t lGPUInfoVals[];
-extern uint32_t ulStatusControl[];
-extern int iRumbleVal;
-extern int iRumbleTime;
+extern thread_local PSXDisplay_t PSXDisplay;
+extern thread_local PSXDisplay_t PreviousPSXDisplay;
+extern thread_local bool bSkipNextFrame;
+extern thread_local long lGPUstatusRet;
+extern thread_local long drawingLines;
+extern thread_local unsigned char *psxVSecure;
+extern thread_local unsigned char *psxVub;
+extern thread_local signed char *psxVsb;
+extern thread_local unsigned short *psxVuw;
+extern thread_local signed short *psxVsw;
+extern thread_local uint32_t *psxVul;
+extern thread_local int32_t *psxVsl;
+extern thread_local unsigned short *psxVuw_eom;
+extern thread_local bool bChangeWinMode;
+extern thread_local long lSelectedSlot;
+extern thread_local uint32_t dwLaceCnt;
+extern thread_local uint32_t lGPUInfoVals[];
+extern thread_local uint32_t ulStatusControl[];
+extern thread_local int iRumbleVal;
+extern thread_local int iRumbleTime;
 
 // menu.c
 //extern unsigned long dwCoreFlags;
 //extern HFONT hGFont;
-extern int iMPos;
-extern bool bTransparent;
+extern thread_local int iMPos;
+extern thread_local bool bTransparent;
 
 // key.c
 //extern unsigned long ulKeybits;
 //extern char szGPUKeys[];
 
 // fps.c
-extern bool bInitCap;
-extern int UseFrameLimit;
-extern int UseFrameSkip;
-extern float fFrameRate;
-extern int iFrameLimit;
-extern float fFrameRateHz;
-extern float fps_skip;
-extern float fps_cur;
-extern bool UsePerformanceCounter;
-extern bool bSSSPSXLimit;
+extern thread_local bool bInitCap;
+extern thread_local int UseFrameLimit;
+extern thread_local int UseFrameSkip;
+extern thread_local float fFrameRate;
+extern thread_local int iFrameLimit;
+extern thread_local float fFrameRateHz;
+extern thread_local float fps_skip;
+extern thread_local float fps_cur;
+extern thread_local bool UsePerformanceCounter;
+extern thread_local bool bSSSPSXLimit;
 
 // key.c
 
@@ -227,8 +229,8 @@ extern bool bSSSPSXLimit;
 extern char *pConfigFile;
 
 // zn.c
-extern unsigned long dwGPUVersion;
-extern int iGPUHeight;
-extern int iGPUHeightMask;
-extern int GlobalTextIL;
-extern int iTileCheat;
+extern thread_local unsigned long dwGPUVersion;
+extern thread_local int iGPUHeight;
+extern thread_local int iGPUHeightMask;
+extern thread_local int GlobalTextIL;
+extern thread_local int iTileCheat;
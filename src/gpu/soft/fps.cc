@@ -43,6 +43,7 @@
 
 #include <algorithm>
 
+#include "core/psxemulator.h"
 #include "core/system.h"
 #include "gpu/soft/externals.h"
 #include "gpu/soft/fps.h"
@@ -52,29 +53,42 @@
 // FPS stuff
 ////////////////////////////////////////////////////////////////////////
 
-Uint64 CPUFrequency, PerformanceCounter;
+thread_local Uint64 CPUFrequency, PerformanceCounter;
 
-float fFrameRateHz = 0;
-Uint32 dwFrameRateTicks = 16;
-float fFrameRate;
-int iFrameLimit = 2;
-int UseFrameLimit = 1;
-int UseFrameSkip = 0;
-bool bSSSPSXLimit = true;
+thread_local float fFrameRateHz = 0;
+thread_local Uint32 dwFrameRateTicks = 16;
+thread_local float fFrameRate;
+thread_local int iFrameLimit = 2;
+thread_local int UseFrameLimit = 1;
+thread_local int UseFrameSkip = 0;
+thread_local bool bSSSPSXLimit = true;
 
 ////////////////////////////////////////////////////////////////////////
 // FPS skipping / limit
 ////////////////////////////////////////////////////////////////////////
 
-bool bInitCap = true;
-float fps_skip = 0;
-float fps_cur = 0;
+thread_local bool bInitCap = true;
+thread_local float fps_skip = 0;
+thread_local float fps_cur = 0;
+
+// percentage of the natural speed the limiter currently targets (AltSpeed1/AltSpeed2)
+static thread_local uint32_t s_speed = 100;
+
+////////////////////////////////////////////////////////////////////////
+
+static void CheckSpeed(void) {
+    if (PCSX::g_emulator->speed() == s_speed) return;
+    SetAutoFrameCap();  // -> retarget the limiter
+    bInitCap = true;
+}
 
 ////////////////////////////////////////////////////////////////////////
 
 #define MAXLACE 16
 
 void CheckFrameRate(void) {
+    CheckSpeed();
+
     if (UseFrameSkip)  // skipping mode?
     {
         if (!(dwActFixes & 0x80))  // not old skipping mode?
@@ -103,15 +117,15 @@ void CheckFrameRate(void) {
     }
 }
 
-bool UsePerformanceCounter = false;
+thread_local bool UsePerformanceCounter = false;
 
 void FrameCap(void)  // frame limit func
 {
-    static Uint32 curticks, lastticks, _ticks_since_last_update;
-    static Uint32 TicksToWait = 0;
-    static Uint64 CurrentTime;
-    static Uint64 LastTime;
-    static bool SkipNextWait = false;
+    static thread_local Uint32 curticks, lastticks, _ticks_since_last_update;
+    static thread_local Uint32 TicksToWait = 0;
+    static thread_local Uint64 CurrentTime;
+    static thread_local Uint64 LastTime;
+    static thread_local bool SkipNextWait = false;
     bool Waiting = true;
 
     //---------------------------------------------------------
@@ -201,8 +215,8 @@ void FrameCap(void)  // frame limit func
 
 void FrameCapSSSPSX(void)  // frame limit func SSSPSX
 {
-    static Uint32 reqticks, curticks;
-    static double offset;
+    static thread_local Uint32 reqticks, curticks;
+    static thread_local double offset;
 
     //---------------------------------------------------------
     if (bInitCap) {
@@ -228,11 +242,11 @@ void FrameCapSSSPSX(void)  // frame limit func SSSPSX
 #define MAXSKIP 120
 
 void FrameSkip(void) {
-    static int iNumSkips = 0, iAdditionalSkip = 0;  // number of additional frames to skip
-    static Uint32 dwLastLace = 0;                    // helper var for frame limitation
-    static Uint32 curticks, lastticks, _ticks_since_last_update;
-    static Uint64 CurrentTime;
-    static Uint64 LastTime;
+    static thread_local int iNumSkips = 0, iAdditionalSkip = 0;  // number of additional frames to skip
+    static thread_local Uint32 dwLastLace = 0;                    // helper var for frame limitation
+    static thread_local Uint32 curticks, lastticks, _ticks_since_last_update;
+    static thread_local Uint64 CurrentTime;
+    static thread_local Uint64 LastTime;
 
     if (!dwLaceCnt) return;  // important: if no updatelace happened, we ignore it completely
 
@@ -364,13 +378,13 @@ void FrameSkip(void) {
 
 void calcfps(void)  // fps calculations
 {
-    static Uint32 curticks, _ticks_since_last_update, lastticks;
-    static long fps_cnt = 0;
-    static Uint32 fps_tck = 1;
-    static Uint64 CurrentTime;
-    static Uint64 LastTime;
-    static long fpsskip_cnt = 0;
-    static Uint32 fpsskip_tck = 1;
+    static thread_local Uint32 curticks, _ticks_since_last_update, lastticks;
+    static thread_local long fps_cnt = 0;
+    static thread_local Uint32 fps_tck = 1;
+    static thread_local Uint64 CurrentTime;
+    static thread_local Uint64 LastTime;
+    static thread_local long fpsskip_cnt = 0;
+    static thread_local Uint32 fpsskip_tck = 1;
 
     if (UsePerformanceCounter) {
         CurrentTime = SDL_GetPerformanceCounter();
@@ -434,12 +448,14 @@ void calcfps(void)  // fps calculations
 ////////////////////////////////////////////////////////////////////////
 
 void PCFrameCap(void) {
-    static Uint32 curticks, lastticks, _ticks_since_last_update;
-    static Uint32 TicksToWait = 0;
-    static Uint64 CurrentTime;
-    static Uint64 LastTime;
+    static thread_local Uint32 curticks, lastticks, _ticks_since_last_update;
+    static thread_local Uint32 TicksToWait = 0;
+    static thread_local Uint64 CurrentTime;
+    static thread_local Uint64 LastTime;
     bool Waiting = true;
 
+    CheckSpeed();
+
     while (Waiting) {
         if (UsePerformanceCounter) {
             CurrentTime = SDL_GetPerformanceCounter();
@@ -476,11 +492,11 @@ void PCFrameCap(void) {
 ////////////////////////////////////////////////////////////////////////
 
 void PCcalcfps(void) {
-    static Uint32 curticks, _ticks_since_last_update, lastticks;
-    static long fps_cnt = 0;
-    static float fps_acc = 0;
-    static Uint64 CurrentTime;
-    static Uint64 LastTime;
+    static thread_local Uint32 curticks, _ticks_since_last_update, lastticks;
+    static thread_local long fps_cnt = 0;
+    static thread_local float fps_acc = 0;
+    static thread_local Uint64 CurrentTime;
+    static thread_local Uint64 LastTime;
     float CurrentFPS = 0;
 
     if (UsePerformanceCounter) {
@@ -522,8 +538,10 @@ void PCcalcfps(void) {
 ////////////////////////////////////////////////////////////////////////
 
 void SetAutoFrameCap(void) {
+    s_speed = PCSX::g_emulator->speed();
+
     if (iFrameLimit == 1) {
-        fFrameRateHz = fFrameRate;
+        fFrameRateHz = fFrameRate * s_speed / 100.0f;
         if (UsePerformanceCounter)
             dwFrameRateTicks = (Uint32)(CPUFrequency / fFrameRateHz);
         else
@@ -536,6 +554,7 @@ void SetAutoFrameCap(void) {
             fFrameRateHz = PSXDisplay.PAL ? 50.0f : 60.0f;
         else
             fFrameRateHz = PSXDisplay.PAL ? 25.0f : 30.0f;
+        fFrameRateHz = fFrameRateHz * s_speed / 100.0f;
     } else {
         // fFrameRateHz = PSXDisplay.PAL?50.0f:59.94f;
         if (PSXDisplay.PAL) {
@@ -549,6 +568,7 @@ void SetAutoFrameCap(void) {
             else
                 fFrameRateHz = 33868800.0f / 566107.50f;  // 59.82750
         }
+        fFrameRateHz = fFrameRateHz * s_speed / 100.0f;
 
         if (UsePerformanceCounter)
             dwFrameRateTicks = (Uint32)(CPUFrequency / fFrameRateHz);
@@ -129,6 +129,7 @@
 
 #endif
 
+#include "core/profiler.h"
 #include "gpu/soft/cfg.h"
 #include "gpu/soft/draw.h"
 #include "gpu/soft/externals.h"
@@ -158,56 +159,56 @@ static const char *PluginAuthor = "Pete Bernert and the P.E.Op.S. team";
 // memory image of the PSX vram
 ////////////////////////////////////////////////////////////////////////
 
-unsigned char *psxVSecure;
-unsigned char *psxVub;
-signed char *psxVsb;
-unsigned short *psxVuw;
-unsigned short *psxVuw_eom;
-signed short *psxVsw;
-uint32_t *psxVul;
-int32_t *psxVsl;
+thread_local unsigned char *psxVSecure;
+thread_local unsigned char *psxVub;
+thread_local signed char *psxVsb;
+thread_local unsigned short *psxVuw;
+thread_local unsigned short *psxVuw_eom;
+thread_local signed short *psxVsw;
+thread_local uint32_t *psxVul;
+thread_local int32_t *psxVsl;
 
 ////////////////////////////////////////////////////////////////////////
 // GPU globals
 ////////////////////////////////////////////////////////////////////////
 
-long lGPUstatusRet;
-char szDispBuf[64];
-char szMenuBuf[36];
-char szDebugText[512];
-uint32_t ulStatusControl[256];
-
-static uint32_t gpuDataM[256];
-static unsigned char gpuCommand = 0;
-static long gpuDataC = 0;
-static long gpuDataP = 0;
-
-VRAMLoad_t VRAMWrite;
-VRAMLoad_t VRAMRead;
-DATAREGISTERMODES DataWriteMode;
-DATAREGISTERMODES DataReadMode;
-
-bool bSkipNextFrame = false;
-uint32_t dwLaceCnt = 0;
-int iColDepth;
-int iWindowMode;
-short sDispWidths[8] = {256, 320, 512, 640, 368, 384, 512, 640};
-PSXDisplay_t PSXDisplay;
-PSXDisplay_t PreviousPSXDisplay;
-long lSelectedSlot = 0;
-bool bChangeWinMode = false;
-bool bDoLazyUpdate = false;
-uint32_t lGPUInfoVals[16];
-int iFakePrimBusy = 0;
-int iRumbleVal = 0;
-int iRumbleTime = 0;
+thread_local long lGPUstatusRet;
+thread_local char szDispBuf[64];
+thread_local char szMenuBuf[36];
+thread_local char szDebugText[512];
+thread_local uint32_t ulStatusControl[256];
+
+static thread_local uint32_t gpuDataM[256];
+static thread_local unsigned char gpuCommand = 0;
+static thread_local long gpuDataC = 0;
+static thread_local long gpuDataP = 0;
+
+thread_local VRAMLoad_t VRAMWrite;
+thread_local VRAMLoad_t VRAMRead;
+thread_local DATAREGISTERMODES DataWriteMode;
+thread_local DATAREGISTERMODES DataReadMode;
+
+thread_local bool bSkipNextFrame = false;
+thread_local uint32_t dwLaceCnt = 0;
+thread_local int iColDepth;
+thread_local int iWindowMode;
+thread_local short sDispWidths[8] = {256, 320, 512, 640, 368, 384, 512, 640};
+thread_local PSXDisplay_t PSXDisplay;
+thread_local PSXDisplay_t PreviousPSXDisplay;
+thread_local long lSelectedSlot = 0;
+thread_local bool bChangeWinMode = false;
+thread_local bool bDoLazyUpdate = false;
+thread_local uint32_t lGPUInfoVals[16];
+thread_local int iFakePrimBusy = 0;
+thread_local int iRumbleVal = 0;
+thread_local int iRumbleTime = 0;
 
 ////////////////////////////////////////////////////////////////////////
 // some misc external display funcs
 ////////////////////////////////////////////////////////////////////////
 
 /*
-unsigned long PCADDR;
+thread_local unsigned long PCADDR;
 void GPUdebugSetPC(unsigned long addr)
 {
  PCADDR=addr;
@@ -215,7 +216,7 @@ void GPUdebugSetPC(unsigned long addr)
 */
 
 #include <time.h>
-time_t tStart;
+thread_local time_t tStart;
 
 extern "C" void softGPUdisplayText(char *pText)  // some debug func
 {
@@ -426,6 +427,13 @@ long PCSX::SoftGPU::impl::open(GUI *gui)  // GPU OPEN
 
     bDoVSyncUpdate = true;
 
+    if (!m_gui) {
+        // headless: keep rendering into VRAM, but there is no screen to keep pace with
+        UseFrameLimit = 0;
+        UseFrameSkip = 0;
+        return 0;
+    }
+
     ulInitDisplay();  // setup direct draw
 
     return 0;
@@ -480,7 +488,7 @@ void updateDisplay(void)  // UPDATE DISPLAY
 
     if (iFastFwd)  // fastfwd ?
     {
-        static int fpscount;
+        static thread_local int fpscount;
         UseFrameSkip = 1;
 
         if (!bSkipNextFrame) DoBufferSwap();  // -> to skip or not to skip
@@ -675,6 +683,7 @@ extern "C" void softGPUcursor(int iPlayer, int x, int y) {
 
 void PCSX::SoftGPU::impl::updateLace()  // VSYNC
 {
+    Profiler::Scope profile(Profiler::PRESENT);
     if (!(dwActFixes & 1)) lGPUstatusRet ^= 0x80000000;  // odd/even bit
 
     if (!(dwActFixes & 32))  // std fps limitation?
@@ -707,7 +716,7 @@ void PCSX::SoftGPU::impl::updateLace()  // VSYNC
 uint32_t PCSX::SoftGPU::impl::readStatus(void)  // READ STATUS
 {
     if (dwActFixes & 1) {
-        static int iNumRead = 0;  // odd/even hack
+        static thread_local int iNumRead = 0;  // odd/even hack
         if ((iNumRead++) == 2) {
             iNumRead = 0;
             lGPUstatusRet ^= 0x80000000;  // interlaced bit toggle... we do it on every 3 read status... needed by some
@@ -1012,6 +1021,7 @@ __inline void FinishedVRAMRead(void) {
 ////////////////////////////////////////////////////////////////////////
 
 void PCSX::SoftGPU::impl::readDataMem(uint32_t *pMem, int iSize) {
+    Profiler::Scope profile(Profiler::GPU);
     int i;
 
     if (DataReadMode != DR_VRAMTRANSFER) return;
@@ -1146,6 +1156,7 @@ const unsigned char primTableCX[256] = {
     0, 0, 0, 0, 0, 0, 0, 0};
 
 void PCSX::SoftGPU::impl::writeDataMem(uint32_t *pMem, int iSize) {
+    Profiler::Scope profile(Profiler::GPU);
     unsigned char command;
     unsigned long gdata = 0;
     int i = 0;
@@ -1300,7 +1311,7 @@ void SetFixes(void) {
 // process gpu commands
 ////////////////////////////////////////////////////////////////////////
 
-unsigned long lUsedAddr[3];
+thread_local unsigned long lUsedAddr[3];
 
 __inline bool CheckForEndlessLoop(unsigned long laddr) {
     if (laddr == lUsedAddr[1]) return true;
@@ -1315,6 +1326,7 @@ __inline bool CheckForEndlessLoop(unsigned long laddr) {
 }
 
 long PCSX::SoftGPU::impl::dmaChain(uint32_t *baseAddrL, uint32_t addr) {
+    Profiler::Scope profile(Profiler::GPU);
     unsigned long dmaMem;
     unsigned char *baseAddrB;
     short count;
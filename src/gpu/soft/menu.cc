@@ -75,7 +75,7 @@ unsigned long dwCoreFlags = 0;
 
 #ifdef _WIN32
 HFONT hGFont = NULL;
-bool bTransparent = false;
+thread_local bool bTransparent = false;
 #endif
 
 void InitMenu(void) {
@@ -109,7 +109,7 @@ void CloseMenu(void) {
 #include <time.h>
 extern time_t tStart;
 
-int iMPos = 0;  // menu arrow pos
+thread_local int iMPos = 0;  // menu arrow pos
 
 void DisplayText(void)  // DISPLAY TEXT
 {
@@ -95,12 +95,12 @@
 ////////////////////////////////////////////////////////////////////////
 
 // configuration items
-uint32_t dwCfgFixes;
-uint32_t dwActFixes = 0;
-uint32_t dwEmuFixes = 0;
-int iUseFixes;
+thread_local uint32_t dwCfgFixes;
+thread_local uint32_t dwActFixes = 0;
+thread_local uint32_t dwEmuFixes = 0;
+thread_local int iUseFixes;
 // ??
-bool bDoVSyncUpdate = false;
+thread_local bool bDoVSyncUpdate = false;
 
 bool PCSX::SoftGPU::SoftPrim::configure(bool *show) {
     bool changed = false;
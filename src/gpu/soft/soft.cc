@@ -1039,7 +1039,7 @@ void PCSX::SoftGPU::SoftRenderer::FillSoftwareAreaTrans(short x0, short y0, shor
         readdatamem 0x00008000 1
         */
 
-        static int iCheat = 0;
+        static thread_local int iCheat = 0;
         col += iCheat;
         if (iCheat == 1)
             iCheat = 0;
@@ -1139,16 +1139,16 @@ typedef struct SOFTVTAG {
     long R, G, B;
 } soft_vertex;
 
-static soft_vertex vtx[4];
-static soft_vertex *left_array[4], *right_array[4];
-static int left_section, right_section;
-static int left_section_height, right_section_height;
-static int left_x, delta_left_x, right_x, delta_right_x;
-static int left_u, delta_left_u, left_v, delta_left_v;
-static int right_u, delta_right_u, right_v, delta_right_v;
-static int left_R, delta_left_R, right_R, delta_right_R;
-static int left_G, delta_left_G, right_G, delta_right_G;
-static int left_B, delta_left_B, right_B, delta_right_B;
+static thread_local soft_vertex vtx[4];
+static thread_local soft_vertex *left_array[4], *right_array[4];
+static thread_local int left_section, right_section;
+static thread_local int left_section_height, right_section_height;
+static thread_local int left_x, delta_left_x, right_x, delta_right_x;
+static thread_local int left_u, delta_left_u, left_v, delta_left_v;
+static thread_local int right_u, delta_right_u, right_v, delta_right_v;
+static thread_local int left_R, delta_left_R, right_R, delta_right_R;
+static thread_local int left_G, delta_left_G, right_G, delta_right_G;
+static thread_local int left_B, delta_left_B, right_B, delta_right_B;
 
 static constexpr inline int shl10idiv(int x, int y) {
     int64_t bi = x;
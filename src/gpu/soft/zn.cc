@@ -66,11 +66,11 @@ void GPUkeypressed(int keycode);
 // - zn gpu interface -------------------------------- //
 // --------------------------------------------------- //
 
-unsigned long dwGPUVersion = 0;
-int iGPUHeight = 512;
-int iGPUHeightMask = 511;
-int GlobalTextIL = 0;
-int iTileCheat = 0;
+thread_local unsigned long dwGPUVersion = 0;
+thread_local int iGPUHeight = 512;
+thread_local int iGPUHeightMask = 511;
+thread_local int GlobalTextIL = 0;
+thread_local int iTileCheat = 0;
 
 // --------------------------------------------------- //
 // --------------------------------------------------- //
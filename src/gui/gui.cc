@@ -103,9 +103,9 @@ void PCSX::GUI::init() {
                 ImGui::LoadIniSettingsFromMemory(imguicfg.c_str(), imguicfg.size());
             }
             if ((j.count("emulator") == 1) && j["emulator"].is_object()) {
-                PCSX::g_emulator.settings.deserialize(j["emulator"]);
+                PCSX::g_emulator->settings.deserialize(j["emulator"]);
             }
-            PCSX::g_emulator.m_spu->setCfg(j);
+            PCSX::g_emulator->m_spu->setCfg(j);
         }
     }
     ImGui_ImplOpenGL3_Init();
@@ -151,8 +151,8 @@ void PCSX::GUI::saveCfg() {
     json j;
 
     j["imgui"] = ImGui::SaveIniSettingsToMemory(nullptr);
-    j["SPU"] = PCSX::g_emulator.m_spu->getCfg();
-    j["emulator"] = PCSX::g_emulator.settings.serialize();
+    j["SPU"] = PCSX::g_emulator->m_spu->getCfg();
+    j["emulator"] = PCSX::g_emulator->settings.serialize();
     cfg << std::setw(2) << j << std::endl;
 }
 
@@ -297,22 +297,22 @@ void PCSX::GUI::endFrame() {
                     showOpenIsoFileDialog = true;
                 }
                 if (ImGui::MenuItem("Close ISO")) {
-                    PCSX::g_emulator.m_cdrom->m_iso.close();
+                    PCSX::g_emulator->m_cdrom->m_iso.close();
                     CheckCdrom();
                     LoadCdrom();
                 }
                 ImGui::Separator();
                 if (ImGui::MenuItem("Open LID")) {
-                    PCSX::g_emulator.m_cdrom->setCdOpenCaseTime(-1);
-                    PCSX::g_emulator.m_cdrom->lidInterrupt();
+                    PCSX::g_emulator->m_cdrom->setCdOpenCaseTime(-1);
+                    PCSX::g_emulator->m_cdrom->lidInterrupt();
                 }
                 if (ImGui::MenuItem("Close LID")) {
-                    PCSX::g_emulator.m_cdrom->setCdOpenCaseTime(0);
-                    PCSX::g_emulator.m_cdrom->lidInterrupt();
+                    PCSX::g_emulator->m_cdrom->setCdOpenCaseTime(0);
+                    PCSX::g_emulator->m_cdrom->lidInterrupt();
                 }
                 if (ImGui::MenuItem("Open and close LID")) {
-                    PCSX::g_emulator.m_cdrom->setCdOpenCaseTime((int64_t)time(NULL) + 2);
-                    PCSX::g_emulator.m_cdrom->lidInterrupt();
+                    PCSX::g_emulator->m_cdrom->setCdOpenCaseTime((int64_t)time(NULL) + 2);
+                    PCSX::g_emulator->m_cdrom->lidInterrupt();
                 }
                 ImGui::Separator();
                 if (ImGui::MenuItem("Quit")) {
@@ -334,13 +334,26 @@ void PCSX::GUI::endFrame() {
                 if (ImGui::MenuItem("Hard Reset")) {
                     scheduleHardReset();
                 }
+                ImGui::Separator();
+                {
+                    auto& config = PCSX::g_emulator->config();
+                    auto& altSpeed = PCSX::g_emulator->m_altSpeed;
+                    std::string speed1 = "Alternate speed 1 (" + std::to_string(config.AltSpeed1) + "%)";
+                    std::string speed2 = "Alternate speed 2 (" + std::to_string(config.AltSpeed2) + "%)";
+                    if (ImGui::MenuItem(speed1.c_str(), nullptr, altSpeed == 1, config.AltSpeed1 != 0)) {
+                        altSpeed = altSpeed == 1 ? 0 : 1;
+                    }
+                    if (ImGui::MenuItem(speed2.c_str(), nullptr, altSpeed == 2, config.AltSpeed2 != 0)) {
+                        altSpeed = altSpeed == 2 ? 0 : 2;
+                    }
+                }
                 ImGui::EndMenu();
             }
             ImGui::Separator();
             if (ImGui::BeginMenu("Configuration")) {
                 ImGui::MenuItem("Emulation", nullptr, &m_showCfg);
-                ImGui::MenuItem("Soft GPU", nullptr, &PCSX::g_emulator.m_gpu->m_showCfg);
-                ImGui::MenuItem("SPU", nullptr, &PCSX::g_emulator.m_spu->m_showCfg);
+                ImGui::MenuItem("Soft GPU", nullptr, &PCSX::g_emulator->m_gpu->m_showCfg);
+                ImGui::MenuItem("SPU", nullptr, &PCSX::g_emulator->m_spu->m_showCfg);
                 ImGui::EndMenu();
             }
             ImGui::Separator();
@@ -360,7 +373,7 @@ void PCSX::GUI::endFrame() {
                     ImGui::EndMenu();
                 }
                 ImGui::Separator();
-                ImGui::MenuItem("Show SPU debug", nullptr, &PCSX::g_emulator.m_spu->m_showDebug);
+                ImGui::MenuItem("Show SPU debug", nullptr, &PCSX::g_emulator->m_spu->m_showDebug);
                 ImGui::Separator();
                 ImGui::MenuItem("Fullscreen render", nullptr, &m_fullscreenRender);
                 ImGui::EndMenu();
@@ -382,9 +395,9 @@ void PCSX::GUI::endFrame() {
     if (m_openIsoFileDialog.draw()) {
         std::vector<std::string> fileToOpen = m_openIsoFileDialog.selected();
         if (!fileToOpen.empty()) {
-            PCSX::g_emulator.m_cdrom->m_iso.close();
+            PCSX::g_emulator->m_cdrom->m_iso.close();
             SetIsoFile(fileToOpen[0].c_str());
-            PCSX::g_emulator.m_cdrom->m_iso.open();
+            PCSX::g_emulator->m_cdrom->m_iso.open();
             CheckCdrom();
             LoadCdrom();
         }
@@ -425,46 +438,46 @@ void PCSX::GUI::endFrame() {
             if (editor.show) {
                 ImGui::SetNextWindowPos(ImVec2(50, 50 + 10 * counter), ImGuiCond_FirstUseEver);
                 ImGui::SetNextWindowSize(ImVec2(484, 480), ImGuiCond_FirstUseEver);
-                editor.draw(PCSX::g_emulator.m_psxMem->g_psxM, 2 * 1024 * 1024);
+                editor.draw(PCSX::g_emulator->m_psxMem->g_psxM, 2 * 1024 * 1024);
             }
             counter++;
         }
         if (m_parallelPortEditor.show) {
             ImGui::SetNextWindowPos(ImVec2(50, 50 + 10 * counter), ImGuiCond_FirstUseEver);
             ImGui::SetNextWindowSize(ImVec2(484, 480), ImGuiCond_FirstUseEver);
-            m_parallelPortEditor.draw(PCSX::g_emulator.m_psxMem->g_psxP, 64 * 1024);
+            m_parallelPortEditor.draw(PCSX::g_emulator->m_psxMem->g_psxP, 64 * 1024);
         }
         counter++;
         if (m_scratchPadEditor.show) {
             ImGui::SetNextWindowPos(ImVec2(50, 50 + 10 * counter), ImGuiCond_FirstUseEver);
             ImGui::SetNextWindowSize(ImVec2(484, 480), ImGuiCond_FirstUseEver);
-            m_scratchPadEditor.draw(PCSX::g_emulator.m_psxMem->g_psxH, 1024);
+            m_scratchPadEditor.draw(PCSX::g_emulator->m_psxMem->g_psxH, 1024);
         }
         counter++;
         if (m_hwrEditor.show) {
             ImGui::SetNextWindowPos(ImVec2(50, 50 + 10 * counter), ImGuiCond_FirstUseEver);
             ImGui::SetNextWindowSize(ImVec2(484, 480), ImGuiCond_FirstUseEver);
-            m_hwrEditor.draw(PCSX::g_emulator.m_psxMem->g_psxH + 8 * 1024, 8 * 1024);
+            m_hwrEditor.draw(PCSX::g_emulator->m_psxMem->g_psxH + 8 * 1024, 8 * 1024);
         }
         counter++;
         if (m_biosEditor.show) {
             ImGui::SetNextWindowPos(ImVec2(50, 50 + 10 * counter), ImGuiCond_FirstUseEver);
             ImGui::SetNextWindowSize(ImVec2(484, 480), ImGuiCond_FirstUseEver);
-            m_biosEditor.draw(PCSX::g_emulator.m_psxMem->g_psxR, 512 * 1024);
+            m_biosEditor.draw(PCSX::g_emulator->m_psxMem->g_psxR, 512 * 1024);
         }
     }
 
     if (m_registers.m_show) {
-        m_registers.draw(&PCSX::g_emulator.m_psxCpu->m_psxRegs, "Registers");
+        m_registers.draw(&PCSX::g_emulator->m_psxCpu->m_psxRegs, "Registers");
     }
 
     if (m_assembly.m_show) {
-        m_assembly.draw(&PCSX::g_emulator.m_psxCpu->m_psxRegs, PCSX::g_emulator.m_psxMem.get(), "Assembly");
+        m_assembly.draw(&PCSX::g_emulator->m_psxCpu->m_psxRegs, PCSX::g_emulator->m_psxMem.get(), "Assembly");
     }
 
-    PCSX::g_emulator.m_spu->debug();
-    changed |= PCSX::g_emulator.m_spu->configure();
-    changed |= PCSX::g_emulator.m_gpu->configure();
+    PCSX::g_emulator->m_spu->debug();
+    changed |= PCSX::g_emulator->m_spu->configure();
+    changed |= PCSX::g_emulator->m_gpu->configure();
     changed |= configure();
 
     ImGui::Render();
@@ -495,11 +508,13 @@ bool PCSX::GUI::configure() {
     ImGui::SetNextWindowPos(ImVec2(50, 30), ImGuiCond_FirstUseEver);
     ImGui::SetNextWindowSize(ImVec2(300, 200), ImGuiCond_FirstUseEver);
     if (ImGui::Begin("Emulation Configuration", &m_showCfg)) {
-        auto& settings = PCSX::g_emulator.settings;
+        auto& settings = PCSX::g_emulator->settings;
         changed |= ImGui::Checkbox("Enable XA decoder", &settings.get<Emulator::SettingXa>().value);
         changed |= ImGui::Checkbox("Always enable SIO IRQ", &settings.get<Emulator::SettingSioIrq>().value);
         changed |= ImGui::Checkbox("Always enable SPU IRQ", &settings.get<Emulator::SettingSpuIrq>().value);
         changed |= ImGui::Checkbox("Decode MDEC videos in B&W", &settings.get<Emulator::SettingBnWMdec>().value);
+        changed |=
+            ImGui::Checkbox("Decode MDEC videos on a worker thread", &settings.get<Emulator::SettingMdecThread>().value);
 
         {
             static const char* types[] = {"Auto", "NTSC", "PAL"};
@@ -542,6 +557,18 @@ bool PCSX::GUI::configure() {
 
         changed |= ImGui::Checkbox("BIOS HLE", &settings.get<Emulator::SettingHLE>().value);
         changed |= ImGui::Checkbox("Slow boot", &settings.get<Emulator::SettingSlowBoot>().value);
+        changed |= ImGui::SliderInt("Compressed CD cache", &settings.get<Emulator::SettingCDCache>().value, 1, 256,
+                                    "%d MB");
+        ShowHelpMarker("Decompressed blocks kept in memory for PBP and CBN images; applies on the next image load.");
+
+        {
+            auto& config = PCSX::g_emulator->config();
+            int speed1 = config.AltSpeed1;
+            int speed2 = config.AltSpeed2;
+            if (ImGui::SliderInt("Alternate speed 1", &speed1, 0, 1000, "%d%%")) config.AltSpeed1 = speed1;
+            if (ImGui::SliderInt("Alternate speed 2", &speed2, 0, 1000, "%d%%")) config.AltSpeed2 = speed2;
+            ShowHelpMarker("Percentage of the natural speed, selected from the Emulation menu; 0 disables it.");
+        }
     }
     ImGui::End();
 
@@ -555,9 +582,9 @@ void PCSX::GUI::update() {
     // We basically need these to be tail calls, or at least, close from it.
     if (m_scheduleSoftReset) {
         m_scheduleSoftReset = false;
-        PCSX::g_emulator.m_psxCpu->psxReset();
+        PCSX::g_emulator->m_psxCpu->psxReset();
     } else if (m_scheduleHardReset) {
         m_scheduleHardReset = false;
-        PCSX::g_emulator.EmuReset();
+        PCSX::g_emulator->EmuReset();
     }
 }
@@ -0,0 +1,275 @@
+/***************************************************************************
+ *   Copyright (C) 2019 PCSX-Redux authors                                 *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.           *
+ ***************************************************************************/
+
+#include "main/headless.h"
+
+#include <SDL.h>
+
+#include <chrono>
+#include <fstream>
+
+#include "json.hpp"
+
+#include "core/cdrom.h"
+#include "core/gpu.h"
+#include "core/misc.h"
+#include "core/plugins.h"
+#include "core/profiler.h"
+#include "core/psxemulator.h"
+#include "core/r3000a.h"
+#include "spu/interface.h"
+
+using json = nlohmann::json;
+
+namespace {
+
+class HeadlessSystem : public PCSX::System {
+  public:
+    HeadlessSystem(unsigned frames, FILE *tty) : m_maxFrames(frames), m_tty(tty) {}
+
+    // the guest's tty goes to stdout, so that it can be compared against a reference output, unless
+    // that's where the benchmark report goes; everything the emulator itself has to say goes to stderr
+    virtual void printf(const char *fmt, ...) final {
+        va_list a;
+        va_start(a, fmt);
+        vfprintf(stderr, fmt, a);
+        va_end(a);
+    }
+
+    virtual void biosPrintf(const char *fmt, ...) final {
+        va_list a;
+        va_start(a, fmt);
+        vfprintf(m_tty, fmt, a);
+        va_end(a);
+    }
+
+    virtual void vbiosPrintf(const char *fmt, va_list a) final { vfprintf(m_tty, fmt, a); }
+
+    virtual void message(const char *fmt, ...) final {
+        va_list a;
+        va_start(a, fmt);
+        vfprintf(stderr, fmt, a);
+        va_end(a);
+    }
+
+    virtual void log(const char *facility, const char *fmt, va_list a) final { vfprintf(stderr, fmt, a); }
+
+    virtual void update() final {
+        countCycles();
+        if (++m_frames == m_maxFrames) {
+            quit();
+            return;
+        }
+        // same as the GUI does it: resets requested by the debugger happen from the vblank
+        if (m_scheduleSoftReset) {
+            m_scheduleSoftReset = false;
+            PCSX::g_emulator->m_psxCpu->psxReset();
+            m_lastCycle = PCSX::g_emulator->m_psxCpu->m_psxRegs.cycle;
+        } else if (m_scheduleHardReset) {
+            m_scheduleHardReset = false;
+            PCSX::g_emulator->EmuReset();
+            m_lastCycle = PCSX::g_emulator->m_psxCpu->m_psxRegs.cycle;
+        }
+    }
+
+    virtual void runGui() final {}
+    virtual void softReset() final { m_scheduleSoftReset = true; }
+    virtual void hardReset() final { m_scheduleHardReset = true; }
+    virtual void close() final {}
+
+    virtual void testQuit(int code) final {
+        m_exitCode = code;
+        m_guestExit = true;
+        quit();
+    }
+
+    // the cycle counter wraps every couple of minutes of emulated time, so it's accumulated on each vblank
+    void countCycles() {
+        uint32_t cycle = PCSX::g_emulator->m_psxCpu->m_psxRegs.cycle;
+        m_cycles += uint32_t(cycle - m_lastCycle);
+        m_lastCycle = cycle;
+    }
+
+    unsigned m_maxFrames;
+    unsigned m_frames = 0;
+    uint64_t m_cycles = 0;
+    uint32_t m_lastCycle = 0;
+    int m_exitCode = 0;
+    bool m_guestExit = false;
+
+  private:
+    FILE *m_tty;
+    bool m_scheduleSoftReset = false;
+    bool m_scheduleHardReset = false;
+};
+
+// the breakdown of a --bench run, as a table on stderr and as json on stdout
+void benchReport(const HeadlessSystem &system, double host, const std::string &image) {
+    const PCSX::Profiler &profiler = *PCSX::g_emulator->m_profiler;
+    const bool interpreter = PCSX::g_emulator->config().Cpu == PCSX::Emulator::CPU_INTERPRETER;
+    // every instruction is worth BIAS cycles, give or take the odd memory access penalty
+    double mips = host > 0 ? system.m_cycles / double(PCSX::Emulator::BIAS) / host / 1000000.0 : 0.0;
+    double emulated = double(system.m_cycles) / PCSX::g_emulator->m_psxClockSpeed;
+
+    fprintf(stderr, "cpu:      %s, %.2f emulated MIPS\n", interpreter ? "interpreter" : "dynarec", mips);
+    for (int i = 0; i < PCSX::Profiler::SECTIONS; i++) {
+        auto section = PCSX::Profiler::Section(i);
+        double seconds = profiler.seconds(section);
+        fprintf(stderr, "  %-20s %8.3f s %5.1f%%\n", PCSX::Profiler::description(section), seconds,
+                host > 0 ? seconds * 100.0 / host : 0.0);
+    }
+    fprintf(stderr, "  %-20s %8.3f s %5.1f%%\n", "profiler overhead", profiler.overhead(),
+            host > 0 ? profiler.overhead() * 100.0 / host : 0.0);
+
+    json j;
+    j["image"] = image;
+    j["cpu"] = interpreter ? "interpreter" : "dynarec";
+    j["frames"] = system.m_frames;
+    j["cycles"] = system.m_cycles;
+    j["emulatedSeconds"] = emulated;
+    j["hostSeconds"] = host;
+    j["fps"] = host > 0 ? system.m_frames / host : 0.0;
+    j["mips"] = mips;
+    for (int i = 0; i < PCSX::Profiler::SECTIONS; i++) {
+        auto section = PCSX::Profiler::Section(i);
+        j["sections"][PCSX::Profiler::name(section)] = profiler.seconds(section);
+    }
+    j["profilerOverhead"] = profiler.overhead();
+    printf("%s\n", j.dump(2).c_str());
+}
+
+}  // namespace
+
+int PCSX::runHeadless(const flags::args &args) {
+    // timers only: there is no display nor audio device to talk to
+    if (SDL_Init(SDL_INIT_TIMER) != 0) {
+        fprintf(stderr, "SDL_Init failed: %s\n", SDL_GetError());
+        return 1;
+    }
+
+    // a benchmark is a fixed amount of work, 20 seconds worth of NTSC frames unless told otherwise
+    const bool bench = args.get<bool>("bench", false);
+    HeadlessSystem system(args.get<unsigned>("frames", bench ? 1200 : 0), bench ? stderr : stdout);
+    g_system = &system;
+    g_emulator = new Emulator;
+
+    // same configuration file as the GUI, which is the only one to ever write it
+    {
+        std::ifstream cfg("pcsx.json");
+        json j;
+        if (cfg.is_open()) {
+            try {
+                cfg >> j;
+            } catch (...) {
+            }
+            if ((j.count("emulator") == 1) && j["emulator"].is_object()) {
+                g_emulator->settings.deserialize(j["emulator"]);
+            }
+            g_emulator->m_spu->setCfg(j);
+        }
+    }
+    if (args.get<bool>("interpreter", false)) g_emulator->config().Cpu = Emulator::CPU_INTERPRETER;
+
+    // an exe gets started straight from its entry point, which leaves the kernel setup to the HLE
+    // BIOS; a real one would never have run by then
+    std::string exe = args.get<std::string>("exe", "");
+    if (!exe.empty()) g_emulator->settings.get<Emulator::SettingBios>() = "HLE";
+
+    std::string audio = args.get<std::string>("audio", "");
+    FILE *audioFile = nullptr;
+    if (!audio.empty()) {
+        audioFile = fopen(audio.c_str(), "wb");
+        if (!audioFile) fprintf(stderr, "Unable to open %s, discarding the audio\n", audio.c_str());
+    }
+    unsigned audioChannels = 0;
+    uint64_t audioSamples = 0;
+    g_emulator->m_spu->setSynchronous([&](const short *samples, size_t count, unsigned channels) {
+        audioChannels = channels;
+        audioSamples += count;
+        if (audioFile) fwrite(samples, sizeof(short) * channels, count, audioFile);
+    });
+
+    LoadPlugins();
+    g_emulator->m_gpu->open(nullptr);
+    g_emulator->m_spu->open();
+
+    g_emulator->EmuInit();
+    g_emulator->EmuReset();
+
+    std::string iso = args.get<std::string>("iso", "");
+    if (!iso.empty()) SetIsoFile(iso.c_str());
+    g_emulator->m_cdrom->m_iso.open();
+    CheckCdrom();
+
+    int ret = 0;
+    if (!exe.empty()) {
+        if (Load(exe.c_str()) != 0) ret = 1;
+    } else {
+        LoadCdrom();
+    }
+
+    if (bench) g_emulator->m_profiler = std::make_unique<Profiler>();
+
+    auto start = std::chrono::steady_clock::now();
+    if (ret == 0) {
+        system.m_lastCycle = g_emulator->m_psxCpu->m_psxRegs.cycle;
+        if (bench) g_emulator->m_profiler->start();
+        system.start();
+        while (system.running()) g_emulator->m_psxCpu->Execute();
+        if (bench) g_emulator->m_profiler->stop();
+    }
+    auto end = std::chrono::steady_clock::now();
+    system.countCycles();
+
+    double host = std::chrono::duration<double>(end - start).count();
+    double emulated = double(system.m_cycles) / g_emulator->m_psxClockSpeed;
+    fprintf(stderr, "frames:   %u\n", system.m_frames);
+    fprintf(stderr, "cycles:   %llu (%.2f s emulated)\n", (unsigned long long)system.m_cycles, emulated);
+    fprintf(stderr, "host:     %.2f s, %.1f fps, %.0f%% of realtime\n", host, host > 0 ? system.m_frames / host : 0.0,
+            host > 0 ? emulated * 100.0 / host : 0.0);
+    if (audioChannels) {
+        fprintf(stderr, "audio:    %llu samples, %u channel(s) at 44100Hz%s%s\n", (unsigned long long)audioSamples,
+                audioChannels, audioFile ? ", raw 16 bits into " : "", audioFile ? audio.c_str() : "");
+    }
+    // whatever the guest's exit code, the run happened and the report stands
+    if (bench && ret == 0) benchReport(system, host, exe.empty() ? iso : exe);
+    if (system.m_guestExit) {
+        fprintf(stderr, "exit:     %i, from the guest\n", system.m_exitCode);
+        ret = system.m_exitCode;
+    }
+
+    g_emulator->m_spu->close();
+    g_emulator->m_gpu->close();
+    g_emulator->m_cdrom->m_iso.close();
+
+    g_emulator->m_psxCpu->psxShutdown();
+    g_emulator->m_spu->shutdown();
+    g_emulator->m_gpu->shutdown();
+    g_emulator->m_cdrom->m_iso.shutdown();
+
+    if (audioFile) fclose(audioFile);
+
+    delete g_emulator;
+    g_emulator = nullptr;
+    g_system = nullptr;
+
+    SDL_Quit();
+
+    return ret;
+}
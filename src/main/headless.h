@@ -0,0 +1,40 @@
+/***************************************************************************
+ *   Copyright (C) 2019 PCSX-Redux authors                                 *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.           *
+ ***************************************************************************/
+
+#pragma once
+
+#include "flags.h"
+
+namespace PCSX {
+
+// Runs the emulation with no window and no sound device, as fast as the host allows, for batch and
+// regression runs. The GPU only draws into VRAM, and the SPU mixes synchronously into either
+// nothing or the raw file given with --audio. The run ends after --frames vblanks, or when the
+// guest writes to the exit register; returns the exit code for the process. An --exe always runs on
+// the HLE BIOS, which sets up the kernel it expects, whatever the configuration says.
+//
+// --bench runs the same way, 1200 frames by default, and then reports the emulated MIPS, the frame
+// rate and how the host time got split between the parts of the machine, as a table on stderr and
+// as json on stdout; the guest's tty moves to stderr to keep stdout parseable. The report is there
+// even when the guest exits with an error, and the exit code still gets passed on.
+//
+//   --headless|--bench [--iso <image> | --exe <ps-exe>] [--frames <n>] [--audio <file>] [--interpreter]
+int runHeadless(const flags::args &args);
+
+}  // namespace PCSX
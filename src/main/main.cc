@@ -25,6 +25,7 @@
 #include "core/r3000a.h"
 #include "flags.h"
 #include "gui/gui.h"
+#include "main/headless.h"
 #include "spu/interface.h"
 
 #include "main/settings.h"
@@ -83,6 +84,11 @@ class SystemImpl : public PCSX::System {
     virtual void close() final {
         // emulator is requesting a shutdown of the emulation
     }
+
+    virtual void testQuit(int code) final {
+        // only the headless runner ends on it; here it's just worth a log line
+        this->printf(_("Guest requested exit with code %i\n"), code);
+    }
 };
 
 using json = nlohmann::json;
@@ -90,24 +96,27 @@ using json = nlohmann::json;
 int main(int argc, char **argv) {
     const flags::args args(argc, argv);
 
+    if (args.get<bool>("headless", false) || args.get<bool>("bench", false)) return PCSX::runHeadless(args);
+
     if (SDL_Init(SDL_INIT_EVERYTHING) != 0) {
         assert(0);
     }
 
     PCSX::g_system = new SystemImpl;
+    PCSX::g_emulator = new PCSX::Emulator;
     s_gui = new PCSX::GUI(args);
     s_gui->init();
 
     LoadPlugins();
-    PCSX::g_emulator.m_gpu->open(s_gui);
-    PCSX::g_emulator.m_spu->open();
+    PCSX::g_emulator->m_gpu->open(s_gui);
+    PCSX::g_emulator->m_spu->open();
 
-    PCSX::g_emulator.EmuInit();
-    PCSX::g_emulator.EmuReset();
+    PCSX::g_emulator->EmuInit();
+    PCSX::g_emulator->EmuReset();
 
     std::string iso = args.get<std::string>("iso", "");
     if (!iso.empty()) SetIsoFile(iso.c_str());
-    PCSX::g_emulator.m_cdrom->m_iso.open();
+    PCSX::g_emulator->m_cdrom->m_iso.open();
     CheckCdrom();
     LoadCdrom();
 
@@ -115,24 +124,25 @@ int main(int argc, char **argv) {
 
     while (!PCSX::g_system->quitting()) {
         if (PCSX::g_system->running()) {
-            PCSX::g_emulator.m_psxCpu->Execute();
+            PCSX::g_emulator->m_psxCpu->Execute();
         } else {
             s_gui->update();
         }
     }
 
-    PCSX::g_emulator.m_spu->close();
-    PCSX::g_emulator.m_gpu->close();
-    PCSX::g_emulator.m_cdrom->m_iso.close();
+    PCSX::g_emulator->m_spu->close();
+    PCSX::g_emulator->m_gpu->close();
+    PCSX::g_emulator->m_cdrom->m_iso.close();
 
-    PCSX::g_emulator.m_psxCpu->psxShutdown();
-    PCSX::g_emulator.m_spu->shutdown();
-    PCSX::g_emulator.m_gpu->shutdown();
-    PCSX::g_emulator.m_cdrom->m_iso.shutdown();
+    PCSX::g_emulator->m_psxCpu->psxShutdown();
+    PCSX::g_emulator->m_spu->shutdown();
+    PCSX::g_emulator->m_gpu->shutdown();
+    PCSX::g_emulator->m_cdrom->m_iso.shutdown();
 
     s_gui->close();
 
     delete s_gui;
+    delete PCSX::g_emulator;
     delete PCSX::g_system;
 
     return 0;
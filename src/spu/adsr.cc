@@ -35,6 +35,8 @@
 
 #include "stdafx.h"
 
+#include <algorithm>
+
 #include "spu/adsr.h"
 #include "spu/externals.h"
 #include "spu/interface.h"
@@ -84,9 +86,11 @@ void PCSX::SPU::ADSR::start(SPUCHAN *pChannel)  // MIX ADSR
 
 ////////////////////////////////////////////////////////////////////////
 
-int PCSX::SPU::ADSR::mix(SPUCHAN *ch) {
-    unsigned long int disp;
-    signed long int EnvelopeVol = ch->ADSRX.EnvelopeVol;
+// one sample of the envelope; EnvelopeVol is a 32 bits value, and the attack and
+// sustain phases detect when it overflows
+int PCSX::SPU::ADSR::step(SPUCHAN *ch) {
+    uint32_t disp;
+    int32_t EnvelopeVol = ch->ADSRX.EnvelopeVol;
 
     if (ch->bStop)  // should be stopped:
     {               // do release
@@ -95,81 +99,182 @@ int PCSX::SPU::ADSR::mix(SPUCHAN *ch) {
         } else {
             disp = -0x0C + 32;
         }
-        EnvelopeVol -= m_table[ch->ADSRX.ReleaseRate + disp];
+        EnvelopeVol = wrap(EnvelopeVol - int64_t(m_table[ch->ADSRX.ReleaseRate + disp]));
 
         if (EnvelopeVol < 0) {
             EnvelopeVol = 0;
             ch->bOn = 0;
         }
+    } else if (ch->ADSRX.State == 0)  // -> attack
+    {
+        disp = -0x10 + 32;
+        if (ch->ADSRX.AttackModeExp) {
+            if (EnvelopeVol >= 0x60000000) disp = -0x18 + 32;
+        }
+        EnvelopeVol = wrap(EnvelopeVol + int64_t(m_table[ch->ADSRX.AttackRate + disp]));
 
-        ch->ADSRX.EnvelopeVol = EnvelopeVol;
-        ch->ADSRX.lVolume = (EnvelopeVol >>= 21);
-        return EnvelopeVol;
-    } else  // not stopped yet?
+        if (EnvelopeVol < 0) {
+            EnvelopeVol = 0x7FFFFFFF;
+            ch->ADSRX.State = 1;
+        }
+    } else if (ch->ADSRX.State == 1)  // -> decay
     {
-        if (ch->ADSRX.State == 0)  // -> attack
-        {
+        disp = m_tableDisp[(EnvelopeVol >> 28) & 0x7];
+        EnvelopeVol = wrap(EnvelopeVol - int64_t(m_table[ch->ADSRX.DecayRate + disp]));
+
+        if (EnvelopeVol < 0) EnvelopeVol = 0;
+        if (EnvelopeVol <= ch->ADSRX.SustainLevel) {
+            ch->ADSRX.State = 2;
+        }
+    } else if (ch->ADSRX.State == 2)  // -> sustain
+    {
+        if (ch->ADSRX.SustainIncrease) {
             disp = -0x10 + 32;
-            if (ch->ADSRX.AttackModeExp) {
+            if (ch->ADSRX.SustainModeExp) {
                 if (EnvelopeVol >= 0x60000000) disp = -0x18 + 32;
             }
-            EnvelopeVol += m_table[ch->ADSRX.AttackRate + disp];
+            EnvelopeVol = wrap(EnvelopeVol + int64_t(m_table[ch->ADSRX.SustainRate + disp]));
 
             if (EnvelopeVol < 0) {
                 EnvelopeVol = 0x7FFFFFFF;
-                ch->ADSRX.State = 1;
             }
+        } else {
+            if (ch->ADSRX.SustainModeExp) {
+                disp = m_tableDisp[((EnvelopeVol >> 28) & 0x7) + 8];
+            } else {
+                disp = -0x0F + 32;
+            }
+            EnvelopeVol = wrap(EnvelopeVol - int64_t(m_table[ch->ADSRX.SustainRate + disp]));
 
-            ch->ADSRX.EnvelopeVol = EnvelopeVol;
-            ch->ADSRX.lVolume = (EnvelopeVol >>= 21);
-            return EnvelopeVol;
+            if (EnvelopeVol < 0) {
+                EnvelopeVol = 0;
+            }
         }
-        //--------------------------------------------------//
-        if (ch->ADSRX.State == 1)  // -> decay
-        {
-            disp = m_tableDisp[(EnvelopeVol >> 28) & 0x7];
-            EnvelopeVol -= m_table[ch->ADSRX.DecayRate + disp];
+    } else {
+        return 0;
+    }
 
-            if (EnvelopeVol < 0) EnvelopeVol = 0;
-            if (EnvelopeVol <= ch->ADSRX.SustainLevel) {
-                ch->ADSRX.State = 2;
-            }
+    ch->ADSRX.EnvelopeVol = EnvelopeVol;
+    ch->ADSRX.lVolume = EnvelopeVol >> 21;
+    return EnvelopeVol >> 21;
+}
+
+////////////////////////////////////////////////////////////////////////
+
+// Decreasing by rate, how many samples can be done before the envelope leaves the exponential
+// range starting at low (checked before each sample), or goes under floor (checked after each one).
+int64_t PCSX::SPU::ADSR::stepsDown(int32_t vol, int64_t rate, int64_t low, int64_t floor) {
+    if (!rate) return vol >= floor ? INT64_MAX : 0;
+    return std::max<int64_t>(0, std::min((vol - low) / rate + 1, (vol - floor) / rate));
+}
+
+// Increasing by rate, same thing with the range ending at high, and without overflowing.
+int64_t PCSX::SPU::ADSR::stepsUp(int32_t vol, int64_t rate, int64_t high) {
+    if (!rate) return INT64_MAX;
+    return std::max<int64_t>(0, std::min((high - vol) / rate + 1, (0x7FFFFFFF - vol) / rate));
+}
 
-            ch->ADSRX.EnvelopeVol = EnvelopeVol;
-            ch->ADSRX.lVolume = (EnvelopeVol >>= 21);
-            return EnvelopeVol;
+// How many samples the envelope moves by a constant *delta without changing phase, rate,
+// or getting clamped. Those can be done at once; the sample after them has to go through step().
+int64_t PCSX::SPU::ADSR::linearSteps(const SPUCHAN *ch, int32_t *delta) const {
+    const ADSRInfoEx &adsr = ch->ADSRX;
+    const int32_t vol = adsr.EnvelopeVol;
+    const int region = vol >> 28;
+    int64_t rate;
+
+    if (vol < 0) return 0;
+
+    if (ch->bStop) {
+        rate = m_table[adsr.ReleaseRate + (adsr.ReleaseModeExp ? m_tableDisp[region] : -0x0C + 32)];
+        *delta = -rate;
+        // once the release is done and the channel is off, it stays at 0
+        if (!vol && (!rate || !ch->bOn)) {
+            *delta = 0;
+            return INT64_MAX;
         }
-        //--------------------------------------------------//
-        if (ch->ADSRX.State == 2)  // -> sustain
-        {
-            if (ch->ADSRX.SustainIncrease) {
-                disp = -0x10 + 32;
-                if (ch->ADSRX.SustainModeExp) {
-                    if (EnvelopeVol >= 0x60000000) disp = -0x18 + 32;
-                }
-                EnvelopeVol += m_table[ch->ADSRX.SustainRate + disp];
+        return stepsDown(vol, rate, adsr.ReleaseModeExp ? int64_t(region) << 28 : 0, 0);
+    }
 
-                if (EnvelopeVol < 0) {
-                    EnvelopeVol = 0x7FFFFFFF;
+    switch (adsr.State) {
+        case 0:  // attack
+            if (adsr.AttackModeExp && vol < 0x60000000) {
+                rate = m_table[adsr.AttackRate + -0x10 + 32];
+                *delta = rate;
+                return stepsUp(vol, rate, 0x5FFFFFFF);
+            }
+            rate = m_table[adsr.AttackRate + (adsr.AttackModeExp ? -0x18 + 32 : -0x10 + 32)];
+            *delta = rate;
+            return stepsUp(vol, rate, 0x7FFFFFFF);
+        case 1:  // decay
+            rate = m_table[adsr.DecayRate + m_tableDisp[region]];
+            *delta = -rate;
+            return stepsDown(vol, rate, int64_t(region) << 28, std::max(adsr.SustainLevel + int64_t(1), int64_t(0)));
+        case 2:  // sustain
+            if (adsr.SustainIncrease) {
+                if (vol == 0x7FFFFFFF) {  // saturated
+                    *delta = 0;
+                    return INT64_MAX;
                 }
-            } else {
-                if (ch->ADSRX.SustainModeExp) {
-                    disp = m_tableDisp[((EnvelopeVol >> 28) & 0x7) + 8];
-                } else {
-                    disp = -0x0F + 32;
+                if (adsr.SustainModeExp && vol < 0x60000000) {
+                    rate = m_table[adsr.SustainRate + -0x10 + 32];
+                    *delta = rate;
+                    return stepsUp(vol, rate, 0x5FFFFFFF);
                 }
-                EnvelopeVol -= m_table[ch->ADSRX.SustainRate + disp];
+                rate = m_table[adsr.SustainRate + (adsr.SustainModeExp ? -0x18 + 32 : -0x10 + 32)];
+                *delta = rate;
+                return stepsUp(vol, rate, 0x7FFFFFFF);
+            }
+            if (!vol) {  // saturated
+                *delta = 0;
+                return INT64_MAX;
+            }
+            rate = m_table[adsr.SustainRate + (adsr.SustainModeExp ? m_tableDisp[region + 8] : -0x0F + 32)];
+            *delta = -rate;
+            return stepsDown(vol, rate, adsr.SustainModeExp ? int64_t(region) << 28 : 0, 0);
+    }
 
-                if (EnvelopeVol < 0) {
-                    EnvelopeVol = 0;
-                }
+    return 0;
+}
+
+////////////////////////////////////////////////////////////////////////
+
+// Runs the envelope over a whole block: each phase is linear between its rate changes, so it
+// only goes sample by sample around those. The envelope volume after each sample goes to dest,
+// if there is one; the return value is non zero if any of them was.
+int PCSX::SPU::ADSR::mix(SPUCHAN *ch, int *dest, int count) {
+    int audible = 0;
+
+    while (count > 0) {
+        int32_t delta;
+        int64_t n = linearSteps(ch, &delta);
+
+        if (!n) {
+            int vol = step(ch);
+            if (dest) *dest++ = vol;
+            audible |= vol;
+            count--;
+            continue;
+        }
+
+        if (n > count) n = count;
+        int32_t EnvelopeVol = ch->ADSRX.EnvelopeVol;
+        // the envelope is monotonic over the run, so checking its ends is enough
+        audible |= (EnvelopeVol + delta) >> 21;
+        if (dest) {
+            for (int i = 0; i < n; i++) {
+                EnvelopeVol += delta;
+                *dest++ = EnvelopeVol >> 21;
             }
-            ch->ADSRX.EnvelopeVol = EnvelopeVol;
-            ch->ADSRX.lVolume = (EnvelopeVol >>= 21);
-            return EnvelopeVol;
+        } else {
+            EnvelopeVol += delta * int32_t(n);
         }
+        audible |= EnvelopeVol >> 21;
+        ch->ADSRX.EnvelopeVol = EnvelopeVol;
+        ch->ADSRX.lVolume = EnvelopeVol >> 21;
+        count -= n;
     }
-    return 0;
+
+    return audible;
 }
 
 /*
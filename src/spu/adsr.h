@@ -26,6 +26,8 @@
 
 #pragma once
 
+#include <stdint.h>
+
 #include "spu/externals.h"
 #include "spu/types.h"
 
@@ -36,9 +38,15 @@ namespace SPU {
 class ADSR {
   public:
     void start(SPUCHAN* pChannel);
-    int mix(SPUCHAN* pChannel);
+    int mix(SPUCHAN* pChannel, int* dest, int count);
 
   private:
+    static int32_t wrap(int64_t vol) { return static_cast<int32_t>(static_cast<uint32_t>(vol)); }
+    static int64_t stepsDown(int32_t vol, int64_t rate, int64_t low, int64_t floor);
+    static int64_t stepsUp(int32_t vol, int64_t rate, int64_t high);
+    int step(SPUCHAN* pChannel);
+    int64_t linearSteps(const SPUCHAN* pChannel, int32_t* delta) const;
+
     static inline const uint32_t m_tableDisp[] = {
         -0x18 + 0 + 32, -0x18 + 4 + 32,  -0x18 + 6 + 32,  -0x18 + 8 + 32,  // release/decay
         -0x18 + 9 + 32, -0x18 + 10 + 32, -0x18 + 11 + 32, -0x18 + 12 + 32,
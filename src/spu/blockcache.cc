@@ -0,0 +1,62 @@
+/***************************************************************************
+ *   Copyright (C) 2019 PCSX-Redux authors                                 *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.           *
+ ***************************************************************************/
+
+#include "spu/blockcache.h"
+
+#include <string.h>
+
+void PCSX::SPU::BlockCache::decode(const uint8_t *spuMem, uint32_t addr, int *dest, int *s1, int *s2) {
+    const uint32_t block = addr / ADPCM::BLOCK_SIZE;
+    Entry &entry = m_entries[block % ENTRIES];
+    const uint32_t generation = entry.generation.load(std::memory_order_acquire);
+
+    if (entry.block == block && entry.filledGeneration == generation && entry.s1In == *s1 && entry.s2In == *s2) {
+        memcpy(dest, entry.samples, sizeof(entry.samples));
+        *s1 = entry.s1Out;
+        *s2 = entry.s2Out;
+        return;
+    }
+
+    entry.s1In = *s1;
+    entry.s2In = *s2;
+    ADPCM::decodeSPUBlock(spuMem + addr, dest, s1, s2);
+    memcpy(entry.samples, dest, sizeof(entry.samples));
+    entry.s1Out = *s1;
+    entry.s2Out = *s2;
+    entry.block = block;
+    // if a writer touched this block while we were decoding, the generation moved on and the entry stays invalid
+    entry.filledGeneration = generation;
+}
+
+void PCSX::SPU::BlockCache::invalidate(uint32_t addr, uint32_t size) {
+    if (!size) return;
+    uint32_t first = (addr % RAM_SIZE) / ADPCM::BLOCK_SIZE;
+    uint32_t count = (addr % ADPCM::BLOCK_SIZE + size + ADPCM::BLOCK_SIZE - 1) / ADPCM::BLOCK_SIZE;
+    if (count > ENTRIES) count = ENTRIES;
+    for (uint32_t i = 0; i < count; i++) {
+        m_entries[(first + i) % ENTRIES].generation.fetch_add(1, std::memory_order_release);
+    }
+}
+
+void PCSX::SPU::BlockCache::clear() {
+    for (auto &entry : m_entries) {
+        entry.block = INVALID;
+        entry.generation.fetch_add(1, std::memory_order_release);
+    }
+}
@@ -0,0 +1,62 @@
+/***************************************************************************
+ *   Copyright (C) 2019 PCSX-Redux authors                                 *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.           *
+ ***************************************************************************/
+
+#pragma once
+
+#include <stdint.h>
+
+#include <atomic>
+
+#include "core/adpcm.h"
+
+namespace PCSX {
+
+namespace SPU {
+
+// Cache of decoded ADPCM blocks from SPU RAM, keyed by the block address and by the
+// filter history at block entry, so that looping voices don't decode the same blocks
+// over and over. Any write into SPU RAM has to invalidate the blocks it touches.
+class BlockCache {
+  public:
+    // decodes the 16 bytes block at byte offset addr in SPU RAM, going through the cache
+    void decode(const uint8_t *spuMem, uint32_t addr, int *dest, int *s1, int *s2);
+    void invalidate(uint32_t addr, uint32_t size);
+    void clear();
+
+  private:
+    static const unsigned ENTRIES = 2048;  // direct mapped
+    static const uint32_t RAM_SIZE = 0x80000;
+    static const uint32_t INVALID = 0xffffffff;
+
+    struct Entry {
+        // bumped by the writers; an entry is only valid if it was filled under the current generation
+        std::atomic<uint32_t> generation = 0;
+        uint32_t filledGeneration = 0;
+        uint32_t block = INVALID;
+        int s1In, s2In;
+        int s1Out, s2Out;
+        int samples[ADPCM::BLOCK_SAMPLES];
+    };
+
+    Entry m_entries[ENTRIES];
+};
+
+}  // namespace SPU
+
+}  // namespace PCSX
@@ -41,7 +41,7 @@ unsigned short PCSX::SPU::impl::readDMA(void) {
     spuAddr += 2;
     if (spuAddr > 0x7ffff) spuAddr = 0;
 
-    iSpuAsyncWait = 0;
+    if (iSpuAsyncWait) ReleaseAsyncWait();
 
     return s;
 }
@@ -59,7 +59,7 @@ void PCSX::SPU::impl::readDMAMem(unsigned short* pusPSXMem, int iSize) {
         if (spuAddr > 0x7ffff) spuAddr = 0;   // wrap
     }
 
-    iSpuAsyncWait = 0;
+    if (iSpuAsyncWait) ReleaseAsyncWait();
 }
 
 ////////////////////////////////////////////////////////////////////////
@@ -76,11 +76,12 @@ void PCSX::SPU::impl::readDMAMem(unsigned short* pusPSXMem, int iSize) {
 
 void PCSX::SPU::impl::writeDMA(unsigned short val) {
     spuMem[spuAddr >> 1] = val;  // spu addr got by writeregister
+    m_blockCache.invalidate(spuAddr, 2);
 
     spuAddr += 2;                        // inc spu addr
     if (spuAddr > 0x7ffff) spuAddr = 0;  // wrap
 
-    iSpuAsyncWait = 0;
+    if (iSpuAsyncWait) ReleaseAsyncWait();
 }
 
 ////////////////////////////////////////////////////////////////////////
@@ -89,6 +90,7 @@ void PCSX::SPU::impl::writeDMA(unsigned short val) {
 
 void PCSX::SPU::impl::writeDMAMem(unsigned short* pusPSXMem, int iSize) {
     int i;
+    uint32_t start = spuAddr;
 
     for (i = 0; i < iSize; i++) {
         spuMem[spuAddr >> 1] = *pusPSXMem++;  // spu addr got by writeregister
@@ -96,7 +98,9 @@ void PCSX::SPU::impl::writeDMAMem(unsigned short* pusPSXMem, int iSize) {
         if (spuAddr > 0x7ffff) spuAddr = 0;   // wrap
     }
 
-    iSpuAsyncWait = 0;
+    m_blockCache.invalidate(start, iSize * 2);
+
+    if (iSpuAsyncWait) ReleaseAsyncWait();
 }
 
 ////////////////////////////////////////////////////////////////////////
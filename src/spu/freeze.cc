@@ -114,6 +114,7 @@ long PCSX::SPU::impl::freeze(uint32_t ulFreezeMode, SPUFreeze_t *pF) {
     RemoveThread();  // we stop processing while doing the save!
 
     memcpy(spuMem, pF->SPURam, 0x80000);  // get ram
+    m_blockCache.clear();
     memcpy(regArea, pF->SPUPorts, 0x200);
 
     if (pF->xa.nsamples <= 4032)  // start xa again
@@ -22,12 +22,17 @@
 #include <SDL.h>
 #include <stdint.h>
 
+#include <atomic>
+#include <functional>
+
 #include "json.hpp"
 
 #include "core/decode_xa.h"
 #include "main/settings.h"
 #include "spu/adsr.h"
+#include "spu/blockcache.h"
 #include "spu/sdlsound.h"
+#include "spu/timestretch.h"
 #include "spu/types.h"
 
 namespace PCSX {
@@ -65,7 +70,7 @@ class impl {
     };
 
     long freeze(uint32_t, SPUFreeze_t *);
-    void async(uint32_t);
+    void async(uint32_t cycle, uint32_t cyclesPerSecond);
     void playCDDAchannel(short *, int);
     void registerCDDAVolume(void (*CDDAVcallback)(unsigned short, unsigned short));
 
@@ -85,6 +90,13 @@ class impl {
     bool m_showDebug = false;
     bool m_showCfg = false;
 
+    // Synchronous mode, for headless and batch runs: no spu thread and no sound device. The
+    // emulation thread mixes from async(), as many samples as the emulated cycles are worth,
+    // and hands them over to the sink. The output only depends on the emulation, not on timing.
+    // Has to be set before open().
+    typedef std::function<void(const short *samples, size_t count, unsigned channels)> Sink;
+    void setSynchronous(Sink sink) { m_sink = std::move(sink); }
+
   private:
     // sound buffer sizes
     // 400 ms complete sound buffer
@@ -100,9 +112,12 @@ class impl {
     void LoadStateUnknown(SPUFreeze_t *);
 
     // spu
+    void MixBlock();
     void MainThread();
     static int MainThreadTrampoline(void *arg) {
         impl *that = static_cast<impl *>(arg);
+        g_emulator = that->m_emulator;
+        g_system = that->m_system;
         that->MainThread();
         return 0;
     }
@@ -110,6 +125,8 @@ class impl {
     void RemoveStreams();
     void SetupThread();
     void RemoveThread();
+    void ReleaseAsyncWait();
+    void SyncMix(uint32_t cycle, uint32_t cyclesPerSecond);
     void StartSound(SPUCHAN *pChannel);
     void VoiceChangeFrequency(SPUCHAN *pChannel);
     void FModChangeFrequency(SPUCHAN *pChannel, int ns);
@@ -128,15 +145,11 @@ class impl {
     void ReverbOn(int start, int end, unsigned short val);
 
     // reverb
-    int g_buffer(int iOff);              // get_buffer content helper: takes care about wraps
-    void s_buffer(int iOff, int iVal);   // set_buffer content helper: takes care about wraps and clipping
-    void s_buffer1(int iOff, int iVal);  // set_buffer (+1 sample) content helper: takes care about wraps and clipping
     void InitREVERB();
     void SetREVERB(unsigned short val);
     void StartREVERB(SPUCHAN *pChannel);
-    void StoreREVERB(SPUCHAN *pChannel, int ns);
-    int MixREVERBLeft(int ns);
-    int MixREVERBRight();
+    void StoreREVERB(SPUCHAN *pChannel, const int *sval, int leftVolume, int rightVolume, int count);
+    void MixREVERB();
 
     // xa
     void MixXA();
@@ -190,7 +203,9 @@ class impl {
     int bThreadEnded = 0;
     int bSpuInit = 0;
 
-    SDL_Thread *hMainThread;
+    SDL_Thread *hMainThread = nullptr;
+    Emulator *m_emulator = nullptr;  // the machine that started the thread, for the mixing thread to work for
+    System *m_system = nullptr;
     unsigned long dwNewChannel = 0;  // flags for faster testing, if new channel starts
 
     void (*irqCallback)(void) = 0;  // func of main emu, called on spu irq
@@ -199,17 +214,32 @@ class impl {
 
     // certain globals (were local before, but with the new timeproc I need em global)
 
-    const int f[5][2] = {{0, 0}, {60, 0}, {115, -52}, {98, -55}, {122, -60}};
     int SSumR[NSSIZE];
     int SSumL[NSSIZE];
     int iFMod[NSSIZE];
+
+    // output of each voice for the current 1 ms block, laid out as structure of arrays,
+    // so that volumes and reverb get applied on whole blocks by the Mixer kernels
+    struct VoiceBlock {
+        int count[MAXCHAN];  // valid samples in sval; 0 if the voice didn't play, or was silent
+        int leftVolume[MAXCHAN];
+        int rightVolume[MAXCHAN];
+        int sval[MAXCHAN][NSSIZE];
+        int envelope[NSSIZE];  // adsr volume of the voice being processed
+    } m_voices;
     int iCycle = 0;
     short *pS;
 
     int lastch = -1;       // last channel processed on spu irq in timer mode
     int lastns = 0;        // last ns pos
     int iSecureStart = 0;  // secure start counter
-    int iSpuAsyncWait = 0;
+    std::atomic<int> iSpuAsyncWait = 0;
+    SDL_mutex *m_asyncWaitMutex = nullptr;  // guards the wake up of the thread waiting for the cpu after an irq
+    SDL_cond *m_asyncWaitCond = nullptr;
+
+    Sink m_sink;                  // set in synchronous mode
+    short *m_syncPlay = nullptr;  // samples mixed at pSpuBuffer but not handed over to the sink yet
+    uint64_t m_syncCycles = 0;    // leftover cycles, times 44100
 
     // REVERB info and timing vars...
 
@@ -219,6 +249,7 @@ class impl {
     int iReverbOff = -1;  // some delay factor for reverb
     int iReverbRepeat = 0;
     int iReverbNum = 1;
+    int m_reverbCounter = 0;  // counts the 44.1 khz output samples; Neill's reverb runs on every second one
 
     // XA
     xa_decode_t *xapGlobal = 0;
@@ -242,7 +273,9 @@ class impl {
     int &gvalr(int pos) { return gauss_window[4 + ((gauss_ptr + pos) & 3)]; }
 
     ADSR m_adsr;
+    BlockCache m_blockCache;  // decoded adpcm blocks; anything writing into spuMem has to invalidate it
     SDLsound m_sound;
+    TimeStretch m_stretch;  // keeps the pitch when running at an alternate speed
     xa_decode_t m_cdda;
 
     // debug window
@@ -0,0 +1,72 @@
+/***************************************************************************
+ *   Copyright (C) 2019 PCSX-Redux authors                                 *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.           *
+ ***************************************************************************/
+
+#include "spu/mixer.h"
+#include "spu/simd.h"
+
+namespace {
+
+inline int applyVolume(int sample, int volume) { return (sample * volume) / 0x4000; }
+
+#ifdef SPU_SSE2
+inline __m128i applyVolume(__m128i samples, __m128i volume) {
+    return PCSX::SPU::SIMD::div<14>(PCSX::SPU::SIMD::mullo32(samples, volume));
+}
+#endif
+
+}  // namespace
+
+void PCSX::SPU::Mixer::mixVoice(int *left, int *right, const int *src, int leftVolume, int rightVolume, int count) {
+    int i = 0;
+#ifdef SPU_SSE2
+    const __m128i vl = _mm_set1_epi32(leftVolume);
+    const __m128i vr = _mm_set1_epi32(rightVolume);
+    for (; i + 4 <= count; i += 4) {
+        __m128i s = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i));
+        __m128i *pl = reinterpret_cast<__m128i *>(left + i);
+        __m128i *pr = reinterpret_cast<__m128i *>(right + i);
+        _mm_storeu_si128(pl, _mm_add_epi32(_mm_loadu_si128(pl), applyVolume(s, vl)));
+        _mm_storeu_si128(pr, _mm_add_epi32(_mm_loadu_si128(pr), applyVolume(s, vr)));
+    }
+#endif
+    for (; i < count; i++) {
+        left[i] += applyVolume(src[i], leftVolume);
+        right[i] += applyVolume(src[i], rightVolume);
+    }
+}
+
+void PCSX::SPU::Mixer::mixVoiceInterleaved(int *dst, const int *src, int leftVolume, int rightVolume, int count) {
+    int i = 0;
+#ifdef SPU_SSE2
+    const __m128i vl = _mm_set1_epi32(leftVolume);
+    const __m128i vr = _mm_set1_epi32(rightVolume);
+    for (; i + 4 <= count; i += 4) {
+        __m128i s = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i));
+        __m128i l = applyVolume(s, vl);
+        __m128i r = applyVolume(s, vr);
+        __m128i *p = reinterpret_cast<__m128i *>(dst + i * 2);
+        _mm_storeu_si128(p, _mm_add_epi32(_mm_loadu_si128(p), _mm_unpacklo_epi32(l, r)));
+        _mm_storeu_si128(p + 1, _mm_add_epi32(_mm_loadu_si128(p + 1), _mm_unpackhi_epi32(l, r)));
+    }
+#endif
+    for (; i < count; i++) {
+        dst[i * 2] += applyVolume(src[i], leftVolume);
+        dst[i * 2 + 1] += applyVolume(src[i], rightVolume);
+    }
+}
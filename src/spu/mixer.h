@@ -0,0 +1,44 @@
+/***************************************************************************
+ *   Copyright (C) 2019 PCSX-Redux authors                                 *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.           *
+ ***************************************************************************/
+
+#pragma once
+
+#include <stdint.h>
+
+namespace PCSX {
+
+namespace SPU {
+
+namespace Mixer {
+
+// All the kernels below are bit exact with the scalar formulas they replace,
+// including the rounding towards zero of the divisions.
+
+// left[i] += (src[i] * leftVolume) / 0x4000
+// right[i] += (src[i] * rightVolume) / 0x4000
+void mixVoice(int *left, int *right, const int *src, int leftVolume, int rightVolume, int count);
+
+// same as mixVoice, but into an interleaved L/R buffer, such as the reverb input
+void mixVoiceInterleaved(int *dst, const int *src, int leftVolume, int rightVolume, int count);
+
+}  // namespace Mixer
+
+}  // namespace SPU
+
+}  // namespace PCSX
@@ -0,0 +1,234 @@
+/***************************************************************************
+ *   Copyright (C) 2019 PCSX-Redux authors                                 *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.           *
+ ***************************************************************************/
+
+#include "spu/neillreverb.h"
+
+#include "spu/simd.h"
+
+namespace {
+
+// the reverb work area taps touched by Neill's steady-state algorithm, grouped in fours the way they get processed
+enum {
+    IIR_SRC = 0,     // A0, A1, B0, B1
+    IIR_DEST = 4,    // A0, A1, B0, B1
+    IIR_STORE = 8,   // IIR_DEST + 1 sample, same order
+    ACC_SRC0 = 12,   // A0, B0, C0, D0
+    ACC_SRC1 = 16,   // A1, B1, C1, D1
+    FB_SRC = 20,     // MIX_DEST_A0 - FB_SRC_A, MIX_DEST_A1 - FB_SRC_A, MIX_DEST_B0 - FB_SRC_B, MIX_DEST_B1 - FB_SRC_B
+    MIX_DEST = 24,   // A0, A1, B0, B1
+    REVERB_TAPS = 28,
+};
+
+void getReverbTaps(const PCSX::SPU::REVERBInfo &rvb, int *taps) {
+    const int offsets[REVERB_TAPS] = {
+        rvb.IIR_SRC_A0,  rvb.IIR_SRC_A1,  rvb.IIR_SRC_B0,  rvb.IIR_SRC_B1,  rvb.IIR_DEST_A0, rvb.IIR_DEST_A1,
+        rvb.IIR_DEST_B0, rvb.IIR_DEST_B1, rvb.IIR_DEST_A0, rvb.IIR_DEST_A1, rvb.IIR_DEST_B0, rvb.IIR_DEST_B1,
+        rvb.ACC_SRC_A0,  rvb.ACC_SRC_B0,  rvb.ACC_SRC_C0,  rvb.ACC_SRC_D0,  rvb.ACC_SRC_A1,  rvb.ACC_SRC_B1,
+        rvb.ACC_SRC_C1,  rvb.ACC_SRC_D1,  rvb.MIX_DEST_A0 - rvb.FB_SRC_A,  rvb.MIX_DEST_A1 - rvb.FB_SRC_A,
+        rvb.MIX_DEST_B0 - rvb.FB_SRC_B,  rvb.MIX_DEST_B1 - rvb.FB_SRC_B,  rvb.MIX_DEST_A0, rvb.MIX_DEST_A1,
+        rvb.MIX_DEST_B0, rvb.MIX_DEST_B1,
+    };
+    for (int i = 0; i < REVERB_TAPS; i++) taps[i] = offsets[i] * 4 + (i >= IIR_STORE && i < IIR_STORE + 4 ? 1 : 0);
+}
+
+// Maps a tap into the work area, and returns how many 22 khz steps it can advance linearly from there.
+// Going forward, the work area wraps from its end back to its start, but going backward it wraps one
+// sample short of the end; both have to be kept bit for bit, so a tap sitting before the start wraps at 0x3fffe.
+int mapReverbTap(int iOff, int start, int *addr) {
+    const int limit = iOff < start ? 0x3fffe : 0x3ffff;
+    while (iOff > 0x3FFFF) iOff = start + (iOff - 0x40000);
+    while (iOff < start) iOff = 0x3ffff - (start - iOff);
+    *addr = iOff;
+    return limit - iOff + 1;
+}
+
+// Maps all the taps for the current address, and returns the length of the segment where none of them wraps.
+int mapReverbSegment(const int *taps, int curr, int start, int *addr) {
+    int run = 0x3ffff - curr + 1;
+    if (run < 1) run = 1;
+    for (int i = 0; i < REVERB_TAPS; i++) {
+        int n = mapReverbTap(taps[i] + curr, start, addr + i);
+        if (n < run) run = n;
+    }
+    return run;
+}
+
+inline short clampReverb(int val) {
+    if (val < -32768L) val = -32768L;
+    if (val > 32767L) val = 32767L;
+    return (short)val;
+}
+
+#ifdef SPU_SSE2
+inline __m128i loadTaps(const short *p, const int *addr) {
+    return _mm_setr_epi32(p[addr[0]], p[addr[1]], p[addr[2]], p[addr[3]]);
+}
+
+inline void storeTaps(short *p, const int *addr, __m128i val) {
+    // the stores have to stay in order, in case taps are aliasing
+    val = _mm_packs_epi32(val, val);
+    p[addr[0]] = (short)_mm_extract_epi16(val, 0);
+    p[addr[1]] = (short)_mm_extract_epi16(val, 1);
+    p[addr[2]] = (short)_mm_extract_epi16(val, 2);
+    p[addr[3]] = (short)_mm_extract_epi16(val, 3);
+}
+
+inline __m128i mulCoef(__m128i a, __m128i b) { return PCSX::SPU::SIMD::div<15>(PCSX::SPU::SIMD::mullo32(a, b)); }
+#endif
+
+// One 22 khz step of the reverb steady-state algorithm described at the end of reverb.cc.
+// p is the work area moved forward by the steps already done in the current segment.
+void reverbStep(const PCSX::SPU::REVERBInfo &rvb, short *p, const int *addr, int inL, int inR, int *wetL, int *wetR) {
+#ifdef SPU_SSE2
+    using namespace PCSX::SPU::SIMD;
+    const __m128i in = _mm_setr_epi32(inL, inR, inL, inR);
+    const __m128i inCoef = _mm_setr_epi32(rvb.IN_COEF_L, rvb.IN_COEF_R, rvb.IN_COEF_L, rvb.IN_COEF_R);
+    const __m128i iirInput = _mm_add_epi32(mulCoef(loadTaps(p, addr + IIR_SRC), _mm_set1_epi32(rvb.IIR_COEF)),
+                                           mulCoef(in, inCoef));
+    const __m128i iir = _mm_add_epi32(mulCoef(iirInput, _mm_set1_epi32(rvb.IIR_ALPHA)),
+                                      mulCoef(loadTaps(p, addr + IIR_DEST), _mm_set1_epi32(32768 - rvb.IIR_ALPHA)));
+    storeTaps(p, addr + IIR_STORE, iir);
+
+    const __m128i accCoef = _mm_setr_epi32(rvb.ACC_COEF_A, rvb.ACC_COEF_B, rvb.ACC_COEF_C, rvb.ACC_COEF_D);
+    const int ACC0 = hsum(mulCoef(loadTaps(p, addr + ACC_SRC0), accCoef));
+    const int ACC1 = hsum(mulCoef(loadTaps(p, addr + ACC_SRC1), accCoef));
+
+    // lanes are MIX_DEST A0, A1, B0, B1
+    const __m128i fb = loadTaps(p, addr + FB_SRC);
+    const __m128i fbA = _mm_shuffle_epi32(fb, _MM_SHUFFLE(1, 0, 1, 0));
+    const __m128i fbB = _mm_and_si128(fb, _mm_setr_epi32(0, 0, -1, -1));
+    const __m128i acc = _mm_setr_epi32(ACC0, ACC1, ACC0, ACC1);
+    const __m128i isB = _mm_setr_epi32(0, 0, -1, -1);
+    const int fbx = (int)(rvb.FB_ALPHA ^ 0xFFFF8000);
+    const __m128i mixAcc =
+        _mm_or_si128(_mm_andnot_si128(isB, acc), _mm_and_si128(isB, mulCoef(acc, _mm_set1_epi32(rvb.FB_ALPHA))));
+    const __m128i mix =
+        _mm_sub_epi32(_mm_sub_epi32(mixAcc, mulCoef(fbA, _mm_setr_epi32(rvb.FB_ALPHA, rvb.FB_ALPHA, fbx, fbx))),
+                      mulCoef(fbB, _mm_set1_epi32(rvb.FB_X)));
+    storeTaps(p, addr + MIX_DEST, mix);
+#else
+    const int IIR_INPUT_A0 = (p[addr[IIR_SRC + 0]] * rvb.IIR_COEF) / 32768L + (inL * rvb.IN_COEF_L) / 32768L;
+    const int IIR_INPUT_A1 = (p[addr[IIR_SRC + 1]] * rvb.IIR_COEF) / 32768L + (inR * rvb.IN_COEF_R) / 32768L;
+    const int IIR_INPUT_B0 = (p[addr[IIR_SRC + 2]] * rvb.IIR_COEF) / 32768L + (inL * rvb.IN_COEF_L) / 32768L;
+    const int IIR_INPUT_B1 = (p[addr[IIR_SRC + 3]] * rvb.IIR_COEF) / 32768L + (inR * rvb.IN_COEF_R) / 32768L;
+
+    const int IIR_A0 =
+        (IIR_INPUT_A0 * rvb.IIR_ALPHA) / 32768L + (p[addr[IIR_DEST + 0]] * (32768L - rvb.IIR_ALPHA)) / 32768L;
+    const int IIR_A1 =
+        (IIR_INPUT_A1 * rvb.IIR_ALPHA) / 32768L + (p[addr[IIR_DEST + 1]] * (32768L - rvb.IIR_ALPHA)) / 32768L;
+    const int IIR_B0 =
+        (IIR_INPUT_B0 * rvb.IIR_ALPHA) / 32768L + (p[addr[IIR_DEST + 2]] * (32768L - rvb.IIR_ALPHA)) / 32768L;
+    const int IIR_B1 =
+        (IIR_INPUT_B1 * rvb.IIR_ALPHA) / 32768L + (p[addr[IIR_DEST + 3]] * (32768L - rvb.IIR_ALPHA)) / 32768L;
+
+    p[addr[IIR_STORE + 0]] = clampReverb(IIR_A0);
+    p[addr[IIR_STORE + 1]] = clampReverb(IIR_A1);
+    p[addr[IIR_STORE + 2]] = clampReverb(IIR_B0);
+    p[addr[IIR_STORE + 3]] = clampReverb(IIR_B1);
+
+    const int ACC0 = (p[addr[ACC_SRC0 + 0]] * rvb.ACC_COEF_A) / 32768L +
+                     (p[addr[ACC_SRC0 + 1]] * rvb.ACC_COEF_B) / 32768L +
+                     (p[addr[ACC_SRC0 + 2]] * rvb.ACC_COEF_C) / 32768L +
+                     (p[addr[ACC_SRC0 + 3]] * rvb.ACC_COEF_D) / 32768L;
+    const int ACC1 = (p[addr[ACC_SRC1 + 0]] * rvb.ACC_COEF_A) / 32768L +
+                     (p[addr[ACC_SRC1 + 1]] * rvb.ACC_COEF_B) / 32768L +
+                     (p[addr[ACC_SRC1 + 2]] * rvb.ACC_COEF_C) / 32768L +
+                     (p[addr[ACC_SRC1 + 3]] * rvb.ACC_COEF_D) / 32768L;
+
+    const int FB_A0 = p[addr[FB_SRC + 0]];
+    const int FB_A1 = p[addr[FB_SRC + 1]];
+    const int FB_B0 = p[addr[FB_SRC + 2]];
+    const int FB_B1 = p[addr[FB_SRC + 3]];
+
+    p[addr[MIX_DEST + 0]] = clampReverb(ACC0 - (FB_A0 * rvb.FB_ALPHA) / 32768L);
+    p[addr[MIX_DEST + 1]] = clampReverb(ACC1 - (FB_A1 * rvb.FB_ALPHA) / 32768L);
+    p[addr[MIX_DEST + 2]] = clampReverb((rvb.FB_ALPHA * ACC0) / 32768L -
+                                        (FB_A0 * (int)(rvb.FB_ALPHA ^ 0xFFFF8000)) / 32768L -
+                                        (FB_B0 * rvb.FB_X) / 32768L);
+    p[addr[MIX_DEST + 3]] = clampReverb((rvb.FB_ALPHA * ACC1) / 32768L -
+                                        (FB_A1 * (int)(rvb.FB_ALPHA ^ 0xFFFF8000)) / 32768L -
+                                        (FB_B1 * rvb.FB_X) / 32768L);
+#endif
+
+    *wetL = ((p[addr[MIX_DEST + 0]] + p[addr[MIX_DEST + 2]]) / 3 * rvb.VolLeft) / 0x4000;
+    *wetR = ((p[addr[MIX_DEST + 1]] + p[addr[MIX_DEST + 3]]) / 3 * rvb.VolRight) / 0x4000;
+}
+
+}  // namespace
+
+void PCSX::SPU::NeillReverb::mix(REVERBInfo &rvb, unsigned short *spuMem, const int *in, int *left, int *right,
+                                 unsigned count, int &counter, bool reverbOn,
+                                 const std::function<void(uint32_t, uint32_t)> &invalidate) {
+    const int start = rvb.StartAddr;
+    if (!start)  // reverb is off
+    {
+        rvb.iLastRVBLeft = rvb.iLastRVBRight = rvb.iRVBLeft = rvb.iRVBRight = 0;
+        return;
+    }
+
+    short *p = (short *)spuMem;
+    int taps[REVERB_TAPS];
+    int addr[REVERB_TAPS];
+    int curr = rvb.CurrAddr;
+    int run = 0;   // steps left before one of the taps, or the current address, wraps
+    int done = 0;  // steps done in the current segment
+
+    getReverbTaps(rvb, taps);
+
+    // the stores of a whole segment are contiguous, so the block cache gets invalidated once per segment
+    auto flushSegment = [&]() {
+        if (reverbOn && done) {
+            for (int i = 0; i < 4; i++) {
+                invalidate(addr[IIR_STORE + i] * 2, done * 2);
+                invalidate(addr[MIX_DEST + i] * 2, done * 2);
+            }
+        }
+        done = 0;
+    };
+
+    for (unsigned ns = 0; ns < count; ns++) {
+        if (++counter & 1)  // we work on every second sample: downsample to 22 khz
+        {
+            if (!run) run = mapReverbSegment(taps, curr, start, addr);
+
+            if (reverbOn) {
+                rvb.iLastRVBLeft = rvb.iRVBLeft;
+                rvb.iLastRVBRight = rvb.iRVBRight;
+                reverbStep(rvb, p + done, addr, in[ns << 1], in[(ns << 1) + 1], &rvb.iRVBLeft, &rvb.iRVBRight);
+                left[ns] += rvb.iLastRVBLeft + (rvb.iRVBLeft - rvb.iLastRVBLeft) / 2;
+            } else {
+                rvb.iLastRVBLeft = rvb.iLastRVBRight = rvb.iRVBLeft = rvb.iRVBRight = 0;
+            }
+
+            done++;
+            if (++curr > 0x3ffff) curr = start;
+            if (!--run) flushSegment();
+        } else {
+            left[ns] += rvb.iLastRVBLeft;
+        }
+
+        // the right side is just the last right reverb val, a little bit scaled by the previous one
+        right[ns] += rvb.iLastRVBRight + (rvb.iRVBRight - rvb.iLastRVBRight) / 2;
+        rvb.iLastRVBRight = rvb.iRVBRight;
+    }
+    flushSegment();
+
+    // a new reverb address may have been written meanwhile, which resets the current address
+    if (rvb.StartAddr == start) rvb.CurrAddr = curr;
+}
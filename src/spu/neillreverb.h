@@ -0,0 +1,47 @@
+/***************************************************************************
+ *   Copyright (C) 2019 PCSX-Redux authors                                 *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.           *
+ ***************************************************************************/
+
+#pragma once
+
+#include <stdint.h>
+
+#include <functional>
+
+#include "spu/types.h"
+
+namespace PCSX {
+
+namespace SPU {
+
+namespace NeillReverb {
+
+// Adds the reverb output of count samples at 44.1 khz into left and right, using Neill's algorithm from
+// the notes at the end of reverb.cc. in is the reverb input, interleaved L/R, and the work area sits in
+// spuMem from rvb.StartAddr to the end. The reverb runs at 22 khz, on every second sample, and counter
+// keeps track of that from one call to the next. While reverbOn is false the work area still moves
+// forward, but nothing gets processed. Every range of spuMem that gets written to is passed to
+// invalidate, as a byte address and size.
+void mix(REVERBInfo &rvb, unsigned short *spuMem, const int *in, int *left, int *right, unsigned count,
+         int &counter, bool reverbOn, const std::function<void(uint32_t, uint32_t)> &invalidate);
+
+}  // namespace NeillReverb
+
+}  // namespace SPU
+
+}  // namespace PCSX
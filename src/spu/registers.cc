@@ -192,7 +192,7 @@ void PCSX::SPU::impl::writeRegister(unsigned long reg, unsigned short val) {
                 //------------------------------------------------//
         }
 
-        iSpuAsyncWait = 0;
+        if (iSpuAsyncWait) ReleaseAsyncWait();
 
         return;
     }
@@ -205,6 +205,7 @@ void PCSX::SPU::impl::writeRegister(unsigned long reg, unsigned short val) {
         //-------------------------------------------------//
         case H_SPUdata:
             spuMem[spuAddr >> 1] = val;
+            m_blockCache.invalidate(spuAddr, 2);
             spuAddr += 2;
             if (spuAddr > 0x7ffff) spuAddr = 0;
             break;
@@ -424,7 +425,7 @@ void PCSX::SPU::impl::writeRegister(unsigned long reg, unsigned short val) {
             break;
     }
 
-    iSpuAsyncWait = 0;
+    if (iSpuAsyncWait) ReleaseAsyncWait();
 }
 
 ////////////////////////////////////////////////////////////////////////
@@ -434,7 +435,7 @@ void PCSX::SPU::impl::writeRegister(unsigned long reg, unsigned short val) {
 unsigned short PCSX::SPU::impl::readRegister(unsigned long reg) {
     const unsigned long r = reg & 0xfff;
 
-    iSpuAsyncWait = 0;
+    if (iSpuAsyncWait) ReleaseAsyncWait();
 
     if (r >= 0x0c00 && r < 0x0d80) {
         switch (r & 0x0f) {
@@ -506,6 +507,8 @@ void PCSX::SPU::impl::SoundOn(int start, int end, unsigned short val)  // SOUND
             dwNewChannel |= (1 << ch);  // bitfield for faster testing
         }
     }
+
+    if (dwNewChannel) m_sound.wakeUp();  // -> get the spu thread going right away
 }
 
 ////////////////////////////////////////////////////////////////////////
@@ -26,38 +26,42 @@
 #include "spu/sdlsound.h"
 
 
-void PCSX::SPU::SDLsound::dequeueLocked(uint8_t* stream, size_t len) {
-    if ((BUFFER_SIZE - s_ptrBegin) < len) {
-        size_t subLen = BUFFER_SIZE - s_ptrBegin;
-        dequeueLocked(stream, subLen);
-        len -= subLen;
-        dequeueLocked(stream + subLen, len);
+void PCSX::SPU::SDLsound::dequeue(uint8_t* stream, uint32_t begin, size_t len) {
+    size_t offset = begin & (BUFFER_SIZE - 1);
+    if ((BUFFER_SIZE - offset) < len) {
+        size_t subLen = BUFFER_SIZE - offset;
+        memcpy(stream, s_buffer + offset, subLen);
+        memcpy(stream + subLen, s_buffer, len - subLen);
         return;
     }
-    memcpy(stream, s_buffer + s_ptrBegin, len);
-    s_ptrBegin += len;
-    if (s_ptrBegin == BUFFER_SIZE) s_ptrBegin = 0;
+    memcpy(stream, s_buffer + offset, len);
 }
 
 void PCSX::SPU::SDLsound::callback(Uint8* stream, int len) {
-    SDL_LockMutex(s_mutex);
-    size_t available;
-    if (s_ptrEnd >= s_ptrBegin) {
-        available = s_ptrEnd - s_ptrBegin;
-    } else {
-        available = s_ptrEnd + BUFFER_SIZE - s_ptrBegin;
-    }
+    uint32_t begin = s_ptrBegin.load(std::memory_order_relaxed);
+    uint32_t end = s_ptrEnd.load(std::memory_order_acquire);
+    size_t available = end - begin;
 
     if (available < len) {
-        dequeueLocked(stream, available);
+        dequeue(stream, begin, available);
         memset(stream + available, 0, len - available);
     } else {
-        dequeueLocked(stream, len);
+        available = len;
+        dequeue(stream, begin, available);
     }
-    SDL_UnlockMutex(s_mutex);
+    s_ptrBegin.store(begin + available, std::memory_order_release);
+
+    if (s_producerWaiting.exchange(false)) SDL_SemPost(s_spaceAvailable);
 }
 
 void PCSX::SPU::SDLsound::setup() {
+    s_ptrBegin = 0;
+    s_ptrEnd = 0;
+    s_producerWaiting = false;
+    s_wakeRequested = false;
+    s_spaceAvailable = SDL_CreateSemaphore(0);
+    assert(s_spaceAvailable);
+
     SDL_zero(s_specs);
     s_specs.freq = 44100;
     s_specs.format = AUDIO_S16LSB;
@@ -68,48 +72,69 @@ void PCSX::SPU::SDLsound::setup() {
     s_dev = SDL_OpenAudioDevice(NULL, 0, &s_specs, NULL, 0 /* SDL_AUDIO_ALLOW_SAMPLES_CHANGE */);
     assert(s_dev);
     SDL_PauseAudioDevice(s_dev, 0);
-
-    s_mutex = SDL_CreateMutex();
-    assert(s_mutex);
 }
 
 void PCSX::SPU::SDLsound::remove() {
     SDL_CloseAudioDevice(s_dev);
-    SDL_DestroyMutex(s_mutex);
+    SDL_DestroySemaphore(s_spaceAvailable);
+    s_spaceAvailable = nullptr;
 }
 
 unsigned long PCSX::SPU::SDLsound::getBytesBuffered(void) {
-    unsigned long r;
+    uint32_t end = s_ptrEnd.load(std::memory_order_relaxed);
+    uint32_t begin = s_ptrBegin.load(std::memory_order_acquire);
 
-    SDL_LockMutex(s_mutex);
+    return end - begin;
+}
 
-    if (s_ptrEnd >= s_ptrBegin) {
-        r = s_ptrEnd - s_ptrBegin;
-    } else {
-        r = s_ptrEnd + BUFFER_SIZE - s_ptrBegin;
+bool PCSX::SPU::SDLsound::waitForSpace(unsigned long lBytes, uint32_t timeoutMs) {
+    if (lBytes > BUFFER_SIZE) lBytes = BUFFER_SIZE;
+    Uint32 deadline = SDL_GetTicks() + timeoutMs;
+
+    while ((BUFFER_SIZE - getBytesBuffered()) < lBytes) {
+        if (s_wakeRequested.exchange(false)) return false;
+        s_producerWaiting.store(true);
+        // the consumer may have drained the buffer between our check and raising the flag
+        if ((BUFFER_SIZE - getBytesBuffered()) >= lBytes) {
+            s_producerWaiting.store(false);
+            break;
+        }
+        Uint32 now = SDL_GetTicks();
+        if (now >= deadline) {
+            s_producerWaiting.store(false);
+            return false;
+        }
+        SDL_SemWaitTimeout(s_spaceAvailable, deadline - now);
     }
 
-    SDL_UnlockMutex(s_mutex);
+    return true;
+}
 
-    return r;
+void PCSX::SPU::SDLsound::wakeUp() {
+    s_wakeRequested.store(true);
+    if (s_spaceAvailable) SDL_SemPost(s_spaceAvailable);
 }
 
-void PCSX::SPU::SDLsound::enqueueLocked(const uint8_t* data, size_t len) {
-    if (len > (BUFFER_SIZE - s_ptrEnd)) {
-        size_t subLen = BUFFER_SIZE - s_ptrEnd;
-        enqueueLocked(data, subLen);
-        len -= subLen;
-        enqueueLocked(data + subLen, len);
+void PCSX::SPU::SDLsound::enqueue(const uint8_t* data, uint32_t end, size_t len) {
+    size_t offset = end & (BUFFER_SIZE - 1);
+    if (len > (BUFFER_SIZE - offset)) {
+        size_t subLen = BUFFER_SIZE - offset;
+        memcpy(s_buffer + offset, data, subLen);
+        memcpy(s_buffer, data + subLen, len - subLen);
         return;
     }
 
-    memcpy(s_buffer + s_ptrEnd, data, len);
-    s_ptrEnd += len;
-    if (s_ptrEnd == BUFFER_SIZE) s_ptrEnd = 0;
+    memcpy(s_buffer + offset, data, len);
 }
 
 void PCSX::SPU::SDLsound::feedStreamData(unsigned char* pSound, long lBytes) {
-    SDL_LockMutex(s_mutex);
-    enqueueLocked(pSound, lBytes);
-    SDL_UnlockMutex(s_mutex);
+    uint32_t end = s_ptrEnd.load(std::memory_order_relaxed);
+    uint32_t begin = s_ptrBegin.load(std::memory_order_acquire);
+    size_t space = BUFFER_SIZE - (end - begin);
+
+    // the consumer owns the read pointer, so on overflow we drop the newest data instead
+    if (static_cast<size_t>(lBytes) > space) lBytes = space;
+
+    enqueue(pSound, end, lBytes);
+    s_ptrEnd.store(end + lBytes, std::memory_order_release);
 }
@@ -21,6 +21,8 @@
 
 #include <SDL.h>
 
+#include <atomic>
+
 namespace PCSX {
 
 namespace SPU {
@@ -31,24 +33,36 @@ class SDLsound {
     void remove();
     unsigned long getBytesBuffered();
     void feedStreamData(unsigned char* pSound, long lBytes);
+    unsigned long getCapacity() { return BUFFER_SIZE; }
+    // blocks the producer until at least lBytes can be queued; returns false if the
+    // timeout expires or if wakeUp() interrupted the wait
+    bool waitForSpace(unsigned long lBytes, uint32_t timeoutMs);
+    void wakeUp();
 
   private:
-
     void callback(Uint8* stream, int len);
     static void callbackTrampoline(void* userdata, Uint8* stream, int len) {
         SDLsound* that = static_cast<SDLsound*>(userdata);
         that->callback(stream, len);
     }
-    void dequeueLocked(uint8_t* stream, size_t len);
-    void enqueueLocked(const uint8_t* data, size_t len);
+    void dequeue(uint8_t* stream, uint32_t begin, size_t len);
+    void enqueue(const uint8_t* data, uint32_t end, size_t len);
 
+    // single producer (the SPU thread), single consumer (the SDL audio callback);
+    // the indices are free running and wrapped with BUFFER_SIZE, which has to be a power of 2
     static const size_t BUFFER_SIZE = 32 * 1024 * 4;
+    static_assert((BUFFER_SIZE & (BUFFER_SIZE - 1)) == 0, "BUFFER_SIZE must be a power of 2");
+    static const size_t CACHE_LINE = 64;
+
+    alignas(CACHE_LINE) std::atomic<uint32_t> s_ptrBegin = 0;  // written by the consumer only
+    alignas(CACHE_LINE) std::atomic<uint32_t> s_ptrEnd = 0;    // written by the producer only
+    alignas(CACHE_LINE) std::atomic<bool> s_producerWaiting = false;
+    std::atomic<bool> s_wakeRequested = false;
+    SDL_sem* s_spaceAvailable = nullptr;
 
     SDL_AudioDeviceID s_dev;
-    uint32_t s_ptrBegin = 0, s_ptrEnd = 0;
-    uint8_t s_buffer[BUFFER_SIZE];
-    SDL_mutex* s_mutex;
     SDL_AudioSpec s_specs;
+    alignas(CACHE_LINE) uint8_t s_buffer[BUFFER_SIZE];
 };
 
 }  // namespace SPU
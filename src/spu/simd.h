@@ -0,0 +1,65 @@
+/***************************************************************************
+ *   Copyright (C) 2019 PCSX-Redux authors                                 *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.           *
+ ***************************************************************************/
+
+#pragma once
+
+// SSE2 is always there on x86-64, and can be enabled on 32 bits builds; PCSX_NO_SIMD builds the
+// portable code only, for tools/kernelcheck to compare against
+#if !defined(PCSX_NO_SIMD) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define SPU_SSE2 1
+#endif
+
+#ifdef SPU_SSE2
+#include <emmintrin.h>
+
+namespace PCSX {
+
+namespace SPU {
+
+namespace SIMD {
+
+// SSE2 has no 32x32->32 multiply; the low half of the unsigned products is the same as the signed one,
+// which also means overflows wrap around the same way the scalar code does
+inline __m128i mullo32(__m128i a, __m128i b) {
+    __m128i even = _mm_mul_epu32(a, b);
+    __m128i odd = _mm_mul_epu32(_mm_srli_si128(a, 4), _mm_srli_si128(b, 4));
+    return _mm_unpacklo_epi32(_mm_shuffle_epi32(even, _MM_SHUFFLE(0, 0, 2, 0)),
+                              _mm_shuffle_epi32(odd, _MM_SHUFFLE(0, 0, 2, 0)));
+}
+
+// signed division by (1 << shift), rounding towards zero like the C operator does
+template <int shift>
+inline __m128i div(__m128i v) {
+    __m128i bias = _mm_srli_epi32(_mm_srai_epi32(v, 31), 32 - shift);
+    return _mm_srai_epi32(_mm_add_epi32(v, bias), shift);
+}
+
+inline int hsum(__m128i v) {
+    v = _mm_add_epi32(v, _mm_shuffle_epi32(v, _MM_SHUFFLE(1, 0, 3, 2)));
+    v = _mm_add_epi32(v, _mm_shuffle_epi32(v, _MM_SHUFFLE(2, 3, 0, 1)));
+    return _mm_cvtsi128_si32(v);
+}
+
+}  // namespace SIMD
+
+}  // namespace SPU
+
+}  // namespace PCSX
+
+#endif
@@ -96,10 +96,15 @@
 //#include "stdafx.h"
 #include <SDL.h>
 
+#include "core/adpcm.h"
+#include "core/profiler.h"
+#include "core/psxemulator.h"
 #include "spu/adsr.h"
+#include "spu/blockcache.h"
 #include "spu/externals.h"
 #include "spu/gauss.h"
 #include "spu/interface.h"
+#include "spu/mixer.h"
 #include "spu/sdlsound.h"
 
 ////////////////////////////////////////////////////////////////////////
@@ -404,337 +409,353 @@ inline int PCSX::SPU::impl::iGetInterpolationVal(SPUCHAN *pChannel) {
 // MAIN SPU FUNCTION
 // here is the main job handler... thread, timer or direct func call
 // basically the whole sound processing is done in this fat func!
+// each call mixes 1 ms of sound data (NSSIZE samples) at pS
 ////////////////////////////////////////////////////////////////////////
 
-// 5 ms waiting phase, if buffer is full and no new sound has to get started
-// .. can be made smaller (smallest val: 1 ms), but bigger waits give
-// better performance
-
-#define PAUSE_W 5
-#define PAUSE_L 5000
-
-////////////////////////////////////////////////////////////////////////
-
-void PCSX::SPU::impl::MainThread() {
+void PCSX::SPU::impl::MixBlock() {
     int s_1, s_2, fa, ns, voldiv = settings.get<Volume>();
     unsigned char *start;
-    unsigned int nSample;
-    int ch, predict_nr, shift_factor, flags, d, s;
+    int ch, flags, d;
     int bIRQReturn = 0;
+    bool silent = false;
+    ADSRInfoEx adsrStart;
     SPUCHAN *pChannel;
 
-    SDL_SetThreadPriority(SDL_THREAD_PRIORITY_HIGH);
+    //--------------------------------------------------// continue from irq handling in timer mode?
 
-    while (!bEndThread)  // until we are shutting down
+    if (lastch >= 0)  // will be -1 if no continue is pending
     {
-        //--------------------------------------------------//
-        // ok, at the beginning we are looking if there is
-        // enuff free place in the dsound/oss buffer to
-        // fill in new data, or if there is a new channel to start.
-        // if not, we wait (thread) or return (timer/spuasync)
-        // until enuff free place is available/a new channel gets
-        // started
-
-        if (dwNewChannel)    // new channel should start immedately?
-        {                    // (at least one bit 0 ... MAXCHANNEL is set?)
-            iSecureStart++;  // -> set iSecure
-            if (iSecureStart > 5)
-                iSecureStart = 0;  //    (if it is set 5 times - that means on 5 tries a new samples has been started -
-                                   //    in a row, we will reset it, to give the sound update a chance)
-        } else
-            iSecureStart = 0;  // 0: no new channel should start
+        ch = lastch;
+        ns = lastns;
+        lastch = -1;  // -> setup all kind of vars to continue
+        pChannel = &s_chan[ch];
+        goto GOON;  // -> directly jump to the continue point
+    }
 
-        while (!iSecureStart && !bEndThread &&        // no new start? no thread end?
-               (m_sound.getBytesBuffered() > TESTSIZE))  // and still enuff data in sound buffer?
+    //--------------------------------------------------//
+    //- main channel loop                              -//
+    //--------------------------------------------------//
+    {
+        pChannel = s_chan;
+        for (ch = 0; ch < MAXCHAN;
+             ch++, pChannel++)  // loop em all... we will collect 1 ms of sound of each playing channel
         {
-            iSecureStart = 0;  // reset secure
+            if (pChannel->bNew) {
+                StartSound(pChannel);        // start new sound
+                dwNewChannel &= ~(1 << ch);  // clear new channel bit
+            }
 
-            SDL_Delay(PAUSE_W);  // sleep for x ms
+            m_voices.count[ch] = 0;
+            if (!pChannel->bOn) continue;  // channel not playing? next
+
+            if (pChannel->iActFreq != pChannel->iUsedFreq)  // new psx frequency?
+                VoiceChangeFrequency(pChannel);
+
+            // the envelope of the whole block is computed upfront; if it stays at zero, or if the voice
+            // can't be heard anyway, only what has side effects still runs below: sample position,
+            // decoding, irq and loop checks, noise generator
+            adsrStart = pChannel->ADSRX;
+            silent = !m_adsr.mix(pChannel, m_voices.envelope, NSSIZE);
+            m_voices.leftVolume[ch] = pChannel->iLeftVolume;
+            m_voices.rightVolume[ch] = pChannel->iRightVolume;
+            if (pChannel->bFMod != 2 &&
+                (pChannel->iMute || (!m_voices.leftVolume[ch] && !m_voices.rightVolume[ch])))
+                silent = true;
+
+            ns = 0;
+            while (ns < NSSIZE)  // loop until 1 ms of data is reached
+            {
+                if (pChannel->bFMod == 1 && iFMod[ns])  // fmod freq channel
+                    FModChangeFrequency(pChannel, ns);
 
-            if (dwNewChannel)
-                iSecureStart =
-                    1;  // if a new channel kicks in (or, of course, sound buffer runs low), we will leave the loop
-        }
+                while (pChannel->spos >= 0x10000L) {
+                    if (pChannel->iSBPos == 28)  // 28 reached?
+                    {
+                        start = pChannel->pCurr;  // set up the current pos
 
-        //--------------------------------------------------// continue from irq handling in timer mode?
+                        if (start == (unsigned char *)-1)  // special "stop" sign
+                        {
+                            pChannel->bOn = 0;  // -> turn everything off
+                            pChannel->ADSRX = adsrStart;  // -> the envelope only ran until here
+                            m_adsr.mix(pChannel, nullptr, ns);
+                            pChannel->ADSRX.lVolume = 0;
+                            pChannel->ADSRX.EnvelopeVol = 0;
+                            goto ENDX;  // -> and done for this channel
+                        }
 
-        if (lastch >= 0)  // will be -1 if no continue is pending
-        {
-            ch = lastch;
-            ns = lastns;
-            lastch = -1;  // -> setup all kind of vars to continue
-            pChannel = &s_chan[ch];
-            goto GOON;  // -> directly jump to the continue point
-        }
+                        pChannel->iSBPos = 0;
 
-        //--------------------------------------------------//
-        //- main channel loop                              -//
-        //--------------------------------------------------//
-        {
-            pChannel = s_chan;
-            for (ch = 0; ch < MAXCHAN;
-                 ch++, pChannel++)  // loop em all... we will collect 1 ms of sound of each playing channel
-            {
-                if (pChannel->bNew) {
-                    StartSound(pChannel);        // start new sound
-                    dwNewChannel &= ~(1 << ch);  // clear new channel bit
-                }
+                        //////////////////////////////////////////// spu irq handler here? mmm... do it later
 
-                if (!pChannel->bOn) continue;  // channel not playing? next
+                        s_1 = pChannel->s_1;
+                        s_2 = pChannel->s_2;
 
-                if (pChannel->iActFreq != pChannel->iUsedFreq)  // new psx frequency?
-                    VoiceChangeFrequency(pChannel);
+                        flags = (int)start[1];
 
-                ns = 0;
-                while (ns < NSSIZE)  // loop until 1 ms of data is reached
-                {
-                    if (pChannel->bFMod == 1 && iFMod[ns])  // fmod freq channel
-                        FModChangeFrequency(pChannel, ns);
+                        // -------------------------------------- //
 
-                    while (pChannel->spos >= 0x10000L) {
-                        if (pChannel->iSBPos == 28)  // 28 reached?
+                        m_blockCache.decode(spuMemC, start - spuMemC, pChannel->SB, &s_1, &s_2);
+                        start += ADPCM::BLOCK_SIZE;
+
+                        //////////////////////////////////////////// irq check
+
+                        if (irqCallback && (spuCtrl & 0x40))  // some callback and irq active?
                         {
-                            start = pChannel->pCurr;  // set up the current pos
-
-                            if (start == (unsigned char *)-1)  // special "stop" sign
-                            {
-                                pChannel->bOn = 0;  // -> turn everything off
-                                pChannel->ADSRX.lVolume = 0;
-                                pChannel->ADSRX.EnvelopeVol = 0;
-                                goto ENDX;  // -> and done for this channel
+                            if ((pSpuIrq > start - 16 &&  // irq address reached?
+                                 pSpuIrq <= start) ||
+                                ((flags & 1) &&  // special: irq on looping addr, when stop/loop flag is set
+                                 (pSpuIrq > pChannel->pLoop - 16 && pSpuIrq <= pChannel->pLoop))) {
+                                pChannel->iIrqDone = 1;  // -> debug flag
+                                irqCallback();           // -> call main emu
+
+                                // -> option: wait after irq for main emu; not in synchronous mode, where the
+                                // main emu is the one running this
+                                if (settings.get<SPUIRQWait>() && !m_sink) {
+                                    iSpuAsyncWait = 1;
+                                    bIRQReturn = 1;
+                                }
                             }
+                        }
 
-                            pChannel->iSBPos = 0;
-
-                            //////////////////////////////////////////// spu irq handler here? mmm... do it later
+                        //////////////////////////////////////////// flag handler
 
-                            s_1 = pChannel->s_1;
-                            s_2 = pChannel->s_2;
+                        if ((flags & 4) && (!pChannel->bIgnoreLoop)) pChannel->pLoop = start - 16;  // loop adress
 
-                            predict_nr = (int)*start;
-                            start++;
-                            shift_factor = predict_nr & 0xf;
-                            predict_nr >>= 4;
-                            flags = (int)*start;
-                            start++;
+                        if (flags & 1)  // 1: stop/loop
+                        {
+                            // We play this block out first...
+                            // if(!(flags&2))                          // 1+2: do loop... otherwise: stop
+                            if (flags != 3 ||
+                                pChannel->pLoop == NULL)  // PETE: if we don't check exactly for 3, loop hang ups
+                                                          // will happen (DQ4, for example)
+                            {                             // and checking if pLoop is set avoids crashes, yeah
+                                start = (unsigned char *)-1;
+                            } else {
+                                start = pChannel->pLoop;
+                            }
+                        }
 
-                            // -------------------------------------- //
+                        pChannel->pCurr = start;  // store values for next cycle
+                        pChannel->s_1 = s_1;
+                        pChannel->s_2 = s_2;
 
-                            for (nSample = 0; nSample < 28; start++) {
-                                d = (int)*start;
-                                s = ((d & 0xf) << 12);
-                                if (s & 0x8000) s |= 0xffff0000;
+                        ////////////////////////////////////////////
 
-                                fa = (s >> shift_factor);
-                                fa = fa + ((s_1 * f[predict_nr][0]) >> 6) + ((s_2 * f[predict_nr][1]) >> 6);
-                                s_2 = s_1;
-                                s_1 = fa;
-                                s = ((d & 0xf0) << 8);
+                        if (bIRQReturn)  // special return for "spu irq - wait for cpu action"
+                        {
+                            bIRQReturn = 0;
+                            Uint32 dwWatchTime = SDL_GetTicks() + 2500;
+
+                            SDL_LockMutex(m_asyncWaitMutex);
+                            while (iSpuAsyncWait && !bEndThread) {
+                                Uint32 dwNow = SDL_GetTicks();
+                                if (dwNow >= dwWatchTime) break;
+                                SDL_CondWaitTimeout(m_asyncWaitCond, m_asyncWaitMutex, dwWatchTime - dwNow);
+                            }
+                            SDL_UnlockMutex(m_asyncWaitMutex);
+                        }
 
-                                pChannel->SB[nSample++] = fa;
+                        ////////////////////////////////////////////
 
-                                if (s & 0x8000) s |= 0xffff0000;
-                                fa = (s >> shift_factor);
-                                fa = fa + ((s_1 * f[predict_nr][0]) >> 6) + ((s_2 * f[predict_nr][1]) >> 6);
-                                s_2 = s_1;
-                                s_1 = fa;
+                    GOON:;
+                    }
 
-                                pChannel->SB[nSample++] = fa;
-                            }
+                    fa = pChannel->SB[pChannel->iSBPos++];  // get sample data
 
-                            //////////////////////////////////////////// irq check
-
-                            if (irqCallback && (spuCtrl & 0x40))  // some callback and irq active?
-                            {
-                                if ((pSpuIrq > start - 16 &&  // irq address reached?
-                                     pSpuIrq <= start) ||
-                                    ((flags & 1) &&  // special: irq on looping addr, when stop/loop flag is set
-                                     (pSpuIrq > pChannel->pLoop - 16 && pSpuIrq <= pChannel->pLoop))) {
-                                    pChannel->iIrqDone = 1;  // -> debug flag
-                                    irqCallback();           // -> call main emu
-
-                                    if (settings.get<SPUIRQWait>())  // -> option: wait after irq for main emu
-                                    {
-                                        iSpuAsyncWait = 1;
-                                        bIRQReturn = 1;
-                                    }
-                                }
-                            }
+                    StoreInterpolationVal(pChannel, fa);  // store val for later interpolation
 
-                            //////////////////////////////////////////// flag handler
-
-                            if ((flags & 4) && (!pChannel->bIgnoreLoop)) pChannel->pLoop = start - 16;  // loop adress
-
-                            if (flags & 1)  // 1: stop/loop
-                            {
-                                // We play this block out first...
-                                // if(!(flags&2))                          // 1+2: do loop... otherwise: stop
-                                if (flags != 3 ||
-                                    pChannel->pLoop == NULL)  // PETE: if we don't check exactly for 3, loop hang ups
-                                                              // will happen (DQ4, for example)
-                                {                             // and checking if pLoop is set avoids crashes, yeah
-                                    start = (unsigned char *)-1;
-                                } else {
-                                    start = pChannel->pLoop;
-                                }
-                            }
+                    pChannel->spos -= 0x10000L;
+                }
 
-                            pChannel->pCurr = start;  // store values for next cycle
-                            pChannel->s_1 = s_1;
-                            pChannel->s_2 = s_2;
+                ////////////////////////////////////////////////
 
-                            ////////////////////////////////////////////
+                if (pChannel->bNoise)
+                    fa = iGetNoiseVal(pChannel);  // get noise val
+                else if (!silent || (settings.get<Interpolation>() == 1 && pChannel->bFMod != 2))
+                    fa = iGetInterpolationVal(pChannel);  // get sample val (simple interpolation keeps state)
+                else
+                    fa = 0;
 
-                            if (bIRQReturn)  // special return for "spu irq - wait for cpu action"
-                            {
-                                bIRQReturn = 0;
-                                Uint32 dwWatchTime = SDL_GetTicks() + 2500;
+                pChannel->sval = (m_voices.envelope[ns] * fa) / 1023;  // mix adsr
 
-                                while (iSpuAsyncWait && !bEndThread && SDL_GetTicks() < dwWatchTime) SDL_Delay(1);
-                            }
+                if (pChannel->bFMod == 2)        // fmod freq channel
+                    iFMod[ns] = pChannel->sval;  // -> store 1T sample data, use that to do fmod on next channel
+                else if (pChannel->iMute)
+                    pChannel->sval = 0;  // debug mute
 
-                            ////////////////////////////////////////////
+                m_voices.sval[ch][ns] = pChannel->sval;  // -> volume and reverb get applied on the whole block
 
-                        GOON:;
-                        }
+                ////////////////////////////////////////////////
+                // ok, go on until 1 ms data of this channel is collected
 
-                        fa = pChannel->SB[pChannel->iSBPos++];  // get sample data
+                ns++;
+                pChannel->spos += pChannel->sinc;
+            }
+        ENDX:
+            m_voices.count[ch] = silent ? 0 : ns;
+        }
+    }
 
-                        StoreInterpolationVal(pChannel, fa);  // store val for later interpolation
+    //--------------------------------------------------//
+    //- block mixing: apply the left/right volumes     -//
+    //- (psx volume goes from 0 ... 0x3fff) and store  -//
+    //- the reverb data, one whole voice at a time     -//
+    //--------------------------------------------------//
+    {
+        pChannel = s_chan;
+        for (ch = 0; ch < MAXCHAN; ch++, pChannel++) {
+            const int count = m_voices.count[ch];
+            if (!count) continue;
+            if (pChannel->bFMod == 2 || pChannel->iMute) continue;  // fmod freq channels are not heard
 
-                        pChannel->spos -= 0x10000L;
-                    }
+            Mixer::mixVoice(SSumL, SSumR, m_voices.sval[ch], m_voices.leftVolume[ch], m_voices.rightVolume[ch],
+                            count);
 
-                    ////////////////////////////////////////////////
+            if (pChannel->bRVBActive)
+                StoreREVERB(pChannel, m_voices.sval[ch], m_voices.leftVolume[ch], m_voices.rightVolume[ch], count);
+        }
+    }
 
-                    if (pChannel->bNoise)
-                        fa = iGetNoiseVal(pChannel);  // get noise val
-                    else
-                        fa = iGetInterpolationVal(pChannel);  // get sample val
+    //---------------------------------------------------//
+    //- here we have another 1 ms of sound data
+    //---------------------------------------------------//
+    // mix XA infos (if any)
 
-                    pChannel->sval = (m_adsr.mix(pChannel) * fa) / 1023;  // mix adsr
+    if (XAPlay != XAFeed || XARepeat) MixXA();
 
-                    if (pChannel->bFMod == 2)        // fmod freq channel
-                        iFMod[ns] = pChannel->sval;  // -> store 1T sample data, use that to do fmod on next channel
-                    else                             // no fmod freq channel
-                    {
-                        //////////////////////////////////////////////
-                        // ok, left/right sound volume (psx volume goes from 0 ... 0x3fff)
-
-                        if (pChannel->iMute)
-                            pChannel->sval = 0;  // debug mute
-                        else {
-                            SSumL[ns] += (pChannel->sval * pChannel->iLeftVolume) / 0x4000L;
-                            SSumR[ns] += (pChannel->sval * pChannel->iRightVolume) / 0x4000L;
-                        }
+    // add the reverb output of the whole 1 ms block
 
-                        //////////////////////////////////////////////
-                        // now let us store sound data for reverb
+    MixREVERB();
 
-                        if (pChannel->bRVBActive) StoreREVERB(pChannel, ns);
-                    }
+    ///////////////////////////////////////////////////////
+    // mix all channels (including reverb) into one buffer
 
-                    ////////////////////////////////////////////////
-                    // ok, go on until 1 ms data of this channel is collected
+    if (settings.get<Mono>())  // no stereo?
+    {
+        int dl, dr;
+        for (ns = 0; ns < NSSIZE; ns++) {
+            dl = SSumL[ns] / voldiv;
+            SSumL[ns] = 0;
+            if (dl < -32767) dl = -32767;
+            if (dl > 32767) dl = 32767;
+
+            dr = SSumR[ns] / voldiv;
+            SSumR[ns] = 0;
+            if (dr < -32767) dr = -32767;
+            if (dr > 32767) dr = 32767;
+            *pS++ = (dl + dr) / 2;
+        }
+    } else  // stereo:
+        for (ns = 0; ns < NSSIZE; ns++) {
+            d = SSumL[ns] / voldiv;
+            SSumL[ns] = 0;
+            if (d < -32767) d = -32767;
+            if (d > 32767) d = 32767;
+            *pS++ = d;
+
+            d = SSumR[ns] / voldiv;
+            SSumR[ns] = 0;
+            if (d < -32767) d = -32767;
+            if (d > 32767) d = 32767;
+            *pS++ = d;
+        }
 
-                    ns++;
-                    pChannel->spos += pChannel->sinc;
+    //////////////////////////////////////////////////////
+    // special irq handling in the decode buffers (0x0000-0x1000)
+    // we know:
+    // the decode buffers are located in spu memory in the following way:
+    // 0x0000-0x03ff  CD audio left
+    // 0x0400-0x07ff  CD audio right
+    // 0x0800-0x0bff  Voice 1
+    // 0x0c00-0x0fff  Voice 3
+    // and decoded data is 16 bit for one sample
+    // we assume:
+    // even if voices 1/3 are off or no cd audio is playing, the internal
+    // play positions will move on and wrap after 0x400 bytes.
+    // Therefore: we just need a pointer from spumem+0 to spumem+3ff, and
+    // increase this pointer on each sample by 2 bytes. If this pointer
+    // (or 0x400 offsets of this pointer) hits the spuirq address, we generate
+    // an IRQ. Only problem: the "wait for cpu" option is kinda hard to do here
+    // in some of Peops timer modes. So: we ignore this option here (for now).
+    // Also note: we abuse the channel 0-3 irq debug display for those irqs
+    // (since that's the easiest way to display such irqs in debug mode :))
+
+    if (pMixIrq && irqCallback)  // pMixIRQ will only be set, if the config option is active
+    {
+        for (ns = 0; ns < NSSIZE; ns++) {
+            if ((spuCtrl & 0x40) && pSpuIrq && pSpuIrq < spuMemC + 0x1000) {
+                for (ch = 0; ch < 4; ch++) {
+                    if (pSpuIrq >= pMixIrq + (ch * 0x400) && pSpuIrq < pMixIrq + (ch * 0x400) + 2) {
+                        irqCallback();
+                        s_chan[ch].iIrqDone = 1;
+                    }
                 }
-            ENDX:;
             }
+            pMixIrq += 2;
+            if (pMixIrq > spuMemC + 0x3ff) pMixIrq = spuMemC;
         }
+    }
 
-        //---------------------------------------------------//
-        //- here we have another 1 ms of sound data
-        //---------------------------------------------------//
-        // mix XA infos (if any)
+    InitREVERB();
+}
 
-        if (XAPlay != XAFeed || XARepeat) MixXA();
+////////////////////////////////////////////////////////////////////////
+// SPU THREAD: keeps the sound device fed
+////////////////////////////////////////////////////////////////////////
 
-        ///////////////////////////////////////////////////////
-        // mix all channels (including reverb) into one buffer
+// the thread sleeps until the sound device drained the buffer under TESTSIZE,
+// or until a new channel has to get started; PAUSE_W is only a safety net,
+// in case no wake up ever comes (sound device lost, for example)
 
-        if (settings.get<Mono>())  // no stereo?
-        {
-            int dl, dr;
-            for (ns = 0; ns < NSSIZE; ns++) {
-                SSumL[ns] += MixREVERBLeft(ns);
-
-                dl = SSumL[ns] / voldiv;
-                SSumL[ns] = 0;
-                if (dl < -32767) dl = -32767;
-                if (dl > 32767) dl = 32767;
-
-                SSumR[ns] += MixREVERBRight();
-
-                dr = SSumR[ns] / voldiv;
-                SSumR[ns] = 0;
-                if (dr < -32767) dr = -32767;
-                if (dr > 32767) dr = 32767;
-                *pS++ = (dl + dr) / 2;
-            }
-        } else  // stereo:
-            for (ns = 0; ns < NSSIZE; ns++) {
-                SSumL[ns] += MixREVERBLeft(ns);
-
-                d = SSumL[ns] / voldiv;
-                SSumL[ns] = 0;
-                if (d < -32767) d = -32767;
-                if (d > 32767) d = 32767;
-                *pS++ = d;
-
-                SSumR[ns] += MixREVERBRight();
-
-                d = SSumR[ns] / voldiv;
-                SSumR[ns] = 0;
-                if (d < -32767) d = -32767;
-                if (d > 32767) d = 32767;
-                *pS++ = d;
-            }
+#define PAUSE_W 50
+#define PAUSE_L 5000
 
-        //////////////////////////////////////////////////////
-        // special irq handling in the decode buffers (0x0000-0x1000)
-        // we know:
-        // the decode buffers are located in spu memory in the following way:
-        // 0x0000-0x03ff  CD audio left
-        // 0x0400-0x07ff  CD audio right
-        // 0x0800-0x0bff  Voice 1
-        // 0x0c00-0x0fff  Voice 3
-        // and decoded data is 16 bit for one sample
-        // we assume:
-        // even if voices 1/3 are off or no cd audio is playing, the internal
-        // play positions will move on and wrap after 0x400 bytes.
-        // Therefore: we just need a pointer from spumem+0 to spumem+3ff, and
-        // increase this pointer on each sample by 2 bytes. If this pointer
-        // (or 0x400 offsets of this pointer) hits the spuirq address, we generate
-        // an IRQ. Only problem: the "wait for cpu" option is kinda hard to do here
-        // in some of Peops timer modes. So: we ignore this option here (for now).
-        // Also note: we abuse the channel 0-3 irq debug display for those irqs
-        // (since that's the easiest way to display such irqs in debug mode :))
-
-        if (pMixIrq && irqCallback)  // pMixIRQ will only be set, if the config option is active
+////////////////////////////////////////////////////////////////////////
+
+void PCSX::SPU::impl::MainThread() {
+    SDL_SetThreadPriority(SDL_THREAD_PRIORITY_HIGH);
+
+    while (!bEndThread)  // until we are shutting down
+    {
+        //--------------------------------------------------//
+        // ok, at the beginning we are looking if there is
+        // enuff free place in the dsound/oss buffer to
+        // fill in new data, or if there is a new channel to start.
+        // if not, we wait (thread) or return (timer/spuasync)
+        // until enuff free place is available/a new channel gets
+        // started
+
+        if (dwNewChannel)    // new channel should start immedately?
+        {                    // (at least one bit 0 ... MAXCHANNEL is set?)
+            iSecureStart++;  // -> set iSecure
+            if (iSecureStart > 5)
+                iSecureStart = 0;  //    (if it is set 5 times - that means on 5 tries a new samples has been started -
+                                   //    in a row, we will reset it, to give the sound update a chance)
+        } else
+            iSecureStart = 0;  // 0: no new channel should start
+
+        while (!iSecureStart && !bEndThread &&        // no new start? no thread end?
+               (m_sound.getBytesBuffered() > TESTSIZE))  // and still enuff data in sound buffer?
         {
-            for (ns = 0; ns < NSSIZE; ns++) {
-                if ((spuCtrl & 0x40) && pSpuIrq && pSpuIrq < spuMemC + 0x1000) {
-                    for (ch = 0; ch < 4; ch++) {
-                        if (pSpuIrq >= pMixIrq + (ch * 0x400) && pSpuIrq < pMixIrq + (ch * 0x400) + 2) {
-                            irqCallback();
-                            s_chan[ch].iIrqDone = 1;
-                        }
-                    }
-                }
-                pMixIrq += 2;
-                if (pMixIrq > spuMemC + 0x3ff) pMixIrq = spuMemC;
-            }
+            iSecureStart = 0;  // reset secure
+
+            // sleep until the buffer runs low, or until SoundOn/RemoveThread wake us up
+            m_sound.waitForSpace(m_sound.getCapacity() - TESTSIZE, PAUSE_W);
+
+            if (dwNewChannel)
+                iSecureStart =
+                    1;  // if a new channel kicks in (or, of course, sound buffer runs low), we will leave the loop
         }
 
-        InitREVERB();
+        MixBlock();
 
         //////////////////////////////////////////////////////
         // feed the sound
         // wanna have around 1/60 sec (16.666 ms) updates
 
-        if (iCycle++ > 16) {
+        // when the sound device is about to run dry, we don't wait for the usual
+        // 1/60 sec batch, and hand over each ms of data as soon as it's mixed
+        if (iCycle++ > 16 || m_sound.getBytesBuffered() < TESTSIZE) {
             //- zn qsound mixer callback ----------------------//
 
             if (irqQSound) {
@@ -751,7 +772,20 @@ void PCSX::SPU::impl::MainThread() {
 
             //-------------------------------------------------//
 
-            m_sound.feedStreamData((unsigned char *)pSpuBuffer, ((unsigned char *)pS) - ((unsigned char *)pSpuBuffer));
+            // at an alternate speed we mix that much faster than the device plays, so the
+            // stretcher brings the stream back to real time without changing its pitch
+            uint32_t speed = g_emulator->speed();
+            if (speed == 100) {
+                m_stretch.clear();
+                m_sound.feedStreamData((unsigned char *)pSpuBuffer,
+                                       ((unsigned char *)pS) - ((unsigned char *)pSpuBuffer));
+            } else {
+                const unsigned channels = settings.get<Mono>() ? 1 : 2;
+                m_stretch.setTempo(speed);
+                size_t frames = (pS - (short *)pSpuBuffer) / channels;
+                auto &stretched = m_stretch.process((short *)pSpuBuffer, frames, channels);
+                m_sound.feedStreamData((unsigned char *)stretched.data(), stretched.size() * sizeof(short));
+            }
             pS = (short *)pSpuBuffer;
             iCycle = 0;
         }
@@ -771,14 +805,56 @@ void PCSX::SPU::impl::MainThread() {
 //  1 time every 'cycle' cycles... harhar
 ////////////////////////////////////////////////////////////////////////
 
-void PCSX::SPU::impl::async(uint32_t cycle) {
+void PCSX::SPU::impl::async(uint32_t cycle, uint32_t cyclesPerSecond) {
+    Profiler::Scope profile(Profiler::SPU);
+    if (m_sink) {
+        SyncMix(cycle, cyclesPerSecond);
+        return;
+    }
+
     if (iSpuAsyncWait) {
-        iSpuAsyncWait++;
-        if (iSpuAsyncWait <= 64) return;
-        iSpuAsyncWait = 0;
+        if (++iSpuAsyncWait <= 64) return;
+        ReleaseAsyncWait();
+    }
+}
+
+////////////////////////////////////////////////////////////////////////
+// SYNCHRONOUS MODE: mixes as many samples as the emulated cycles are worth
+////////////////////////////////////////////////////////////////////////
+
+// cyclesPerSecond is the emulated clock as seen by the frame timings, so that a whole
+// frame is always worth exactly 44100/60 or 44100/50 samples; what's left of a cycle
+// count carries over to the next call, and so does what's left of a mixed block
+void PCSX::SPU::impl::SyncMix(uint32_t cycle, uint32_t cyclesPerSecond) {
+    const unsigned channels = settings.get<Mono>() ? 1 : 2;
+
+    m_syncCycles += uint64_t(cycle) * 44100;
+    size_t samples = m_syncCycles / cyclesPerSecond;
+    m_syncCycles %= cyclesPerSecond;
+
+    while (samples) {
+        if (m_syncPlay == pS) {
+            m_syncPlay = pS = (short *)pSpuBuffer;
+            MixBlock();
+        }
+        size_t count = std::min<size_t>(samples, (pS - m_syncPlay) / channels);
+        m_sink(m_syncPlay, count, channels);
+        m_syncPlay += count * channels;
+        samples -= count;
     }
 }
 
+////////////////////////////////////////////////////////////////////////
+// RELEASE ASYNC WAIT: the main emu reacted to the spu irq, let the thread go on
+////////////////////////////////////////////////////////////////////////
+
+void PCSX::SPU::impl::ReleaseAsyncWait() {
+    SDL_LockMutex(m_asyncWaitMutex);
+    iSpuAsyncWait = 0;
+    SDL_CondSignal(m_asyncWaitCond);
+    SDL_UnlockMutex(m_asyncWaitMutex);
+}
+
 ////////////////////////////////////////////////////////////////////////
 // XA AUDIO
 ////////////////////////////////////////////////////////////////////////
@@ -801,6 +877,7 @@ void PCSX::SPU::impl::playADPCMchannel(xa_decode_t *xap) {
 
 long PCSX::SPU::impl::init(void) {
     spuMemC = (unsigned char *)spuMem;  // just small setup
+    m_blockCache.clear();
     memset((void *)s_chan, 0, MAXCHAN * sizeof(SPUCHAN));
     memset((void *)&rvb, 0, sizeof(REVERBInfo));
     return 0;
@@ -816,11 +893,21 @@ void PCSX::SPU::impl::SetupThread() {
     memset(iFMod, 0, NSSIZE * sizeof(int));
 
     pS = (short *)pSpuBuffer;  // setup soundbuffer pointer
+    m_syncPlay = pS;
+    m_syncCycles = 0;
+
+    m_asyncWaitMutex = SDL_CreateMutex();
+    m_asyncWaitCond = SDL_CreateCond();
+    iSpuAsyncWait = 0;
 
     bEndThread = 0;  // init thread vars
     bThreadEnded = 0;
     bSpuInit = 1;  // flag: we are inited
 
+    if (m_sink) return;  // synchronous mode: async() does the mixing
+
+    m_emulator = g_emulator;
+    m_system = g_system;
     hMainThread = SDL_CreateThread(PCSX::SPU::impl::MainThreadTrampoline, "SPU Thread", this);
 }
 
@@ -829,14 +916,17 @@ void PCSX::SPU::impl::SetupThread() {
 ////////////////////////////////////////////////////////////////////////
 
 void PCSX::SPU::impl::RemoveThread() {
+    SDL_LockMutex(m_asyncWaitMutex);
     bEndThread = 1;  // raise flag to end thread
+    SDL_CondSignal(m_asyncWaitCond);
+    SDL_UnlockMutex(m_asyncWaitMutex);
+    m_sound.wakeUp();  // -> in case the thread sleeps on a full sound buffer
 
-    while (!bThreadEnded) {
-        SDL_Delay(5L);
-    }  // -> wait till thread has ended
-    SDL_Delay(5L);
+    if (hMainThread) SDL_WaitThread(hMainThread, NULL);  // -> wait till thread has ended
+    hMainThread = NULL;
 
-    SDL_WaitThread(hMainThread, NULL);
+    SDL_DestroyCond(m_asyncWaitCond);
+    SDL_DestroyMutex(m_asyncWaitMutex);
 
     bThreadEnded = 0;  // no more spu is running
     bSpuInit = 0;
@@ -929,7 +1019,7 @@ bool PCSX::SPU::impl::open() {
 
     //    ReadConfig();  // read user stuff
 
-    m_sound.setup();  // setup sound (before init!)
+    if (!m_sink) m_sound.setup();  // setup sound (before init!)
 
     SetupStreams();  // prepare streaming
 
@@ -951,8 +1041,8 @@ long PCSX::SPU::impl::close(void) {
 
     bSPUIsOpen = 0;  // no more open
 
-    RemoveThread();  // no more feeding
-    m_sound.remove();  // no more sound handling
+    RemoveThread();                 // no more feeding
+    if (!m_sink) m_sound.remove();  // no more sound handling
     RemoveStreams();  // no more streaming
 
     return 0;
@@ -0,0 +1,121 @@
+/***************************************************************************
+ *   Copyright (C) 2019 PCSX-Redux authors                                 *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.           *
+ ***************************************************************************/
+
+#include "spu/timestretch.h"
+
+#include <math.h>
+
+#include <algorithm>
+
+void PCSX::SPU::TimeStretch::setTempo(uint32_t percent) { m_tempo = std::clamp<uint32_t>(percent, 10, 1000); }
+
+void PCSX::SPU::TimeStretch::clear() {
+    m_primed = false;
+    m_skip = 0.0;
+    m_input.clear();
+    m_tail.clear();
+    m_output.clear();
+}
+
+const std::vector<short> &PCSX::SPU::TimeStretch::process(const short *in, size_t frames, unsigned channels) {
+    if (channels != m_channels) {
+        clear();
+        m_channels = channels;
+    }
+
+    m_output.clear();
+    m_input.insert(m_input.end(), in, in + frames * channels);
+
+    // the very first segment has nothing to be aligned with, so it only seeds the overlap
+    if (!m_primed) {
+        if (m_input.size() < OVERLAP * channels) return m_output;
+        m_tail.assign(m_input.begin(), m_input.begin() + OVERLAP * channels);
+        m_input.erase(m_input.begin(), m_input.begin() + OVERLAP * channels);
+        m_primed = true;
+    }
+
+    for (;;) {
+        // the skip can be larger than what we have at high tempos; the rest is dropped on the next calls
+        size_t available = m_input.size() / channels;
+        size_t drop = std::min<size_t>(size_t(m_skip), available);
+        if (drop) {
+            m_input.erase(m_input.begin(), m_input.begin() + drop * channels);
+            m_skip -= drop;
+            available -= drop;
+        }
+        if (m_skip >= 1.0 || available < SEEK + SEQUENCE) break;
+
+        unsigned offset = bestOffset();
+        size_t pos = m_output.size();
+        m_output.resize(pos + (SEQUENCE - OVERLAP) * channels);
+        overlap(&m_output[pos], offset);
+
+        const short *segment = &m_input[offset * channels];
+        std::copy(segment + OVERLAP * channels, segment + (SEQUENCE - OVERLAP) * channels,
+                  &m_output[pos + OVERLAP * channels]);
+        m_tail.assign(segment + (SEQUENCE - OVERLAP) * channels, segment + SEQUENCE * channels);
+
+        m_skip += (SEQUENCE - OVERLAP) * m_tempo / 100.0;
+    }
+
+    return m_output;
+}
+
+// normalized cross correlation of the previous tail against every candidate start in the seek window
+unsigned PCSX::SPU::TimeStretch::bestOffset() const {
+    const unsigned count = OVERLAP * m_channels;
+    const short *in = m_input.data();
+    const short *tail = m_tail.data();
+
+    int64_t norm = 0;
+    for (unsigned i = 0; i < count; i++) norm += in[i] * in[i];
+
+    unsigned best = 0;
+    double bestScore = -INFINITY;
+    for (unsigned offset = 0; offset < SEEK; offset++) {
+        const short *candidate = in + offset * m_channels;
+        if (offset) {
+            const short *leaving = candidate - m_channels;
+            const short *entering = candidate + count - m_channels;
+            for (unsigned c = 0; c < m_channels; c++) {
+                norm -= leaving[c] * leaving[c];
+                norm += entering[c] * entering[c];
+            }
+        }
+        int64_t corr = 0;
+        for (unsigned i = 0; i < count; i++) corr += tail[i] * candidate[i];
+        double score = corr / sqrt(double(std::max<int64_t>(norm, 1)));
+        if (score > bestScore) {
+            bestScore = score;
+            best = offset;
+        }
+    }
+
+    return best;
+}
+
+void PCSX::SPU::TimeStretch::overlap(short *out, unsigned offset) const {
+    const short *segment = &m_input[offset * m_channels];
+    for (unsigned i = 0; i < OVERLAP; i++) {
+        for (unsigned c = 0; c < m_channels; c++) {
+            unsigned s = i * m_channels + c;
+            out[s] = (m_tail[s] * int(OVERLAP - i) + segment[s] * int(i)) / int(OVERLAP);
+        }
+    }
+}
@@ -0,0 +1,63 @@
+/***************************************************************************
+ *   Copyright (C) 2019 PCSX-Redux authors                                 *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.           *
+ ***************************************************************************/
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <vector>
+
+namespace PCSX {
+
+namespace SPU {
+
+// WSOLA time stretcher: changes the tempo of the 44.1kHz mixed stream without changing
+// its pitch, by cutting it into overlapping segments and cross fading each one where it
+// best lines up with the previous one. Used to keep the audio listenable while the
+// emulator runs at an alternate speed.
+class TimeStretch {
+  public:
+    // in percent of the natural speed; 200 consumes twice as much input as it produces
+    void setTempo(uint32_t percent);
+    void clear();
+    // takes frames of interleaved samples, and returns whatever output is ready so far;
+    // the returned buffer is only valid until the next call
+    const std::vector<short> &process(const short *in, size_t frames, unsigned channels);
+
+  private:
+    static const unsigned SEQUENCE = 1764;  // 40ms
+    static const unsigned SEEK = 662;       // 15ms
+    static const unsigned OVERLAP = 353;    // 8ms
+
+    unsigned bestOffset() const;
+    void overlap(short *out, unsigned offset) const;
+
+    uint32_t m_tempo = 100;
+    unsigned m_channels = 0;
+    bool m_primed = false;
+    double m_skip = 0.0;
+    std::vector<short> m_input;
+    std::vector<short> m_tail;  // the last OVERLAP frames of the previous segment
+    std::vector<short> m_output;
+};
+
+}  // namespace SPU
+
+}  // namespace PCSX
@@ -81,11 +81,11 @@ void PCSX::SPU::impl::FeedXA(xa_decode_t *xap) {
     //----------------------------------------------------//
     if (settings.get<StreamingPitch>())  // pitch change option?
     {
-        static DWORD dwLT = 0;
-        static DWORD dwFPS = 0;
-        static int iFPSCnt = 0;
-        static int iLastSize = 0;
-        static DWORD dwL1 = 0;
+        static thread_local DWORD dwLT = 0;
+        static thread_local DWORD dwFPS = 0;
+        static thread_local int iFPSCnt = 0;
+        static thread_local int iLastSize = 0;
+        static thread_local DWORD dwL1 = 0;
         DWORD dw = SDL_GetTicks(), dw1, dw2;
 
         iPlace = iSize;
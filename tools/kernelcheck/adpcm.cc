@@ -0,0 +1,202 @@
+/***************************************************************************
+ *   Copyright (C) 2019 PCSX-Redux authors                                 *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.           *
+ ***************************************************************************/
+
+// core/adpcm against the SPU voice and XA decoders it replaced, on random blocks and filter states.
+
+#include <string.h>
+
+#include <algorithm>
+#include <vector>
+
+#include "common.h"
+#include "core/adpcm.h"
+
+namespace {
+
+// the SPU voice decoding loop, as it was in spu.cc
+void referenceSPU(const uint8_t *start, int *SB, int *s1, int *s2) {
+    static const int f[5][2] = {{0, 0}, {60, 0}, {115, -52}, {98, -55}, {122, -60}};
+    int s_1 = *s1, s_2 = *s2;
+    int predict_nr = (int)*start;
+    start++;
+    int shift_factor = predict_nr & 0xf;
+    predict_nr >>= 4;
+    start++;
+
+    for (unsigned nSample = 0; nSample < 28; start++) {
+        int d = (int)*start;
+        int s = ((d & 0xf) << 12);
+        if (s & 0x8000) s |= 0xffff0000;
+
+        int fa = (s >> shift_factor);
+        fa = fa + ((s_1 * f[predict_nr][0]) >> 6) + ((s_2 * f[predict_nr][1]) >> 6);
+        s_2 = s_1;
+        s_1 = fa;
+        s = ((d & 0xf0) << 8);
+
+        SB[nSample++] = fa;
+
+        if (s & 0x8000) s |= 0xffff0000;
+        fa = (s >> shift_factor);
+        fa = fa + ((s_1 * f[predict_nr][0]) >> 6) + ((s_2 * f[predict_nr][1]) >> 6);
+        s_2 = s_1;
+        s_1 = fa;
+
+        SB[nSample++] = fa;
+    }
+    *s1 = s_1;
+    *s2 = s_2;
+}
+
+// ADPCM_DecodeBlock16, as it was in decode_xa.cc; the sound unit came as 14 little endian halfwords
+void referenceXA(const uint8_t *block, short *destp, int inc, int32_t *y0, int32_t *y1) {
+    static const double s_K0[4] = {0.0, 0.9375, 1.796875, 1.53125};
+    static const double s_K1[4] = {0.0, 0.0, -0.8125, -0.859375};
+    static const int SH = 4;
+    static const int SHC = 10;
+    const int filterid = (block[0] >> 4) & 0x0f;
+    const int range = block[0] & 0x0f;
+    const int IK0 = (int)((-s_K0[filterid]) * (1 << SHC));
+    const int IK1 = (int)((-s_K1[filterid]) * (1 << SHC));
+    int32_t fy0 = *y0, fy1 = *y1;
+    const uint8_t *blockp = block + 2;
+
+    for (int i = 28 / 4; i; --i, blockp += 2) {
+        int32_t y = blockp[0] | (blockp[1] << 8);
+        int32_t x3 = (short)(y & 0xf000) >> range;
+        x3 *= 1 << SH;
+        int32_t x2 = (short)((y << 4) & 0xf000) >> range;
+        x2 *= 1 << SH;
+        int32_t x1 = (short)((y << 8) & 0xf000) >> range;
+        x1 *= 1 << SH;
+        int32_t x0 = (short)((y << 12) & 0xf000) >> range;
+        x0 *= 1 << SH;
+
+        int32_t x[4] = {x0, x1, x2, x3};
+        for (int j = 0; j < 4; j++) {
+            x[j] -= (IK0 * fy0 + (IK1 * fy1)) >> SHC;
+            fy1 = fy0;
+            fy0 = x[j];
+        }
+        for (int j = 0; j < 4; j++) {
+            if (x[j] < (-32768 << SH)) x[j] = -32768 << SH;
+            if (x[j] > (32767 << SH)) x[j] = 32767 << SH;
+            *destp = x[j] >> SH;
+            destp += inc;
+        }
+    }
+    *y0 = fy0;
+    *y1 = fy1;
+}
+
+struct Case {
+    uint8_t block[PCSX::ADPCM::BLOCK_SIZE];
+    int32_t state[2];
+};
+
+// filters past the ones the tables have used to read out of bounds, and now decode as filter 0
+void randomCase(KernelCheck::Random &random, Case &c, unsigned filters, bool wild) {
+    random.fill(c.block, sizeof(c.block));
+    unsigned filter = random.next() % (wild ? 16 : filters);
+    c.block[0] = (filter << 4) | (random.next() & 0x0f);
+    // the voices don't clamp their state, so it can go some way past 16 bits
+    c.state[0] = random.range(-(1 << 20), 1 << 20);
+    c.state[1] = random.range(-(1 << 20), 1 << 20);
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+    using namespace PCSX::ADPCM;
+    const unsigned n = KernelCheck::cases(argc, argv, 200000);
+    KernelCheck::Random random;
+    unsigned mismatches = 0;
+
+    for (unsigned i = 0; i < n; i++) {
+        Case c;
+        const bool wild = (i & 7) == 0;
+        randomCase(random, c, 5, wild);
+        uint8_t reference[BLOCK_SIZE];
+        memcpy(reference, c.block, BLOCK_SIZE);
+        if ((c.block[0] >> 4) >= 5) reference[0] &= 0x0f;
+
+        int refOut[BLOCK_SAMPLES], out[BLOCK_SAMPLES];
+        int refS1 = c.state[0], refS2 = c.state[1], s1 = c.state[0], s2 = c.state[1];
+        referenceSPU(reference, refOut, &refS1, &refS2);
+        decodeSPUBlock(c.block, out, &s1, &s2);
+        if (memcmp(refOut, out, sizeof(out)) != 0 || refS1 != s1 || refS2 != s2) {
+            if (mismatches++ < 10) printf("SPU mismatch, case %u, header %02x\n", i, c.block[0]);
+        }
+
+        randomCase(random, c, 4, wild);
+        memcpy(reference, c.block, BLOCK_SIZE);
+        if ((c.block[0] >> 4) >= 4) reference[0] &= 0x0f;
+        // XA output is interleaved for stereo, so check with a stride, and that nothing in between gets written
+        int16_t refPcm[BLOCK_SAMPLES * 2], pcm[BLOCK_SAMPLES * 2];
+        memset(refPcm, 0x5a, sizeof(refPcm));
+        memset(pcm, 0x5a, sizeof(pcm));
+        const int stride = 1 + (i & 1);
+        int32_t refY0 = c.state[0] >> 4, refY1 = c.state[1] >> 4, y0 = c.state[0] >> 4, y1 = c.state[1] >> 4;
+        referenceXA(reference, refPcm, stride, &refY0, &refY1);
+        decodeXABlock(c.block, pcm, stride, &y0, &y1);
+        if (memcmp(refPcm, pcm, sizeof(pcm)) != 0 || refY0 != y0 || refY1 != y1) {
+            if (mismatches++ < 10) printf("XA mismatch, case %u, header %02x\n", i, c.block[0]);
+        }
+    }
+
+    // a set of blocks that fits in the cache, so that the decoding is what gets timed
+    std::vector<Case> blocks(4096);
+    for (auto &c : blocks) randomCase(random, c, 4, false);
+    const unsigned rounds = std::max(n, 4096u) * 4;
+    // so that the results can't be optimized away
+    volatile int sink = 0;
+    int out[BLOCK_SAMPLES];
+    int16_t pcm[BLOCK_SAMPLES * 2];
+    auto reset = [&]() {
+        for (auto &c : blocks) c.state[0] = c.state[1] = 0;
+    };
+    reset();
+    double refSPU = KernelCheck::nsPerCall(rounds, [&](unsigned i) {
+        Case &c = blocks[i & 4095];
+        referenceSPU(c.block, out, &c.state[0], &c.state[1]);
+        sink = sink + out[i % BLOCK_SAMPLES];
+    });
+    reset();
+    double newSPU = KernelCheck::nsPerCall(rounds, [&](unsigned i) {
+        Case &c = blocks[i & 4095];
+        decodeSPUBlock(c.block, out, &c.state[0], &c.state[1]);
+        sink = sink + out[i % BLOCK_SAMPLES];
+    });
+    reset();
+    double refXA = KernelCheck::nsPerCall(rounds, [&](unsigned i) {
+        Case &c = blocks[i & 4095];
+        referenceXA(c.block, pcm, 2, &c.state[0], &c.state[1]);
+        sink = sink + pcm[i % BLOCK_SAMPLES];
+    });
+    reset();
+    double newXA = KernelCheck::nsPerCall(rounds, [&](unsigned i) {
+        Case &c = blocks[i & 4095];
+        decodeXABlock(c.block, pcm, 2, &c.state[0], &c.state[1]);
+        sink = sink + pcm[i % BLOCK_SAMPLES];
+    });
+    KernelCheck::bench("adpcm", "SPU block", refSPU, newSPU);
+    KernelCheck::bench("adpcm", "XA block", refXA, newXA);
+
+    return KernelCheck::report("adpcm", n, mismatches);
+}
@@ -0,0 +1,86 @@
+/***************************************************************************
+ *   Copyright (C) 2019 PCSX-Redux authors                                 *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.           *
+ ***************************************************************************/
+
+#pragma once
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <chrono>
+
+// What every check shares: a fixed seed generator, so that a failure can be reproduced, the number of
+// cases from the command line, and the timing of the emulator's kernel against the code it replaced.
+namespace KernelCheck {
+
+#ifdef PCSX_NO_SIMD
+static const char *const VARIANT = "scalar";
+#else
+static const char *const VARIANT = "simd";
+#endif
+
+// xorshift64*
+class Random {
+  public:
+    explicit Random(uint64_t seed = 0x9e3779b97f4a7c15ull) : m_state(seed) {}
+    uint32_t next() {
+        m_state ^= m_state >> 12;
+        m_state ^= m_state << 25;
+        m_state ^= m_state >> 27;
+        return (m_state * 0x2545f4914f6cdd1dull) >> 32;
+    }
+    // in [lo, hi]
+    int32_t range(int32_t lo, int32_t hi) { return lo + int32_t(next() % (uint32_t(hi - lo) + 1)); }
+    void fill(uint8_t *dest, size_t size) {
+        for (size_t i = 0; i < size; i++) dest[i] = next();
+    }
+
+  private:
+    uint64_t m_state;
+};
+
+// the first argument, if any, is the number of cases to check
+inline unsigned cases(int argc, char **argv, unsigned def) {
+    if (argc < 2) return def;
+    unsigned n = strtoul(argv[1], nullptr, 0);
+    return n ? n : def;
+}
+
+// nanoseconds per call of f, over n calls
+template <typename F>
+double nsPerCall(unsigned n, F f) {
+    auto start = std::chrono::steady_clock::now();
+    for (unsigned i = 0; i < n; i++) f(i);
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(end - start).count() / n;
+}
+
+inline void bench(const char *check, const char *what, double reference, double kernel) {
+    printf("%-8s %-6s %-24s %9.1f ns -> %9.1f ns  (x%.2f)\n", check, VARIANT, what, reference, kernel,
+           kernel > 0 ? reference / kernel : 0.0);
+}
+
+// prints the outcome, and returns the exit code for main
+inline int report(const char *check, unsigned checked, unsigned mismatches) {
+    printf("%-8s %-6s %u cases, %u mismatches: %s\n", check, VARIANT, checked, mismatches,
+           mismatches ? "FAILED" : "ok");
+    return mismatches ? 1 : 0;
+}
+
+}  // namespace KernelCheck
@@ -0,0 +1,155 @@
+/***************************************************************************
+ *   Copyright (C) 2019 PCSX-Redux authors                                 *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.           *
+ ***************************************************************************/
+
+// core/eccedc against the byte at a time EDC and ECC code that cdriso used to have, on random sectors,
+// with their own address and with the zero one of mode 2, and on EDCs of any length and alignment.
+
+#include <string.h>
+
+#include <algorithm>
+
+#include "common.h"
+#include "core/eccedc.h"
+
+namespace {
+
+const size_t SECTOR_SIZE = 2352;
+
+// eccedc_init, edc_compute and ecc_writepq, as they were in cdriso.cc
+class Reference {
+  public:
+    Reference() {
+        for (size_t i = 0; i < 256; i++) {
+            uint32_t edc = i;
+            size_t j = (i << 1) ^ (i & 0x80 ? 0x11D : 0);
+            m_ecc_f_lut[i] = j;
+            m_ecc_b_lut[i ^ j] = i;
+            for (j = 0; j < 8; j++) {
+                edc = (edc >> 1) ^ (edc & 1 ? 0xD8018001 : 0);
+            }
+            m_edc_lut[i] = edc;
+        }
+    }
+
+    uint32_t edc_compute(uint32_t edc, const uint8_t *src, size_t size) const {
+        for (; size; size--) {
+            edc = (edc >> 8) ^ m_edc_lut[(edc ^ (*src++)) & 0xFF];
+        }
+        return edc;
+    }
+
+    void ecc_writepq(const uint8_t *address, const uint8_t *data, size_t major_count, size_t minor_count,
+                     size_t major_mult, size_t minor_inc, uint8_t *ecc) const {
+        size_t size = major_count * minor_count;
+        size_t major;
+        for (major = 0; major < major_count; major++) {
+            size_t index = (major >> 1) * major_mult + (major & 1);
+            uint8_t ecc_a = 0;
+            uint8_t ecc_b = 0;
+            size_t minor;
+            for (minor = 0; minor < minor_count; minor++) {
+                uint8_t temp;
+                if (index < 4) {
+                    temp = address[index];
+                } else {
+                    temp = data[index - 4];
+                }
+                index += minor_inc;
+                if (index >= size) {
+                    index -= size;
+                }
+                ecc_a ^= temp;
+                ecc_b ^= temp;
+                ecc_a = m_ecc_f_lut[ecc_a];
+            }
+            ecc_a = m_ecc_b_lut[m_ecc_f_lut[ecc_a] ^ ecc_b];
+            ecc[major] = (ecc_a);
+            ecc[major + major_count] = (ecc_a ^ ecc_b);
+        }
+    }
+
+    void ecc_writesector(const uint8_t *address, const uint8_t *data, uint8_t *ecc) const {
+        ecc_writepq(address, data, 86, 24, 2, 86, ecc);          // P
+        ecc_writepq(address, data, 52, 43, 86, 88, ecc + 0xAC);  // Q
+    }
+
+  private:
+    uint8_t m_ecc_f_lut[256];
+    uint8_t m_ecc_b_lut[256];
+    uint32_t m_edc_lut[256];
+};
+
+}  // namespace
+
+int main(int argc, char **argv) {
+    static const uint8_t ZEROADDRESS[4] = {0, 0, 0, 0};
+    const unsigned n = KernelCheck::cases(argc, argv, 20000);
+    KernelCheck::Random random;
+    const Reference reference;
+    const PCSX::EccEdc eccedc;
+    unsigned mismatches = 0;
+
+    // room for reading a sector from any alignment
+    uint8_t buffer[SECTOR_SIZE + 16];
+    for (unsigned i = 0; i < n; i++) {
+        random.fill(buffer, sizeof(buffer));
+        const uint8_t *sector = buffer + (i & 15);
+
+        // what reconstruct_sector does, with the sector's own address for mode 1, and the zero one for mode 2
+        const uint8_t *address = (i & 16) ? ZEROADDRESS : sector + 0xC;
+        uint8_t refEcc[0x114], ecc[0x114];
+        reference.ecc_writesector(address, sector + 0x10, refEcc);
+        eccedc.ecc_writesector(address, sector + 0x10, ecc);
+        if (memcmp(refEcc, ecc, sizeof(ecc)) != 0) {
+            if (mismatches++ < 10) printf("ECC mismatch, case %u\n", i);
+        }
+
+        const size_t offset = random.next() % SECTOR_SIZE;
+        const size_t size = random.next() % (SECTOR_SIZE - offset + 1);
+        const uint32_t seed = (i & 2) ? random.next() : 0;
+        if (reference.edc_compute(seed, sector + offset, size) != eccedc.edc_compute(seed, sector + offset, size)) {
+            if (mismatches++ < 10) printf("EDC mismatch, case %u, %zu bytes at %zu\n", i, size, offset);
+        }
+    }
+
+    // a mode 2 form 2 EDC, the longest there is, and the ECC of a mode 1 sector
+    random.fill(buffer, sizeof(buffer));
+    const unsigned rounds = std::max(n, 20000u);
+    volatile uint32_t sink = 0;
+    double refEdc = KernelCheck::nsPerCall(rounds, [&](unsigned i) {
+        buffer[0x10 + (i & 1023)] = i;
+        sink = reference.edc_compute(0, buffer + 0x10, 0x91C);
+    });
+    double newEdc = KernelCheck::nsPerCall(rounds, [&](unsigned i) {
+        buffer[0x10 + (i & 1023)] = i;
+        sink = eccedc.edc_compute(0, buffer + 0x10, 0x91C);
+    });
+    double refEcc = KernelCheck::nsPerCall(rounds, [&](unsigned i) {
+        buffer[0x10 + (i & 1023)] = i;
+        reference.ecc_writesector(buffer + 0xC, buffer + 0x10, buffer + 0x81C);
+    });
+    double newEcc = KernelCheck::nsPerCall(rounds, [&](unsigned i) {
+        buffer[0x10 + (i & 1023)] = i;
+        eccedc.ecc_writesector(buffer + 0xC, buffer + 0x10, buffer + 0x81C);
+    });
+    KernelCheck::bench("eccedc", "EDC, 2332 bytes", refEdc, newEdc);
+    KernelCheck::bench("eccedc", "ECC P and Q", refEcc, newEcc);
+
+    return KernelCheck::report("eccedc", n, mismatches);
+}
@@ -0,0 +1,447 @@
+/***************************************************************************
+ *   Copyright (C) 2019 PCSX-Redux authors                                 *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.           *
+ ***************************************************************************/
+
+// core/mdeckernels against the MDEC code it replaced: the IDCT, on random blocks shaped like the ones
+// rl2blk decodes, and the conversion of the macroblocks to 15 and 24 bits pixels, in colour and in black
+// and white.
+
+#include <string.h>
+
+#include <algorithm>
+#include <vector>
+
+#include "common.h"
+#include "core/mdeckernels.h"
+
+namespace {
+
+using PCSX::MDECKernels::DSIZE;
+using PCSX::MDECKernels::DSIZE2;
+
+// the IDCT, the colour conversion and their helpers, as they were in mdec.cc; the mask bit and the black
+// and white setting are parameters instead of coming from the emulator, and the checks run on little
+// endian hosts
+#define AAN_CONST_BITS 12
+#define AAN_CONST_SIZE 24
+#define AAN_CONST_SCALE (AAN_CONST_SIZE - AAN_CONST_BITS)
+
+#define SCALE(x, n) ((x) >> (n))
+#define SCALER(x, n) (((x) + ((1 << (n)) >> 1)) >> (n))
+
+#define MULS(var, const) (SCALE((var) * (const), AAN_CONST_BITS))
+
+#define FIX_1_082392200 SCALER(18159528, AAN_CONST_SCALE)  // B6
+#define FIX_1_414213562 SCALER(23726566, AAN_CONST_SCALE)  // A4
+#define FIX_1_847759065 SCALER(31000253, AAN_CONST_SCALE)  // A2
+#define FIX_2_613125930 SCALER(43840978, AAN_CONST_SCALE)  // B2
+
+#define SWAP_LE16(v) (v)
+
+inline void fillcol(int *blk, int val) {
+    blk[0 * DSIZE] = blk[1 * DSIZE] = blk[2 * DSIZE] = blk[3 * DSIZE] = blk[4 * DSIZE] = blk[5 * DSIZE] =
+        blk[6 * DSIZE] = blk[7 * DSIZE] = val;
+}
+
+inline void fillrow(int *blk, int val) {
+    blk[0] = blk[1] = blk[2] = blk[3] = blk[4] = blk[5] = blk[6] = blk[7] = val;
+}
+
+void referenceIdct(int *block, int used_col) {
+    int tmp0, tmp1, tmp2, tmp3, tmp4, tmp5, tmp6, tmp7;
+    int z5, z10, z11, z12, z13;
+    int *ptr;
+    int i;
+
+    // the block has only the DC coefficient
+    if (used_col == -1) {
+        int v = block[0];
+        for (i = 0; i < DSIZE2; i++) block[i] = v;
+        return;
+    }
+
+    // last_col keeps track of the highest column with non zero coefficients
+    ptr = block;
+    for (i = 0; i < DSIZE; i++, ptr++) {
+        if ((used_col & (1 << i)) == 0) {
+            // the column is empty or has only the DC coefficient
+            if (ptr[DSIZE * 0]) {
+                fillcol(ptr, ptr[0]);
+                used_col |= (1 << i);
+            }
+            continue;
+        }
+
+        // further optimization could be made by keeping track of
+        // last_row in rl2blk
+        z10 = ptr[DSIZE * 0] + ptr[DSIZE * 4];  // s04
+        z11 = ptr[DSIZE * 0] - ptr[DSIZE * 4];  // d04
+        z13 = ptr[DSIZE * 2] + ptr[DSIZE * 6];  // s26
+        z12 = MULS(ptr[DSIZE * 2] - ptr[DSIZE * 6], FIX_1_414213562) - z13;
+        //^^^^  d26=d26*2*A4-s26
+
+        tmp0 = z10 + z13;  // os07 = s04 + s26
+        tmp3 = z10 - z13;  // os34 = s04 - s26
+        tmp1 = z11 + z12;  // os16 = d04 + d26
+        tmp2 = z11 - z12;  // os25 = d04 - d26
+
+        z13 = ptr[DSIZE * 3] + ptr[DSIZE * 5];  // s53
+        z10 = ptr[DSIZE * 3] - ptr[DSIZE * 5];  //-d53
+        z11 = ptr[DSIZE * 1] + ptr[DSIZE * 7];  // s17
+        z12 = ptr[DSIZE * 1] - ptr[DSIZE * 7];  // d17
+
+        tmp7 = z11 + z13;  // od07 = s17 + s53
+
+        z5 = (z12 - z10) * (FIX_1_847759065);
+        tmp6 = SCALE(z10 * (FIX_2_613125930) + z5, AAN_CONST_BITS) - tmp7;
+        tmp5 = MULS(z11 - z13, FIX_1_414213562) - tmp6;
+        tmp4 = SCALE(z12 * (FIX_1_082392200)-z5, AAN_CONST_BITS) + tmp5;
+
+        // path #1
+        // z5 = (z12 - z10)* FIX_1_847759065;
+        // tmp0 = (d17 + d53) * 2*A2
+
+        // tmp6 = DESCALE(z10*FIX_2_613125930 + z5, CONST_BITS) - tmp7;
+        // od16 = (d53*-2*B2 + tmp0) - od07
+
+        // tmp4 = DESCALE(z12*FIX_1_082392200 - z5, CONST_BITS) + tmp5;
+        // od34 = (d17*2*B6 - tmp0) + od25
+
+        // path #2
+
+        // od34 = d17*2*(B6-A2) - d53*2*A2
+        // od16 = d53*2*(A2-B2) + d17*2*A2
+
+        // end
+
+        //    tmp5 = MULS(z11 - z13, FIX_1_414213562) - tmp6;
+        // od25 = (s17 - s53)*2*A4 - od16
+
+        ptr[DSIZE * 0] = (tmp0 + tmp7);  // os07 + od07
+        ptr[DSIZE * 7] = (tmp0 - tmp7);  // os07 - od07
+        ptr[DSIZE * 1] = (tmp1 + tmp6);  // os16 + od16
+        ptr[DSIZE * 6] = (tmp1 - tmp6);  // os16 - od16
+        ptr[DSIZE * 2] = (tmp2 + tmp5);  // os25 + od25
+        ptr[DSIZE * 5] = (tmp2 - tmp5);  // os25 - od25
+        ptr[DSIZE * 4] = (tmp3 + tmp4);  // os34 + od34
+        ptr[DSIZE * 3] = (tmp3 - tmp4);  // os34 - od34
+    }
+
+    ptr = block;
+    if (used_col == 1) {
+        for (i = 0; i < DSIZE; i++) fillrow(block + DSIZE * i, block[DSIZE * i]);
+    } else {
+        for (i = 0; i < DSIZE; i++, ptr += DSIZE) {
+            z10 = ptr[0] + ptr[4];
+            z11 = ptr[0] - ptr[4];
+            z13 = ptr[2] + ptr[6];
+            z12 = MULS(ptr[2] - ptr[6], FIX_1_414213562) - z13;
+
+            tmp0 = z10 + z13;
+            tmp3 = z10 - z13;
+            tmp1 = z11 + z12;
+            tmp2 = z11 - z12;
+
+            z13 = ptr[3] + ptr[5];
+            z10 = ptr[3] - ptr[5];
+            z11 = ptr[1] + ptr[7];
+            z12 = ptr[1] - ptr[7];
+
+            tmp7 = z11 + z13;
+            z5 = (z12 - z10) * FIX_1_847759065;
+            tmp6 = SCALE(z10 * FIX_2_613125930 + z5, AAN_CONST_BITS) - tmp7;
+            tmp5 = MULS(z11 - z13, FIX_1_414213562) - tmp6;
+            tmp4 = SCALE(z12 * FIX_1_082392200 - z5, AAN_CONST_BITS) + tmp5;
+
+            ptr[0] = tmp0 + tmp7;
+
+            ptr[7] = tmp0 - tmp7;
+            ptr[1] = tmp1 + tmp6;
+            ptr[6] = tmp1 - tmp6;
+            ptr[2] = tmp2 + tmp5;
+            ptr[5] = tmp2 - tmp5;
+            ptr[4] = tmp3 + tmp4;
+            ptr[3] = tmp3 - tmp4;
+        }
+    }
+}
+
+// Y/Cb/Cr[0...255] -> R/G/B[0...255]
+// R = 1.000 * (Y) + 1.400 * (Cr - 128)
+// G = 1.000 * (Y) - 0.343 * (Cb - 128) - 0.711 (Cr - 128)
+// B = 1.000 * (Y) + 1.765 * (Cb - 128)
+#define MULR(a) ((1434 * (a)))
+#define MULB(a) ((1807 * (a)))
+#define MULG2(a, b) ((-351 * (a)-728 * (b)))
+#define MULY(a) ((a) << 10)
+
+#define MAKERGB15(r, g, b, a) (SWAP_LE16(a | ((b) << 10) | ((g) << 5) | (r)))
+#define SCALE8(c) SCALER(c, 20)
+#define SCALE5(c) SCALER(c, 23)
+
+#define CLAMP5(c) (((c) < -16) ? 0 : (((c) > (31 - 16)) ? 31 : ((c) + 16)))
+#define CLAMP8(c) (((c) < -128) ? 0 : (((c) > (255 - 128)) ? 255 : ((c) + 128)))
+
+#define CLAMP_SCALE8(a) (CLAMP8(SCALE8(a)))
+#define CLAMP_SCALE5(a) (CLAMP5(SCALE5(a)))
+
+inline void putlinebw15(uint16_t *image, int *Yblk, int A) {
+    int i;
+
+    for (i = 0; i < 8; i++, Yblk++) {
+        int Y = *Yblk;
+        // missing rounding
+        image[i] = SWAP_LE16((CLAMP5(Y >> 3) * 0x421) | A);
+    }
+}
+
+inline void putquadrgb15(uint16_t *image, int *Yblk, int Cr, int Cb, int A) {
+    int Y, R, G, B;
+    R = MULR(Cr);
+    G = MULG2(Cb, Cr);
+    B = MULB(Cb);
+
+    // added transparency
+    Y = MULY(Yblk[0]);
+    image[0] = MAKERGB15(CLAMP_SCALE5(Y + R), CLAMP_SCALE5(Y + G), CLAMP_SCALE5(Y + B), A);
+    Y = MULY(Yblk[1]);
+    image[1] = MAKERGB15(CLAMP_SCALE5(Y + R), CLAMP_SCALE5(Y + G), CLAMP_SCALE5(Y + B), A);
+    Y = MULY(Yblk[8]);
+    image[16] = MAKERGB15(CLAMP_SCALE5(Y + R), CLAMP_SCALE5(Y + G), CLAMP_SCALE5(Y + B), A);
+    Y = MULY(Yblk[9]);
+    image[17] = MAKERGB15(CLAMP_SCALE5(Y + R), CLAMP_SCALE5(Y + G), CLAMP_SCALE5(Y + B), A);
+}
+
+void referenceYuv2rgb15(int *blk, unsigned short *image, bool bnw, bool stp) {
+    int x, y;
+    const int A = stp ? 0x8000 : 0;
+    int *Yblk = blk + DSIZE2 * 2;
+    int *Crblk = blk;
+    int *Cbblk = blk + DSIZE2;
+
+    if (!bnw) {
+        for (y = 0; y < 16; y += 2, Crblk += 4, Cbblk += 4, Yblk += 8, image += 24) {
+            if (y == 8) Yblk += DSIZE2;
+            for (x = 0; x < 4; x++, image += 2, Crblk++, Cbblk++, Yblk += 2) {
+                putquadrgb15(image, Yblk, *Crblk, *Cbblk, A);
+                putquadrgb15(image + 8, Yblk + DSIZE2, *(Crblk + 4), *(Cbblk + 4), A);
+            }
+        }
+    } else {
+        for (y = 0; y < 16; y++, Yblk += 8, image += 16) {
+            if (y == 8) Yblk += DSIZE2;
+            putlinebw15(image, Yblk, A);
+            putlinebw15(image + 8, Yblk + DSIZE2, A);
+        }
+    }
+}
+
+inline void putlinebw24(uint8_t *image, int *Yblk) {
+    int i;
+    unsigned char Y;
+    for (i = 0; i < 8 * 3; i += 3, Yblk++) {
+        Y = CLAMP8(*Yblk);
+        image[i + 0] = Y;
+        image[i + 1] = Y;
+        image[i + 2] = Y;
+    }
+}
+
+inline void putquadrgb24(uint8_t *image, int *Yblk, int Cr, int Cb) {
+    int Y, R, G, B;
+
+    R = MULR(Cr);
+    G = MULG2(Cb, Cr);
+    B = MULB(Cb);
+
+    Y = MULY(Yblk[0]);
+    image[0 * 3 + 0] = CLAMP_SCALE8(Y + R);
+    image[0 * 3 + 1] = CLAMP_SCALE8(Y + G);
+    image[0 * 3 + 2] = CLAMP_SCALE8(Y + B);
+    Y = MULY(Yblk[1]);
+    image[1 * 3 + 0] = CLAMP_SCALE8(Y + R);
+    image[1 * 3 + 1] = CLAMP_SCALE8(Y + G);
+    image[1 * 3 + 2] = CLAMP_SCALE8(Y + B);
+    Y = MULY(Yblk[8]);
+    image[16 * 3 + 0] = CLAMP_SCALE8(Y + R);
+    image[16 * 3 + 1] = CLAMP_SCALE8(Y + G);
+    image[16 * 3 + 2] = CLAMP_SCALE8(Y + B);
+    Y = MULY(Yblk[9]);
+    image[17 * 3 + 0] = CLAMP_SCALE8(Y + R);
+    image[17 * 3 + 1] = CLAMP_SCALE8(Y + G);
+    image[17 * 3 + 2] = CLAMP_SCALE8(Y + B);
+}
+
+void referenceYuv2rgb24(int *blk, uint8_t *image, bool bnw) {
+    int x, y;
+    int *Yblk = blk + DSIZE2 * 2;
+    int *Crblk = blk;
+    int *Cbblk = blk + DSIZE2;
+
+    if (!bnw) {
+        for (y = 0; y < 16; y += 2, Crblk += 4, Cbblk += 4, Yblk += 8, image += 8 * 3 * 3) {
+            if (y == 8) Yblk += DSIZE2;
+            for (x = 0; x < 4; x++, image += 6, Crblk++, Cbblk++, Yblk += 2) {
+                putquadrgb24(image, Yblk, *Crblk, *Cbblk);
+                putquadrgb24(image + 8 * 3, Yblk + DSIZE2, *(Crblk + 4), *(Cbblk + 4));
+            }
+        }
+    } else {
+        for (y = 0; y < 16; y++, Yblk += 8, image += 16 * 3) {
+            if (y == 8) Yblk += DSIZE2;
+            putlinebw24(image, Yblk);
+            putlinebw24(image + 8 * 3, Yblk + DSIZE2);
+        }
+    }
+}
+
+struct Block {
+    int coefs[DSIZE2];
+    int used_col;
+};
+
+// What rl2blk hands over: a DC coefficient, then a run of AC ones along the zigzag, with used_col
+// tracking the columns with coefficients below row 0, or -1 for a lone DC. Every so often, a block full
+// of coefficients as large as the dequantization can make them.
+void randomBlock(KernelCheck::Random &random, Block &block) {
+    static const int zscan[DSIZE2] = {
+        0,  1,  8,  16, 9,  2,  3,  10, 17, 24, 32, 25, 18, 11, 4,  5,   // 00
+        12, 19, 26, 33, 40, 48, 41, 34, 27, 20, 13, 6,  7,  14, 21, 28,  // 10
+        35, 42, 49, 56, 57, 50, 43, 36, 29, 22, 15, 23, 30, 37, 44, 51,  // 20
+        58, 59, 52, 45, 38, 31, 39, 46, 53, 60, 61, 54, 47, 55, 62, 63,  // 30
+    };
+    memset(block.coefs, 0, sizeof(block.coefs));
+    const bool full = (random.next() & 15) == 0;
+    const int range = full ? 1 << 24 : 1 << random.range(4, 16);
+    block.coefs[0] = random.range(-range, range);
+    block.used_col = 0;
+    const unsigned count = full ? 63 : (random.next() & 3) ? random.range(1, 24) : 0;
+    for (unsigned i = 0, k = 0; i < count; i++) {
+        k += full ? 1 : 1 + random.next() % 4;
+        if (k > 63) break;
+        block.coefs[zscan[k]] = random.range(-range, range);
+        block.used_col |= (zscan[k] > 7) ? 1 << (zscan[k] & 7) : 0;
+    }
+    if (!count) block.used_col = -1;
+}
+
+// Cr, Cb and four Y blocks, mostly in the range the IDCT leaves them, sometimes far enough out to
+// saturate everything, but not so far that the scalar code overflows
+struct Macroblock {
+    int blk[DSIZE2 * 6];
+};
+
+void randomMacroblock(KernelCheck::Random &random, Macroblock &mb) {
+    const bool wild = (random.next() & 7) == 0;
+    for (unsigned b = 0; b < 6; b++) {
+        const int range = wild ? 1 << random.range(8, 19) : 1 << random.range(4, 8);
+        for (unsigned i = 0; i < DSIZE2; i++) mb.blk[b * DSIZE2 + i] = random.range(-range, range);
+    }
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+    const unsigned n = KernelCheck::cases(argc, argv, 200000);
+    KernelCheck::Random random;
+    unsigned mismatches = 0;
+
+    for (unsigned i = 0; i < n; i++) {
+        Block block;
+        randomBlock(random, block);
+        int reference[DSIZE2], coefs[DSIZE2];
+        memcpy(reference, block.coefs, sizeof(reference));
+        memcpy(coefs, block.coefs, sizeof(coefs));
+        referenceIdct(reference, block.used_col);
+        PCSX::MDECKernels::idct(coefs, block.used_col);
+        if (memcmp(reference, coefs, sizeof(coefs)) != 0) {
+            if (mismatches++ < 10) printf("IDCT mismatch, case %u, used_col %i\n", i, block.used_col);
+        }
+
+        // with room past the end of the images, to catch the 24 bits one writing past its last pixel
+        Macroblock mb;
+        randomMacroblock(random, mb);
+        const bool bnw = (i & 3) == 0;
+        const bool stp = i & 4;
+        uint16_t refImage15[DSIZE2 * 4 + 8], image15[DSIZE2 * 4 + 8];
+        memset(refImage15, 0x5a, sizeof(refImage15));
+        memset(image15, 0x5a, sizeof(image15));
+        referenceYuv2rgb15(mb.blk, refImage15, bnw, stp);
+        PCSX::MDECKernels::yuv2rgb15(mb.blk, image15, bnw, stp);
+        if (memcmp(refImage15, image15, sizeof(image15)) != 0) {
+            if (mismatches++ < 10) printf("YUV 15 bits mismatch, case %u, bnw %i, stp %i\n", i, bnw, stp);
+        }
+
+        randomMacroblock(random, mb);
+        uint8_t refImage24[DSIZE2 * 4 * 3 + 8], image24[DSIZE2 * 4 * 3 + 8];
+        memset(refImage24, 0x5a, sizeof(refImage24));
+        memset(image24, 0x5a, sizeof(image24));
+        referenceYuv2rgb24(mb.blk, refImage24, bnw);
+        PCSX::MDECKernels::yuv2rgb24(mb.blk, image24, bnw);
+        if (memcmp(refImage24, image24, sizeof(image24)) != 0) {
+            if (mismatches++ < 10) printf("YUV 24 bits mismatch, case %u, bnw %i\n", i, bnw);
+        }
+    }
+
+    // a set of blocks that fits in the cache, so that the IDCT is what gets timed
+    std::vector<Block> blocks(4096);
+    for (auto &block : blocks) randomBlock(random, block);
+    const unsigned rounds = std::max(n, 4096u) * 4;
+    // so that the results can't be optimized away
+    volatile int sink = 0;
+    int coefs[DSIZE2];
+    double refIdct = KernelCheck::nsPerCall(rounds, [&](unsigned i) {
+        const Block &block = blocks[i & 4095];
+        memcpy(coefs, block.coefs, sizeof(coefs));
+        referenceIdct(coefs, block.used_col);
+        sink = sink + coefs[i & 63];
+    });
+    double newIdct = KernelCheck::nsPerCall(rounds, [&](unsigned i) {
+        const Block &block = blocks[i & 4095];
+        memcpy(coefs, block.coefs, sizeof(coefs));
+        PCSX::MDECKernels::idct(coefs, block.used_col);
+        sink = sink + coefs[i & 63];
+    });
+
+    // and the same for the colour conversions
+    std::vector<Macroblock> macroblocks(256);
+    for (auto &mb : macroblocks) randomMacroblock(random, mb);
+    uint16_t image15[DSIZE2 * 4];
+    uint8_t image24[DSIZE2 * 4 * 3];
+    double refYuv15 = KernelCheck::nsPerCall(rounds / 4, [&](unsigned i) {
+        referenceYuv2rgb15(macroblocks[i & 255].blk, image15, false, i & 1);
+        sink = sink + image15[i & 255];
+    });
+    double newYuv15 = KernelCheck::nsPerCall(rounds / 4, [&](unsigned i) {
+        PCSX::MDECKernels::yuv2rgb15(macroblocks[i & 255].blk, image15, false, i & 1);
+        sink = sink + image15[i & 255];
+    });
+    double refYuv24 = KernelCheck::nsPerCall(rounds / 4, [&](unsigned i) {
+        referenceYuv2rgb24(macroblocks[i & 255].blk, image24, false);
+        sink = sink + image24[i & 255];
+    });
+    double newYuv24 = KernelCheck::nsPerCall(rounds / 4, [&](unsigned i) {
+        PCSX::MDECKernels::yuv2rgb24(macroblocks[i & 255].blk, image24, false);
+        sink = sink + image24[i & 255];
+    });
+    KernelCheck::bench("mdec", "IDCT block", refIdct, newIdct);
+    KernelCheck::bench("mdec", "YUV 15 bits macroblock", refYuv15, newYuv15);
+    KernelCheck::bench("mdec", "YUV 24 bits macroblock", refYuv24, newYuv24);
+
+    return KernelCheck::report("mdec", n, mismatches);
+}
@@ -0,0 +1,280 @@
+/***************************************************************************
+ *   Copyright (C) 2019 PCSX-Redux authors                                 *
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ *   This program is distributed in the hope that it will be useful,       *
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of        *
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the         *
+ *   GNU General Public License for more details.                          *
+ *                                                                         *
+ *   You should have received a copy of the GNU General Public License     *
+ *   along with this program; if not, write to the                         *
+ *   Free Software Foundation, Inc.,                                       *
+ *   51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA.           *
+ ***************************************************************************/
+
+// spu/neillreverb against the per sample MixREVERBLeft/MixREVERBRight it replaced, on random registers,
+// work areas and inputs: the output, the work area, the reverb state, and the block cache invalidations.
+
+#include <string.h>
+
+#include <algorithm>
+#include <vector>
+
+#include "common.h"
+#include "spu/neillreverb.h"
+
+namespace {
+
+using PCSX::SPU::REVERBInfo;
+
+const unsigned NSSIZE = 45;     // one 1 ms block, as the SPU thread mixes them
+const int WORK_AREA = 0x40000;  // in samples, which is the whole of the SPU RAM
+
+// MixREVERBLeft/MixREVERBRight and their buffer helpers, as they were in reverb.cc; the static counter
+// became a member, and every sample written gets marked instead of invalidating the block cache
+struct Reference {
+    REVERBInfo rvb;
+    short *p;
+    int iCnt;
+    std::vector<bool> *written;
+
+    int g_buffer(int iOff) {
+        iOff = (iOff * 4) + rvb.CurrAddr;
+        while (iOff > 0x3FFFF) iOff = rvb.StartAddr + (iOff - 0x40000);
+        while (iOff < rvb.StartAddr) iOff = 0x3ffff - (rvb.StartAddr - iOff);
+        return (int)*(p + iOff);
+    }
+
+    void s_buffer(int iOff, int iVal) {
+        iOff = (iOff * 4) + rvb.CurrAddr;
+        while (iOff > 0x3FFFF) iOff = rvb.StartAddr + (iOff - 0x40000);
+        while (iOff < rvb.StartAddr) iOff = 0x3ffff - (rvb.StartAddr - iOff);
+        if (iVal < -32768L) iVal = -32768L;
+        if (iVal > 32767L) iVal = 32767L;
+        *(p + iOff) = (short)iVal;
+        (*written)[iOff] = true;
+    }
+
+    void s_buffer1(int iOff, int iVal) {
+        iOff = (iOff * 4) + rvb.CurrAddr + 1;
+        while (iOff > 0x3FFFF) iOff = rvb.StartAddr + (iOff - 0x40000);
+        while (iOff < rvb.StartAddr) iOff = 0x3ffff - (rvb.StartAddr - iOff);
+        if (iVal < -32768L) iVal = -32768L;
+        if (iVal > 32767L) iVal = 32767L;
+        *(p + iOff) = (short)iVal;
+        (*written)[iOff] = true;
+    }
+
+    int MixREVERBLeft(const int *sRVBStart, int ns, bool reverbOn) {
+        if (!rvb.StartAddr) {
+            rvb.iLastRVBLeft = rvb.iLastRVBRight = rvb.iRVBLeft = rvb.iRVBRight = 0;
+            return 0;
+        }
+
+        iCnt++;
+
+        if (iCnt & 1) {
+            if (reverbOn) {
+                int ACC0, ACC1, FB_A0, FB_A1, FB_B0, FB_B1;
+
+                const int INPUT_SAMPLE_L = *(sRVBStart + (ns << 1));
+                const int INPUT_SAMPLE_R = *(sRVBStart + (ns << 1) + 1);
+
+                const int IIR_INPUT_A0 =
+                    (g_buffer(rvb.IIR_SRC_A0) * rvb.IIR_COEF) / 32768L + (INPUT_SAMPLE_L * rvb.IN_COEF_L) / 32768L;
+                const int IIR_INPUT_A1 =
+                    (g_buffer(rvb.IIR_SRC_A1) * rvb.IIR_COEF) / 32768L + (INPUT_SAMPLE_R * rvb.IN_COEF_R) / 32768L;
+                const int IIR_INPUT_B0 =
+                    (g_buffer(rvb.IIR_SRC_B0) * rvb.IIR_COEF) / 32768L + (INPUT_SAMPLE_L * rvb.IN_COEF_L) / 32768L;
+                const int IIR_INPUT_B1 =
+                    (g_buffer(rvb.IIR_SRC_B1) * rvb.IIR_COEF) / 32768L + (INPUT_SAMPLE_R * rvb.IN_COEF_R) / 32768L;
+
+                const int IIR_A0 = (IIR_INPUT_A0 * rvb.IIR_ALPHA) / 32768L +
+                                   (g_buffer(rvb.IIR_DEST_A0) * (32768L - rvb.IIR_ALPHA)) / 32768L;
+                const int IIR_A1 = (IIR_INPUT_A1 * rvb.IIR_ALPHA) / 32768L +
+                                   (g_buffer(rvb.IIR_DEST_A1) * (32768L - rvb.IIR_ALPHA)) / 32768L;
+                const int IIR_B0 = (IIR_INPUT_B0 * rvb.IIR_ALPHA) / 32768L +
+                                   (g_buffer(rvb.IIR_DEST_B0) * (32768L - rvb.IIR_ALPHA)) / 32768L;
+                const int IIR_B1 = (IIR_INPUT_B1 * rvb.IIR_ALPHA) / 32768L +
+                                   (g_buffer(rvb.IIR_DEST_B1) * (32768L - rvb.IIR_ALPHA)) / 32768L;
+
+                s_buffer1(rvb.IIR_DEST_A0, IIR_A0);
+                s_buffer1(rvb.IIR_DEST_A1, IIR_A1);
+                s_buffer1(rvb.IIR_DEST_B0, IIR_B0);
+                s_buffer1(rvb.IIR_DEST_B1, IIR_B1);
+
+                ACC0 = (g_buffer(rvb.ACC_SRC_A0) * rvb.ACC_COEF_A) / 32768L +
+                       (g_buffer(rvb.ACC_SRC_B0) * rvb.ACC_COEF_B) / 32768L +
+                       (g_buffer(rvb.ACC_SRC_C0) * rvb.ACC_COEF_C) / 32768L +
+                       (g_buffer(rvb.ACC_SRC_D0) * rvb.ACC_COEF_D) / 32768L;
+                ACC1 = (g_buffer(rvb.ACC_SRC_A1) * rvb.ACC_COEF_A) / 32768L +
+                       (g_buffer(rvb.ACC_SRC_B1) * rvb.ACC_COEF_B) / 32768L +
+                       (g_buffer(rvb.ACC_SRC_C1) * rvb.ACC_COEF_C) / 32768L +
+                       (g_buffer(rvb.ACC_SRC_D1) * rvb.ACC_COEF_D) / 32768L;
+
+                FB_A0 = g_buffer(rvb.MIX_DEST_A0 - rvb.FB_SRC_A);
+                FB_A1 = g_buffer(rvb.MIX_DEST_A1 - rvb.FB_SRC_A);
+                FB_B0 = g_buffer(rvb.MIX_DEST_B0 - rvb.FB_SRC_B);
+                FB_B1 = g_buffer(rvb.MIX_DEST_B1 - rvb.FB_SRC_B);
+
+                s_buffer(rvb.MIX_DEST_A0, ACC0 - (FB_A0 * rvb.FB_ALPHA) / 32768L);
+                s_buffer(rvb.MIX_DEST_A1, ACC1 - (FB_A1 * rvb.FB_ALPHA) / 32768L);
+
+                s_buffer(rvb.MIX_DEST_B0, (rvb.FB_ALPHA * ACC0) / 32768L -
+                                              (FB_A0 * (int)(rvb.FB_ALPHA ^ 0xFFFF8000)) / 32768L -
+                                              (FB_B0 * rvb.FB_X) / 32768L);
+                s_buffer(rvb.MIX_DEST_B1, (rvb.FB_ALPHA * ACC1) / 32768L -
+                                              (FB_A1 * (int)(rvb.FB_ALPHA ^ 0xFFFF8000)) / 32768L -
+                                              (FB_B1 * rvb.FB_X) / 32768L);
+
+                rvb.iLastRVBLeft = rvb.iRVBLeft;
+                rvb.iLastRVBRight = rvb.iRVBRight;
+
+                rvb.iRVBLeft = (g_buffer(rvb.MIX_DEST_A0) + g_buffer(rvb.MIX_DEST_B0)) / 3;
+                rvb.iRVBRight = (g_buffer(rvb.MIX_DEST_A1) + g_buffer(rvb.MIX_DEST_B1)) / 3;
+
+                rvb.iRVBLeft = (rvb.iRVBLeft * rvb.VolLeft) / 0x4000;
+                rvb.iRVBRight = (rvb.iRVBRight * rvb.VolRight) / 0x4000;
+
+                rvb.CurrAddr++;
+                if (rvb.CurrAddr > 0x3ffff) rvb.CurrAddr = rvb.StartAddr;
+
+                return rvb.iLastRVBLeft + (rvb.iRVBLeft - rvb.iLastRVBLeft) / 2;
+            } else {
+                rvb.iLastRVBLeft = rvb.iLastRVBRight = rvb.iRVBLeft = rvb.iRVBRight = 0;
+            }
+
+            rvb.CurrAddr++;
+            if (rvb.CurrAddr > 0x3ffff) rvb.CurrAddr = rvb.StartAddr;
+        }
+
+        return rvb.iLastRVBLeft;
+    }
+
+    int MixREVERBRight() {
+        int i = rvb.iLastRVBRight + (rvb.iRVBRight - rvb.iLastRVBRight) / 2;
+        rvb.iLastRVBRight = rvb.iRVBRight;
+        return i;
+    }
+
+    void mix(const int *in, int *left, int *right, bool reverbOn) {
+        for (unsigned ns = 0; ns < NSSIZE; ns++) {
+            left[ns] += MixREVERBLeft(in, ns, reverbOn);
+            right[ns] += MixREVERBRight();
+        }
+    }
+};
+
+// registers as the SPU sets them: unsigned offsets, signed coefficients, and a work area starting on a
+// multiple of 4 samples; offsets mostly stay within the area, as the presets have them, but not always
+void randomRegisters(KernelCheck::Random &random, REVERBInfo &rvb) {
+    memset(&rvb, 0, sizeof(rvb));
+    const bool far = (random.next() & 3) == 0;
+    int *const offsets[] = {
+        &rvb.FB_SRC_A,    &rvb.FB_SRC_B,    &rvb.IIR_DEST_A0, &rvb.IIR_DEST_A1, &rvb.ACC_SRC_A0, &rvb.ACC_SRC_A1,
+        &rvb.ACC_SRC_B0,  &rvb.ACC_SRC_B1,  &rvb.IIR_SRC_A0,  &rvb.IIR_SRC_A1,  &rvb.IIR_DEST_B0, &rvb.IIR_DEST_B1,
+        &rvb.ACC_SRC_C0,  &rvb.ACC_SRC_C1,  &rvb.ACC_SRC_D0,  &rvb.ACC_SRC_D1,  &rvb.IIR_SRC_B1,  &rvb.IIR_SRC_B0,
+        &rvb.MIX_DEST_A0, &rvb.MIX_DEST_A1, &rvb.MIX_DEST_B0, &rvb.MIX_DEST_B1,
+    };
+    int *const coefs[] = {
+        &rvb.IIR_ALPHA, &rvb.ACC_COEF_A, &rvb.ACC_COEF_B, &rvb.ACC_COEF_C, &rvb.ACC_COEF_D,
+        &rvb.IIR_COEF,  &rvb.FB_ALPHA,   &rvb.FB_X,       &rvb.IN_COEF_L,  &rvb.IN_COEF_R,
+    };
+
+    // anything from a tiny area that the taps wrap around several times, to a whole lot of it
+    const int size = 4 << random.range(0, 16);
+    const int start = std::max(4, (WORK_AREA - random.range(size / 2, size)) & ~3);
+    rvb.StartAddr = (random.next() & 63) ? start : 0;
+    rvb.CurrAddr = start + random.range(0, WORK_AREA - 1 - start);
+    for (int *offset : offsets) *offset = far ? random.range(0, 0xffff) : random.range(0, (WORK_AREA - start) / 4);
+    for (int *coef : coefs) *coef = (short)random.next();
+    rvb.VolLeft = random.range(0, 0xffff);
+    rvb.VolRight = random.range(0, 0xffff);
+}
+
+// the reverb input, as the voices mixed it in
+void randomInput(KernelCheck::Random &random, int *in, int range) {
+    for (unsigned i = 0; i < NSSIZE * 2; i++) in[i] = random.range(-range, range);
+}
+
+}  // namespace
+
+int main(int argc, char **argv) {
+    const unsigned n = KernelCheck::cases(argc, argv, 2000);
+    KernelCheck::Random random;
+    unsigned mismatches = 0;
+
+    std::vector<short> refMem(WORK_AREA), mem(WORK_AREA);
+    std::vector<bool> written(WORK_AREA), invalidated(WORK_AREA);
+    auto invalidate = [&](uint32_t addr, uint32_t size) {
+        for (uint32_t i = addr / 2; i < (addr + size) / 2; i++) invalidated[i] = true;
+    };
+
+    for (unsigned i = 0; i < n; i++) {
+        Reference ref;
+        randomRegisters(random, ref.rvb);
+        ref.p = refMem.data();
+        ref.iCnt = random.next() & 1;
+        ref.written = &written;
+        REVERBInfo rvb = ref.rvb;
+        int counter = ref.iCnt;
+        random.fill((uint8_t *)refMem.data(), WORK_AREA * sizeof(short));
+        mem = refMem;
+        std::fill(written.begin(), written.end(), false);
+        std::fill(invalidated.begin(), invalidated.end(), false);
+
+        // a few blocks in a row, with the reverb going on and off now and then
+        for (int block = 0; block < 16; block++) {
+            int in[NSSIZE * 2], refLeft[NSSIZE], refRight[NSSIZE], left[NSSIZE], right[NSSIZE];
+            randomInput(random, in, (i & 1) ? 32767 : 0x40000);
+            for (unsigned ns = 0; ns < NSSIZE; ns++) refLeft[ns] = refRight[ns] = left[ns] = right[ns] = ns;
+            const bool reverbOn = (random.next() & 7) != 0;
+            ref.mix(in, refLeft, refRight, reverbOn);
+            PCSX::SPU::NeillReverb::mix(rvb, (unsigned short *)mem.data(), in, left, right, NSSIZE, counter,
+                                        reverbOn, invalidate);
+            if (memcmp(refLeft, left, sizeof(left)) != 0 || memcmp(refRight, right, sizeof(right)) != 0 ||
+                memcmp(&ref.rvb, &rvb, sizeof(rvb)) != 0 || ref.iCnt != counter) {
+                if (mismatches++ < 10) printf("output mismatch, case %u, block %i\n", i, block);
+                break;
+            }
+        }
+        if (refMem != mem) {
+            if (mismatches++ < 10) printf("work area mismatch, case %u\n", i);
+        }
+        for (int addr = 0; addr < WORK_AREA; addr++) {
+            if (written[addr] && !invalidated[addr]) {
+                if (mismatches++ < 10) printf("missing invalidation, case %u, address %05x\n", i, addr);
+                break;
+            }
+        }
+    }
+
+    // a hall sized area, with the taps where the presets put them
+    Reference ref;
+    randomRegisters(random, ref.rvb);
+    ref.rvb.StartAddr = WORK_AREA - 0x6000;
+    ref.rvb.CurrAddr = ref.rvb.StartAddr;
+    for (int *offset : {&ref.rvb.IIR_DEST_A0, &ref.rvb.IIR_SRC_A0, &ref.rvb.ACC_SRC_A0, &ref.rvb.MIX_DEST_A0})
+        *offset = 0x100;
+    ref.p = refMem.data();
+    ref.iCnt = 0;
+    ref.written = &written;
+    REVERBInfo rvb = ref.rvb;
+    int counter = 0;
+    int in[NSSIZE * 2], left[NSSIZE] = {}, right[NSSIZE] = {};
+    randomInput(random, in, 32767);
+    auto nop = [](uint32_t, uint32_t) {};
+    const unsigned rounds = std::max(n, 2000u) * 10;
+    double reference = KernelCheck::nsPerCall(rounds, [&](unsigned) { ref.mix(in, left, right, true); });
+    double kernel = KernelCheck::nsPerCall(rounds, [&](unsigned) {
+        PCSX::SPU::NeillReverb::mix(rvb, (unsigned short *)mem.data(), in, left, right, NSSIZE, counter, true, nop);
+    });
+    KernelCheck::bench("reverb", "1 ms block", reference, kernel);
+
+    return KernelCheck::report("reverb", n, mismatches);
+}